@@ -0,0 +1,507 @@
+
+// standard c headers
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+
+// the sound card
+#ifdef HAVE_ALSA
+    #include <alsa/asoundlib.h>
+#endif
+
+// prototypes and definitions
+#include "audioEngine.h"
+
+// wav format tags
+#define WAV_PCM         1
+#define WAV_FLOAT       3
+#define WAV_EXTENSIBLE  0xfffe
+
+// latency asked of the sound card, in microseconds
+#define ALSA_LATENCY  100000
+
+// what the game thread asks of the mixer
+#define CMD_PLAY  0
+#define CMD_STOP  1
+
+typedef struct {
+    int  type;
+    int  sound;
+    bool loop;
+} audiocmd;
+
+// a decoded sound, interleaved at AUDIO_RATE
+typedef struct {
+    int16_t *samples;
+    long     frames;
+} audiosound;
+
+// a sound playing, the mixer's alone
+typedef struct {
+    int  sound;             // -1 when free
+    long frame;             // next one to mix
+    bool loop;
+} audiovoice;
+
+static audiosound sounds[AUDIO_MAX_SOUNDS];
+static int        numSounds = 0;
+
+static audiovoice voices[AUDIO_MAX_VOICES];
+
+// single producer, single consumer: the game thread fills queue[head],
+// the mixer empties queue[tail], neither waits on the other
+static audiocmd    queue[AUDIO_QUEUE_SIZE];
+static atomic_uint queueHead = 0;
+static atomic_uint queueTail = 0;
+
+static pthread_t   mixer;
+static bool        running = false;
+static atomic_bool stopping = false;
+
+// mixed on the caller's clock rather than on the thread
+static bool   stepped = false;
+static double steppedMs = 0.0;      // caller's time since the start
+static long   steppedFrames = 0;    // frames mixed since the start
+
+// where the mix goes
+static int   sink = AUDIO_SINK_NULL;
+static FILE *wavFile = NULL;
+static long  wavFrames = 0;
+#ifdef HAVE_ALSA
+static snd_pcm_t *pcm = NULL;
+#endif
+
+// little-endian fields
+static unsigned get16(const unsigned char *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t get32(const unsigned char *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void put16(unsigned char *p, unsigned v)
+{
+    p[0] = v & 255;
+    p[1] = (v >> 8) & 255;
+}
+
+static void put32(unsigned char *p, uint32_t v)
+{
+    put16(p, v & 0xffff);
+    put16(p + 2, v >> 16);
+}
+
+// one stored sample as -1 to 1
+static float readSample(const unsigned char *p, int format, int bits)
+{
+    if (format == WAV_FLOAT) {
+        float f;
+        memcpy(&f, p, sizeof(f));
+        return f;
+    }
+
+    switch (bits) {
+        case 8:  return (p[0] - 128) / 128.0f;
+        case 16: return (int16_t)get16(p) / 32768.0f;
+        case 24: return (int32_t)((uint32_t)p[0] << 8 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 24) /
+                        2147483648.0f;
+        default: return (int32_t)get32(p) / 2147483648.0f;
+    }
+}
+
+// the whole of a file, NULL if it cannot be read
+static unsigned char *readFile(const char *filename, long *size)
+{
+    FILE *f = fopen(filename, "rb");
+    unsigned char *data = NULL;
+
+    if (f == NULL)
+        return NULL;
+
+    if (fseek(f, 0, SEEK_END) == 0 && (*size = ftell(f)) > 0 && fseek(f, 0, SEEK_SET) == 0 &&
+        (data = malloc(*size)) != NULL && fread(data, 1, *size, f) != (size_t)*size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    return data;
+}
+
+// decode a wav file to the mixer's format once
+int audioLoad(const char *filename)
+{
+    long size;
+    const unsigned char *fmt = NULL, *pcmData = NULL;
+    uint32_t fmtSize = 0, dataSize = 0;
+
+    if (numSounds == AUDIO_MAX_SOUNDS) {
+        fprintf(stderr, "Error: more than %d sounds\n", AUDIO_MAX_SOUNDS);
+        return -1;
+    }
+
+    unsigned char *file = readFile(filename, &size);
+    if (file == NULL) {
+        fprintf(stderr, "Error: could not read sound %s\n", filename);
+        return -1;
+    }
+
+    // the chunks after the RIFF header, each padded to an even size
+    if (size >= 12 && memcmp(file, "RIFF", 4) == 0 && memcmp(file + 8, "WAVE", 4) == 0)
+        for (long at = 12; at + 8 <= size; ) {
+            uint32_t len = get32(file + at + 4);
+
+            if (len > size - at - 8)
+                len = size - at - 8;
+            if (memcmp(file + at, "fmt ", 4) == 0) {
+                fmt     = file + at + 8;
+                fmtSize = len;
+            }
+            else if (memcmp(file + at, "data", 4) == 0) {
+                pcmData  = file + at + 8;
+                dataSize = len;
+            }
+            at += 8 + len + (len & 1);
+        }
+
+    int format = 0, channels = 0, rate = 0, bits = 0;
+    if (fmt != NULL && fmtSize >= 16) {
+        format   = get16(fmt);
+        channels = get16(fmt + 2);
+        rate     = get32(fmt + 4);
+        bits     = get16(fmt + 14);
+
+        // the real tag leads the subformat guid
+        if (format == WAV_EXTENSIBLE && fmtSize >= 26)
+            format = get16(fmt + 24);
+    }
+
+    if (pcmData == NULL || channels < 1 || rate < 1 ||
+        !((format == WAV_PCM && (bits == 8 || bits == 16 || bits == 24 || bits == 32)) ||
+          (format == WAV_FLOAT && bits == 32))) {
+        fprintf(stderr, "Error: %s is not a PCM or float wav file\n", filename);
+        free(file);
+        return -1;
+    }
+
+    // the first two channels, a mono sound on both sides; resampled
+    // linearly to the mixer's rate
+    int    stride = channels * bits / 8;
+    long   in     = dataSize / stride;
+    long   out    = (long)((double)in * AUDIO_RATE / rate + 0.5);
+    double step   = (double)rate / AUDIO_RATE;
+    int16_t *samples = malloc(sizeof(int16_t) * AUDIO_CHANNELS * (out > 0 ? out : 1));
+
+    if (samples == NULL) {
+        fprintf(stderr, "Error: out of memory decoding %s\n", filename);
+        free(file);
+        return -1;
+    }
+
+    for (long i = 0; i < out; ++i) {
+        double at = i * step;
+        long   j  = (long)at;
+        float  f  = (float)(at - j);
+        long   k  = j + 1 < in ? j + 1 : j;
+
+        for (int c = 0; c < AUDIO_CHANNELS; ++c) {
+            int   ch = c < channels ? c : 0;
+            float a  = readSample(pcmData + j * stride + ch * bits / 8, format, bits);
+            float b  = readSample(pcmData + k * stride + ch * bits / 8, format, bits);
+            float v  = a + (b - a) * f;
+
+            v = v < -1.0f ? -1.0f : v > 1.0f ? 1.0f : v;
+            samples[i * AUDIO_CHANNELS + c] = (int16_t)lrintf(v * 32767.0f);
+        }
+    }
+    free(file);
+
+    sounds[numSounds].samples = samples;
+    sounds[numSounds].frames  = out;
+    return numSounds++;
+}
+
+// queue a command, false if the mixer is that far behind
+static bool post(int type, int id, bool loop)
+{
+    unsigned head = atomic_load_explicit(&queueHead, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&queueTail, memory_order_acquire);
+
+    if (!running || id < 0 || id >= numSounds || head - tail == AUDIO_QUEUE_SIZE)
+        return false;
+
+    queue[head % AUDIO_QUEUE_SIZE] = (audiocmd){ type, id, loop };
+    atomic_store_explicit(&queueHead, head + 1, memory_order_release);
+    return true;
+}
+
+bool audioPlay(int id, bool loop)
+{
+    return post(CMD_PLAY, id, loop);
+}
+
+bool audioStop(int id)
+{
+    return post(CMD_STOP, id, false);
+}
+
+// carry out the commands queued since the last period
+static void takeCommands()
+{
+    unsigned tail = atomic_load_explicit(&queueTail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&queueHead, memory_order_acquire);
+
+    for (; tail != head; ++tail) {
+        const audiocmd *c = &queue[tail % AUDIO_QUEUE_SIZE];
+
+        if (c->type == CMD_PLAY) {
+            // a sound past the voice limit is dropped
+            for (int v = 0; v < AUDIO_MAX_VOICES; ++v)
+                if (voices[v].sound < 0) {
+                    voices[v].sound = c->sound;
+                    voices[v].frame = 0;
+                    voices[v].loop  = c->loop;
+                    break;
+                }
+        }
+        else {
+            for (int v = 0; v < AUDIO_MAX_VOICES; ++v)
+                if (voices[v].sound == c->sound)
+                    voices[v].sound = -1;
+        }
+    }
+    atomic_store_explicit(&queueTail, tail, memory_order_release);
+}
+
+// add up the voices for one period
+static void mixPeriod(int16_t *out)
+{
+    int32_t mix[AUDIO_PERIOD * AUDIO_CHANNELS] = {0};
+
+    for (int v = 0; v < AUDIO_MAX_VOICES; ++v) {
+        audiovoice       *vc = &voices[v];
+        const audiosound *s;
+
+        if (vc->sound < 0)
+            continue;
+
+        s = &sounds[vc->sound];
+        for (int i = 0; i < AUDIO_PERIOD && vc->sound >= 0; ) {
+            long n = s->frames - vc->frame;
+
+            if (n > AUDIO_PERIOD - i)
+                n = AUDIO_PERIOD - i;
+            for (long k = 0; k < n * AUDIO_CHANNELS; ++k)
+                mix[i * AUDIO_CHANNELS + k] += s->samples[vc->frame * AUDIO_CHANNELS + k];
+            i         += n;
+            vc->frame += n;
+
+            if (vc->frame >= s->frames) {
+                if (vc->loop && s->frames > 0)
+                    vc->frame = 0;
+                else
+                    vc->sound = -1;
+            }
+        }
+    }
+
+    for (int k = 0; k < AUDIO_PERIOD * AUDIO_CHANNELS; ++k)
+        out[k] = mix[k] > 32767 ? 32767 : mix[k] < -32768 ? -32768 : mix[k];
+}
+
+// a canonical 44 byte header, the sizes filled in when the file is done
+static void writeWavHeader(FILE *f, long frames)
+{
+    unsigned char h[44];
+    uint32_t bytes = frames * AUDIO_CHANNELS * sizeof(int16_t);
+
+    memcpy(h, "RIFF", 4);
+    put32(h + 4, 36 + bytes);
+    memcpy(h + 8, "WAVEfmt ", 8);
+    put32(h + 16, 16);
+    put16(h + 20, WAV_PCM);
+    put16(h + 22, AUDIO_CHANNELS);
+    put32(h + 24, AUDIO_RATE);
+    put32(h + 28, AUDIO_RATE * AUDIO_CHANNELS * sizeof(int16_t));
+    put16(h + 32, AUDIO_CHANNELS * sizeof(int16_t));
+    put16(h + 34, 16);
+    memcpy(h + 36, "data", 4);
+    put32(h + 40, bytes);
+
+    fseek(f, 0, SEEK_SET);
+    fwrite(h, 1, sizeof(h), f);
+    fseek(f, 0, SEEK_END);
+}
+
+// hand a period to the sink; true if it kept time by blocking, as the
+// sound card does
+static bool writePeriod(const int16_t *out)
+{
+#ifdef HAVE_ALSA
+    if (sink == AUDIO_SINK_ALSA) {
+        snd_pcm_sframes_t n = snd_pcm_writei(pcm, out, AUDIO_PERIOD);
+        if (n < 0)
+            snd_pcm_recover(pcm, n, 1);
+        return true;
+    }
+#endif
+
+    if (sink == AUDIO_SINK_WAV) {
+        fwrite(out, sizeof(int16_t) * AUDIO_CHANNELS, AUDIO_PERIOD, wavFile);
+        wavFrames += AUDIO_PERIOD;
+    }
+    return false;
+}
+
+// mix until told to stop; sinks that don't block are kept in time by
+// sleeping until each period would have been heard
+static void *mixerMain(void *unused)
+{
+    int16_t out[AUDIO_PERIOD * AUDIO_CHANNELS];
+    struct timespec due;
+
+    clock_gettime(CLOCK_MONOTONIC, &due);
+    while (!atomic_load(&stopping)) {
+        takeCommands();
+        mixPeriod(out);
+        if (writePeriod(out))
+            continue;
+
+        due.tv_nsec += (long)AUDIO_PERIOD * 1000000000L / AUDIO_RATE;
+        if (due.tv_nsec >= 1000000000L) {
+            due.tv_nsec -= 1000000000L;
+            ++due.tv_sec;
+        }
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &due, NULL);
+    }
+    return NULL;
+}
+
+// mix the periods due after ms more of the caller's time
+void audioAdvance(double ms)
+{
+    int16_t out[AUDIO_PERIOD * AUDIO_CHANNELS];
+
+    if (!running || !stepped)
+        return;
+
+    // whole periods only, the rest waits for the next call
+    steppedMs += ms;
+    while (steppedFrames + AUDIO_PERIOD <= (long)(steppedMs * AUDIO_RATE / 1000.0)) {
+        takeCommands();
+        mixPeriod(out);
+        writePeriod(out);
+        steppedFrames += AUDIO_PERIOD;
+    }
+}
+
+// open the sink, false with the reason printed
+static bool openSink(const char *output)
+{
+    switch (sink) {
+        case AUDIO_SINK_WAV:
+            wavFile = output != NULL ? fopen(output, "wb") : NULL;
+            if (wavFile == NULL) {
+                fprintf(stderr, "Error: could not write sound to %s\n", output ? output : "(no file)");
+                return false;
+            }
+            wavFrames = 0;
+            writeWavHeader(wavFile, 0);
+            return true;
+
+        case AUDIO_SINK_ALSA:
+#ifdef HAVE_ALSA
+        {
+            int err = snd_pcm_open(&pcm, "default", SND_PCM_STREAM_PLAYBACK, 0);
+            if (err >= 0)
+                err = snd_pcm_set_params(pcm, SND_PCM_FORMAT_S16_LE, SND_PCM_ACCESS_RW_INTERLEAVED,
+                                         AUDIO_CHANNELS, AUDIO_RATE, 1, ALSA_LATENCY);
+            if (err < 0) {
+                fprintf(stderr, "Error: could not open the sound card: %s\n", snd_strerror(err));
+                if (pcm != NULL)
+                    snd_pcm_close(pcm);
+                pcm = NULL;
+                return false;
+            }
+            return true;
+        }
+#else
+            fprintf(stderr, "Error: built without ALSA, sound is mixed and dropped\n");
+            return false;
+#endif
+
+        default:
+            return true;
+    }
+}
+
+// open the sink and start the mixer thread
+bool audioStart(int sinkType, const char *output, bool steppedMix)
+{
+    bool opened;
+
+    if (running)
+        return true;
+
+    for (int v = 0; v < AUDIO_MAX_VOICES; ++v)
+        voices[v].sound = -1;
+
+    sink   = sinkType;
+    opened = openSink(output);
+    if (!opened)
+        sink = AUDIO_SINK_NULL;
+
+    // the caller's frames drive the mix, no thread
+    stepped       = steppedMix;
+    steppedMs     = 0.0;
+    steppedFrames = 0;
+    if (stepped) {
+        running = true;
+        return opened;
+    }
+
+    atomic_store(&stopping, false);
+    if (pthread_create(&mixer, NULL, mixerMain, NULL) != 0) {
+        fprintf(stderr, "Error: could not start the sound mixer\n");
+        return false;
+    }
+    running = true;
+    return opened;
+}
+
+// stop the mixer, finish the wav file and free the sounds
+void audioShutdown()
+{
+    if (running && !stepped) {
+        atomic_store(&stopping, true);
+        pthread_join(mixer, NULL);
+    }
+    running = false;
+
+#ifdef HAVE_ALSA
+    if (pcm != NULL) {
+        snd_pcm_drop(pcm);
+        snd_pcm_close(pcm);
+        pcm = NULL;
+    }
+#endif
+
+    if (wavFile != NULL) {
+        writeWavHeader(wavFile, wavFrames);
+        fclose(wavFile);
+        wavFile = NULL;
+    }
+
+    for (int i = 0; i < numSounds; ++i)
+        free(sounds[i].samples);
+    numSounds = 0;
+    atomic_store(&queueHead, 0);
+    atomic_store(&queueTail, 0);
+}
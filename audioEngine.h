@@ -0,0 +1,68 @@
+#ifndef AUDIOENGINE_H
+    #define AUDIOENGINE_H
+
+    // make c++ friendly
+    #ifdef __cplusplus
+        extern "C" {
+    #endif
+
+    #include <stdbool.h>
+
+    // what the mixer puts out: interleaved 16 bit stereo
+    #define AUDIO_RATE      44100
+    #define AUDIO_CHANNELS  2
+
+    // frames mixed at a time, about 23 ms
+    #define AUDIO_PERIOD  1024
+
+    // most sounds held in memory, and playing at once
+    #define AUDIO_MAX_SOUNDS  8
+    #define AUDIO_MAX_VOICES  16
+
+    // commands waiting for the mixer, a power of 2
+    #define AUDIO_QUEUE_SIZE  64
+
+    // where the mix goes
+    #define AUDIO_SINK_NULL  0      // mixed in time and dropped
+    #define AUDIO_SINK_ALSA  1      // the default sound card, if built with HAVE_ALSA
+    #define AUDIO_SINK_WAV   2      // a wav file, in time as it would be heard
+
+    // the sound card when there is a driver for it
+    #ifdef HAVE_ALSA
+        #define AUDIO_SINK_DEFAULT  AUDIO_SINK_ALSA
+    #else
+        #define AUDIO_SINK_DEFAULT  AUDIO_SINK_NULL
+    #endif
+
+    // open the sink and start the mixer thread; output names the wav file
+    // for AUDIO_SINK_WAV; false with the reason printed if the sink will
+    // not open, the mix then goes to the null sink
+    // stepped runs no thread, the mix keeps to the caller's clock through
+    // audioAdvance instead, so a recording lands the same on any machine
+    bool audioStart(int sink, const char *output, bool stepped);
+
+    // a stepped engine mixes the periods due after ms more of the caller's
+    // time; does nothing when the mixer runs in real time
+    void audioAdvance(double ms);
+
+    // decode a wav file to the mixer's format once, PCM of 8 to 32 bits
+    // or float, any rate and channels; returns its id, -1 with the reason
+    // printed if it is missing or unreadable
+    int audioLoad(const char *filename);
+
+    // start a sound, from the beginning again each time; costs a slot in
+    // the lock-free queue, false if the queue is full or id is not loaded
+    // called from one thread only, the one that started the engine
+    bool audioPlay(int id, bool loop);
+
+    // stop every voice of a sound
+    bool audioStop(int id);
+
+    // stop the mixer, finish the wav file and free the sounds
+    void audioShutdown();
+
+    #ifdef __cplusplus
+        }
+    #endif
+
+#endif
@@ -0,0 +1,284 @@
+// standard c headers
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdbool.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+
+// OpenGL and GLUT headers
+#ifdef __APPLE__
+    #include <GLUT/glut.h>
+#else
+    #include <GL/gl.h>
+    #include <GL/glu.h>
+    #include <GL/glut.h>
+#endif
+
+// 3d navigation
+#include "navigator.h"
+
+// prototypes and definitions
+#include "benchmark.h"
+
+// the camera path
+static benchkey keys[BENCH_MAX_KEYS];
+static int numKeys = 0;
+static int step = BENCH_DEFAULT_STEP;
+
+// progress along the path
+static int frame = 0;
+static int numFrames = 0;
+
+// where a report without a file name goes, stdout unless it was taken
+static FILE *reportFile = NULL;
+
+// wall and cpu time of each timed frame in ms
+static double *frameTimes = NULL;
+static double *cpuTimes   = NULL;
+
+// milliseconds on the given clock
+static double clockMs(clockid_t id)
+{
+    struct timespec t;
+
+    clock_gettime(id, &t);
+    return t.tv_sec * 1000.0 + t.tv_nsec / 1000000.0;
+}
+
+// true if text starts with the keyword followed by a space or the
+// end of the line, so "step" does not also match "steps"
+static bool isKeyword(const char *text, const char *word)
+{
+    size_t len = strlen(word);
+
+    return strncmp(text, word, len) == 0 &&
+           (text[len] == '\0' || isspace((unsigned char)text[len]));
+}
+
+// read a camera path, one "x y z rotationH rotationV zoom" keyframe
+// per line; "step N" sets the frames between keyframes and # starts
+// a comment; false when the file can't be used
+bool benchLoadPath(const char *fileName)
+{
+    FILE *file = fopen(fileName, "r");
+    char line[256];
+    int lineNum = 0;
+
+    if (file == NULL) {
+        fprintf(stderr, "Error: could not open camera path %s\n", fileName);
+        return false;
+    }
+
+    numKeys = 0;
+    while (fgets(line, sizeof(line), file) != NULL) {
+        char *text = line + strspn(line, " \t");
+        benchkey k;
+
+        ++lineNum;
+        if (*text == '#' || *text == '\n' || *text == '\r' || *text == '\0')
+            continue;
+
+        if (isKeyword(text, "step")) {
+            if (sscanf(text + 4, "%d", &step) != 1 || step <= 0) {
+                fprintf(stderr, "Error: %s:%d: step expects a positive frame count\n", fileName, lineNum);
+                fclose(file);
+                return false;
+            }
+            continue;
+        }
+
+        if (sscanf(text, "%lf %lf %lf %lf %lf %lf", &k.x, &k.y, &k.z, &k.h, &k.v, &k.zoom) != 6) {
+            fprintf(stderr, "Error: %s:%d: expected x y z rotationH rotationV zoom\n", fileName, lineNum);
+            fclose(file);
+            return false;
+        }
+
+        if (numKeys == BENCH_MAX_KEYS) {
+            fprintf(stderr, "Error: %s has more than %d keyframes\n", fileName, BENCH_MAX_KEYS);
+            fclose(file);
+            return false;
+        }
+        keys[numKeys++] = k;
+    }
+    fclose(file);
+
+    if (numKeys == 0) {
+        fprintf(stderr, "Error: %s has no keyframes\n", fileName);
+        return false;
+    }
+
+    // a lone keyframe is held for one step
+    numFrames = (numKeys == 1) ? step : (numKeys - 1) * step + 1;
+    frame = -BENCH_WARMUP_FRAMES;
+
+    free(frameTimes);
+    free(cpuTimes);
+    frameTimes = malloc(numFrames * sizeof(double));
+    cpuTimes   = malloc(numFrames * sizeof(double));
+    if (frameTimes == NULL || cpuTimes == NULL) {
+        fprintf(stderr, "Error: out of memory for %d benchmark frames\n", numFrames);
+        return false;
+    }
+
+    return true;
+}
+
+// place the camera on the path at frame f
+static void benchPlaceCamera(int f)
+{
+    int seg = (f <= 0) ? 0 : f / step;
+    const benchkey *a, *b;
+    GLdouble t, dh;
+
+    if (seg >= numKeys - 1) {
+        a = b = &keys[numKeys - 1];
+        t = 0.0;
+    } else {
+        a = &keys[seg];
+        b = &keys[seg + 1];
+        t = (f <= 0) ? 0.0 : (GLdouble)(f - seg * step) / step;
+    }
+
+    // turn the short way round
+    dh = fmod(b->h - a->h, 360.0);
+    if (dh > 180.0)
+        dh -= 360.0;
+    else if (dh < -180.0)
+        dh += 360.0;
+
+    navSetCamera(a->x + (b->x - a->x) * t,
+                 a->y + (b->y - a->y) * t,
+                 a->z + (b->z - a->z) * t,
+                 a->h + dh * t,
+                 a->v + (b->v - a->v) * t,
+                 a->zoom + (b->zoom - a->zoom) * t);
+}
+
+// place the camera for the next frame and time its draw
+// false once the whole path has been flown
+bool benchFrame()
+{
+    double wallStart, cpuStart;
+
+    if (frame >= numFrames)
+        return false;
+
+    benchPlaceCamera(frame);
+
+    wallStart = clockMs(CLOCK_MONOTONIC);
+    cpuStart  = clockMs(CLOCK_THREAD_CPUTIME_ID);
+
+    // finish so the time covers the GL's work, not just its queueing
+    navDisplay();
+    glFinish();
+
+    if (frame >= 0) {
+        frameTimes[frame] = clockMs(CLOCK_MONOTONIC) - wallStart;
+        cpuTimes[frame]   = clockMs(CLOCK_THREAD_CPUTIME_ID) - cpuStart;
+    }
+
+    return ++frame < numFrames;
+}
+
+// keep stdout for the JSON report alone, so it can be piped; anything
+// else printed goes to stderr from here on
+void benchTakeStdout()
+{
+    int fd;
+
+    fflush(stdout);
+    fd = dup(STDOUT_FILENO);
+    if (fd < 0 || (reportFile = fdopen(fd, "w")) == NULL) {
+        fprintf(stderr, "Error: could not keep stdout for the benchmark report\n");
+        return;
+    }
+    dup2(STDERR_FILENO, STDOUT_FILENO);
+}
+
+static int compareTimes(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+
+    return (x > y) - (x < y);
+}
+
+// nearest-rank percentile p of n sorted times
+static double percentile(const double *sorted, int n, double p)
+{
+    int rank = (int)ceil(p / 100.0 * n);
+
+    if (rank < 1)
+        rank = 1;
+    return sorted[rank - 1];
+}
+
+static double mean(const double *times, int n)
+{
+    double sum = 0.0;
+
+    for (int i = 0; i < n; ++i)
+        sum += times[i];
+    return sum / n;
+}
+
+// write the frame time statistics as JSON, to stdout when
+// fileName is NULL
+bool benchReport(const char *fileName)
+{
+    int n = (frame < numFrames) ? frame : numFrames;
+    FILE *file = (reportFile != NULL) ? reportFile : stdout;
+    double *sorted;
+    GLint viewport[4];
+
+    if (n <= 0) {
+        fprintf(stderr, "Error: no benchmark frames were drawn\n");
+        return false;
+    }
+
+    sorted = malloc(n * sizeof(double));
+    if (sorted == NULL)
+        return false;
+    memcpy(sorted, frameTimes, n * sizeof(double));
+    qsort(sorted, n, sizeof(double), compareTimes);
+
+    if (fileName != NULL && (file = fopen(fileName, "w")) == NULL) {
+        fprintf(stderr, "Error: could not open %s for writing\n", fileName);
+        free(sorted);
+        return false;
+    }
+
+    navGetViewport(viewport);
+
+    fprintf(file, "{\n");
+    fprintf(file, "  \"frames\": %d,\n", n);
+    fprintf(file, "  \"width\": %d,\n", viewport[2]);
+    fprintf(file, "  \"height\": %d,\n", viewport[3]);
+    fprintf(file, "  \"mean_ms\": %.4f,\n", mean(frameTimes, n));
+    fprintf(file, "  \"p50_ms\": %.4f,\n", percentile(sorted, n, 50.0));
+    fprintf(file, "  \"p95_ms\": %.4f,\n", percentile(sorted, n, 95.0));
+    fprintf(file, "  \"p99_ms\": %.4f,\n", percentile(sorted, n, 99.0));
+    fprintf(file, "  \"max_ms\": %.4f,\n", sorted[n - 1]);
+    fprintf(file, "  \"cpu_mean_ms\": %.4f,\n", mean(cpuTimes, n));
+
+    fprintf(file, "  \"frame_ms\": [");
+    for (int i = 0; i < n; ++i)
+        fprintf(file, "%s%.4f", i ? ", " : "", frameTimes[i]);
+    fprintf(file, "],\n");
+
+    fprintf(file, "  \"cpu_ms\": [");
+    for (int i = 0; i < n; ++i)
+        fprintf(file, "%s%.4f", i ? ", " : "", cpuTimes[i]);
+    fprintf(file, "]\n");
+    fprintf(file, "}\n");
+
+    if (file != stdout && file != reportFile)
+        fclose(file);
+    else
+        fflush(file);
+    free(sorted);
+    return true;
+}
@@ -0,0 +1,58 @@
+#ifndef BENCHMARK_H
+    #define BENCHMARK_H
+
+    // make c++ friendly
+    #ifdef __cplusplus
+        extern "C" {
+    #endif
+
+    // OpenGL and GLUT headers
+    #ifdef __APPLE__
+        #include <GLUT/glut.h>
+    #else
+        #include <GL/gl.h>
+        #include <GL/glu.h>
+        #include <GL/glut.h>
+    #endif
+
+    #include <stdbool.h>
+
+    // most keyframes in a camera path
+    #define BENCH_MAX_KEYS 256
+
+    // frames flown between two keyframes unless the path says otherwise
+    #define BENCH_DEFAULT_STEP 30
+
+    // untimed frames drawn at the first keyframe so one-time setup
+    // such as mesh baking doesn't land in the results
+    #define BENCH_WARMUP_FRAMES 5
+
+    // one camera pose along the path
+    typedef struct {
+        GLdouble x, y, z;   // camera location
+        GLdouble h, v;      // rotationH, rotationV in degrees
+        GLdouble zoom;      // zoomLevel
+    } benchkey;
+
+    // read a camera path, one "x y z rotationH rotationV zoom" keyframe
+    // per line; "step N" sets the frames between keyframes and # starts
+    // a comment; false when the file can't be used
+    bool benchLoadPath(const char *fileName);
+
+    // place the camera for the next frame and time its draw
+    // false once the whole path has been flown
+    bool benchFrame();
+
+    // keep stdout for the JSON report alone, so it can be piped; anything
+    // else printed goes to stderr from here on
+    void benchTakeStdout();
+
+    // write the frame time statistics as JSON, to stdout when
+    // fileName is NULL
+    bool benchReport(const char *fileName);
+
+    #ifdef __cplusplus
+        }
+    #endif
+
+#endif
@@ -1,5 +1,4 @@
 
-
 // OpenGL and GLUT headers
 #ifdef __APPLE__
     #include <GLUT/glut.h>
@@ -10,1918 +9,306 @@
 #endif
 
 // standard c libraries
+#include <stdio.h>
 #include <math.h>
 #include <stdlib.h>
+#include <stdbool.h>
+
+// file mapping
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 // protypes and definitons
 #include "doubleHelix.h"
 
-static GLUquadric *quadricHelix = NULL;
+// unit sphere and cylinder tessellation
+#include "primatives.h"
 
-// initialize draw routine
-void initDoubleHelix()
+// shadowed GL state
+#include "glState.h"
+
+// placement of one sphere or cylinder
+typedef struct {
+    GLdouble xform[16];     // rigid transform, column major
+    GLdouble scale[3];      // radius and length of the unit shape
+    GLuint   material;      // palette entry
+} helixinstance;
+
+// every color a primitive can have, resolved once
+static GLfloat palette[HELIX_PALETTE_SIZE][4];
+static bool    paletteReady = false;
+
+// private generator so the colors never disturb rand()
+static GLuint colorSeed = HELIX_COLOR_SEED;
+
+// instance lists
+static helixinstance *atoms = NULL;
+static int            numAtoms, maxAtoms;
+static helixinstance *bonds = NULL;
+static int            numBonds, maxBonds;
+
+// mapped molecule file
+static void              *helixFile = NULL;
+static size_t             helixFileSize;
+static const helixheader *helixHeader;
+static const helixatom   *helixAtoms;
+static const helixbond   *helixBonds;
+
+// baked instance buffers, one per shared shape
+static glmesh *atomMesh = NULL;
+static glmesh *bondMesh = NULL;
+
+// set m to the identity
+static void matIdentity(GLdouble m[16])
+{
+    for (int i = 0; i < 16; ++i)
+        m[i] = (i % 5 == 0) ? 1.0 : 0.0;
+}
+
+// m = m * b, as glMultMatrix
+static void matMultiply(GLdouble m[16], const GLdouble b[16])
+{
+    GLdouble r[16];
+
+    for (int c = 0; c < 4; ++c)
+        for (int row = 0; row < 4; ++row)
+            r[c * 4 + row] = m[row]      * b[c * 4]     + m[4 + row]  * b[c * 4 + 1] +
+                             m[8 + row]  * b[c * 4 + 2] + m[12 + row] * b[c * 4 + 3];
+
+    for (int i = 0; i < 16; ++i)
+        m[i] = r[i];
+}
+
+// apply a translation to m, as glTranslated
+static void matTranslate(GLdouble m[16], GLdouble x, GLdouble y, GLdouble z)
+{
+    GLdouble t[16];
+
+    matIdentity(t);
+    t[12] = x;  t[13] = y;  t[14] = z;
+    matMultiply(m, t);
+}
+
+// apply a rotation of deg degrees about x, y, z to m, as glRotated
+static void matRotate(GLdouble m[16], GLdouble deg, GLdouble x, GLdouble y, GLdouble z)
+{
+    GLdouble len = sqrt(x * x + y * y + z * z);
+    GLdouble r[16];
+
+    // like the GL, ignore a degenerate axis
+    if (len < 1.0e-4)
+        return;
+
+    x /= len;  y /= len;  z /= len;
+
+    GLdouble c = cos(deg * M_PI / 180.0);
+    GLdouble s = sin(deg * M_PI / 180.0);
+
+    matIdentity(r);
+    r[0] = x * x * (1 - c) + c;      r[4] = x * y * (1 - c) - z * s;  r[8]  = x * z * (1 - c) + y * s;
+    r[1] = y * x * (1 - c) + z * s;  r[5] = y * y * (1 - c) + c;      r[9]  = y * z * (1 - c) - x * s;
+    r[2] = x * z * (1 - c) - y * s;  r[6] = y * z * (1 - c) + x * s;  r[10] = z * z * (1 - c) + c;
+    matMultiply(m, r);
+}
+
+// append an instance to a list
+static helixinstance *addInstance(helixinstance **list, int *count, int *max)
+{
+    if (*count >= *max) {
+        *max  = (*max > 0) ? *max * 2 : 512;
+        *list = realloc(*list, *max * sizeof(helixinstance));
+        if (!*list) {
+            fprintf(stderr, "Error: Out of memory building double helix\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    helixinstance *inst = &(*list)[(*count)++];
+    matIdentity(inst->xform);
+    inst->material = genRandColor();
+    return inst;
+}
+
+// expand every instance of unit into one static buffer
+static glmesh *bakeInstances(const glmesh *unit, const helixinstance *list, int count)
 {
-    quadricHelix = gluNewQuadric();
-    gluQuadricOrientation(quadricHelix, GLU_OUTSIDE);
-    gluQuadricNormals(quadricHelix, GLU_SMOOTH);
+    glmesh *m = genMesh();
 
-    
+    for (int i = 0; i < count; ++i) {
+        meshSetColor(m, palette[list[i].material]);
+        meshAppend(m, unit, list[i].xform, list[i].scale);
+    }
+
+    meshUpload(m);
+    return m;
 }
 
+// map the molecule file and check its layout
+// the records are used in place, there is nothing to parse
+static bool mapHelixData(const char *filename)
+{
+    struct stat st;
+
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "Error: Could not open \"%s\"!\n", filename);
+        return false;
+    }
+
+    if (fstat(fd, &st) < 0 || (size_t)st.st_size < sizeof(helixheader)) {
+        fprintf(stderr, "Error: \"%s\" is not a molecule file!\n", filename);
+        close(fd);
+        return false;
+    }
+
+    void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        fprintf(stderr, "Error: Could not map \"%s\"!\n", filename);
+        return false;
+    }
+
+    const helixheader *header = data;
+    size_t expected = sizeof(helixheader) +
+                      (size_t)header->numAtoms * sizeof(helixatom) +
+                      (size_t)header->numBonds * sizeof(helixbond);
 
-// assign random material properties
-void genRandColor()
+    if (header->magic != HELIX_MAGIC || header->version != HELIX_VERSION ||
+        (size_t)st.st_size != expected) {
+        fprintf(stderr, "Error: \"%s\" is not a version %d molecule file!\n", filename, HELIX_VERSION);
+        munmap(data, st.st_size);
+        return false;
+    }
+
+    helixFile     = data;
+    helixFileSize = st.st_size;
+    helixHeader   = header;
+    helixAtoms    = (const helixatom *)(header + 1);
+    helixBonds    = (const helixbond *)(helixAtoms + header->numAtoms);
+    return true;
+}
+
+// add a sphere instance for atom a
+static void instanceAtom(const helixatom *a)
 {
-    GLfloat r = (GLfloat)(rand() % 10) / 10.0f;
-    GLfloat g = (GLfloat)(rand() % 10) / 10.0f;
-    GLfloat b = (GLfloat)(rand() % 10) / 10.0f;
+    helixinstance *inst = addInstance(&atoms, &numAtoms, &maxAtoms);
+
+    matTranslate(inst->xform, a->x, a->y, a->z);
+    inst->scale[0] = inst->scale[1] = inst->scale[2] = a->radius;
+}
 
-    GLfloat ambient[]  = { r, g, b, 0.75f };
-    GLfloat diffuse[]  = { r, g, b, 0.75f };
-    GLfloat specular[] = { 0.9f, 0.9f, 0.9f, 0.75f };
+// add a cylinder instance for bond b
+// centered at x, y, z, rotated angle radians about ax, ay, az
+static void instanceBond(const helixbond *b)
+{
+    helixinstance *inst = addInstance(&bonds, &numBonds, &maxBonds);
 
-    glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT,   ambient);
-    glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE,   diffuse);
-    glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR,  specular);
-    glMaterialf (GL_FRONT_AND_BACK, GL_SHININESS, 100.0f);
+    matTranslate(inst->xform, b->x, b->y, b->z);
+    matRotate(inst->xform, b->angle * (180.0 / M_PI), b->ax, b->ay, b->az); // Convert to degrees
+    matRotate(inst->xform, -90.0, 1.0, 0.0, 0.0);                             // Align cylinder
+    matTranslate(inst->xform, 0.0, 0.0, -b->length / 2.0);                    // Center it
+    inst->scale[0] = inst->scale[1] = b->radius;
+    inst->scale[2] = b->length;
 }
 
-// draw a sphere at tx, ty, tz, with radius rad
-void drawMolicule(GLdouble x, GLdouble y, GLdouble z, GLdouble radius)
+// fill the palette with every tenth step of red, green and blue
+static void genPalette()
 {
-    glPushMatrix();
-    glTranslated(x, y, z);
-    genRandColor();
-    gluSphere(quadricHelix, radius, MOLI_RES, MOLI_RES);
-    glPopMatrix();
+    for (int i = 0; i < HELIX_PALETTE_SIZE; ++i) {
+        palette[i][0] = (GLfloat)(i / 100)      / 10.0f;
+        palette[i][1] = (GLfloat)(i / 10 % 10)  / 10.0f;
+        palette[i][2] = (GLfloat)(i % 10)       / 10.0f;
+        palette[i][3] = 0.75f;
+    }
+
+    paletteReady = true;
 }
 
+// xorshift step of the private generator
+static GLuint nextColorRand()
+{
+    colorSeed ^= colorSeed << 13;
+    colorSeed ^= colorSeed >> 17;
+    colorSeed ^= colorSeed << 5;
+    return colorSeed;
+}
 
-// draw a cylinder at tx, ty, tz with rotation rr in radians about rx, ry, tz and radius rad and height h
-void drawBond(GLdouble tx, GLdouble ty, GLdouble tz,
-              GLdouble angleRad, GLdouble rx, GLdouble ry, GLdouble rz,
-              GLdouble radius, GLdouble height)
+// build the instance lists and bake them
+// the fixed-function pipeline has no per-instance attributes, so each
+// instance of the shared unit mesh is transformed once here and the
+// whole molecule is drawn as one buffer per shape
+void initDoubleHelix()
 {
-    glPushMatrix();
+    // drop buffers baked before
+    freeDoubleHelix();
+
+    // the file stays mapped so a new context can rebuild from it
+    if (helixFile == NULL && !mapHelixData(HELIX_DATA_FILE)) {
+        fprintf(stderr, "Sculpture 5 disabled.\n");
+        return;
+    }
+
+    // same colors every run
+    if (!paletteReady)
+        genPalette();
+    colorSeed = HELIX_COLOR_SEED;
 
-    glTranslated(tx, ty, tz);
-    glRotated(angleRad * (180.0 / M_PI), rx, ry, rz); // Convert to degrees
-    glRotated(-90.0, 1.0, 0.0, 0.0);                   // Align cylinder
-    glTranslated(0.0, 0.0, -height / 2.0);             // Center it
-    genRandColor();
-    gluCylinder(quadricHelix, radius, radius, height, BOND_RES, BOND_RES);
+    for (GLuint i = 0; i < helixHeader->numAtoms; ++i)
+        instanceAtom(&helixAtoms[i]);
+    for (GLuint i = 0; i < helixHeader->numBonds; ++i)
+        instanceBond(&helixBonds[i]);
 
-    glPopMatrix();
-} 
+    // shared unit shapes
+    glmesh *unitSphere   = genMesh();
+    glmesh *unitCylinder = genMesh();
+    tessSphere(unitSphere, 1.0, MOLI_RES, MOLI_RES);
+    tessCylinder(unitCylinder, 1.0, 1.0, 1.0, BOND_RES, BOND_RES);
+
+    atomMesh = bakeInstances(unitSphere, atoms, numAtoms);
+    bondMesh = bakeInstances(unitCylinder, bonds, numBonds);
+
+    meshFree(unitSphere);
+    meshFree(unitCylinder);
+}
+
+// release the baked buffers, while their context is current
+void freeDoubleHelix()
+{
+    meshFree(atomMesh);
+    meshFree(bondMesh);
+    atomMesh = NULL;
+    bondMesh = NULL;
+    numAtoms = 0;
+    numBonds = 0;
+}
+
+
+// pick a random palette entry
+GLuint genRandColor()
+{
+    return nextColorRand() % HELIX_PALETTE_SIZE;
+}
 
 // draw this tremendous double helix
 void drawDoubleHelix()
 {
-    // same colors
-    srand(779);
+    const GLfloat specular[] = { 0.9f, 0.9f, 0.9f, 0.75f };
+
+    // one material for the whole molecule, ambient and diffuse
+    // come from the palette colors baked into each vertex
+    glsMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR,  specular);
+    glsMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 100.0f);
+    glsColorMaterial(GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE);
+    glsEnable(GL_COLOR_MATERIAL);
 
-    // each call updated modelview
-    glMatrixMode(GL_MODELVIEW);
+    // the primitives are not sorted among themselves, so the helix
+    // keeps writing depth even when drawn with the translucent items
+    glsDepthMask(GL_TRUE);
 
-    // Atoms and NICS cubes
-    drawMolicule(-0.808, -8.873, -17.29, 0.23 );
-    drawMolicule(-0.196, -10.198, -17.07, 0.23 );
-    drawMolicule(-2.029, -8.583, -16.5, 0.23 );
-    drawMolicule(0.27, -7.725, -17.04, 0.23 );
-    drawMolicule(4.189, -7.682, -15.46, 0.23 );
-    drawMolicule(2.252, -5.41, -15.68, 0.23 );
-    drawMolicule(3.108, -4.88, -15.262, 0.23 );
-    drawMolicule(2.035, -6.74, -14.97, 0.23 );
-    drawMolicule(2.42, -6.732, -13.95, 0.23 );
-    drawMolicule(2.818, -7.701, -15.85, 0.23 );
-    drawMolicule(2.437, -8.72, -15.781, 0.23 );
-    drawMolicule(2.608, -7.128, -17.25, 0.23 );
-    drawMolicule(3.47, -7.426, -17.847, 0.23 );
-    drawMolicule(1.364, -7.578, -17.98, 0.23 );
-    drawMolicule(1.104, -6.836, -18.735, 0.23 );
-    drawMolicule(2.53, -5.682, -17.04, 0.23 );
-    drawMolicule(-1.645, -0.802, -15.35, 0.23 );
-    drawMolicule(-1.755, 0.217, -15.252, 0.23 );
-    drawMolicule(-2.476, -1.404, -15.44, 0.23 );
-    drawMolicule(-0.417, -1.347, -15.36, 0.23 );
-    drawMolicule(-0.191, -2.733, -15.49, 0.23 );
-    drawMolicule(-1.049, -3.808, -15.64, 0.23 );
-    drawMolicule(-0.253, -4.833, -15.71, 0.23 );
-    drawMolicule(-0.608, -5.858, -15.822, 0.23 );
-    drawMolicule(1.073, -4.504, -15.63, 0.23 );
-    drawMolicule(1.112, -3.139, -15.49, 0.23 );
-    drawMolicule(2.21, -2.37, -15.37, 0.23 );
-    drawMolicule(1.868, -1.105, -15.25, 0.23 );
-    drawMolicule(2.698, -0.407, -15.143, 0.23 );
-    drawMolicule(0.658, -0.554, -15.24, 0.23 );
-    drawMolicule(4.562, -7.653, -13.91, 0.23 );
-    drawMolicule(5.836, -8.366, -13.69, 0.23 );
-    drawMolicule(3.403, -8.136, -13.12, 0.23 );
-    drawMolicule(4.759, -6.091, -13.66, 0.23 );
-    drawMolicule(7.904, -3.753, -12.08, 0.23 );
-    drawMolicule(5.002, -3.053, -12.3, 0.23 );
-    drawMolicule(5.383, -2.121, -11.882, 0.23 );
-    drawMolicule(5.608, -4.257, -11.59, 0.23 );
-    drawMolicule(5.915, -4.024, -10.57, 0.23 );
-    drawMolicule(6.806, -4.574, -12.47, 0.23 );
-    drawMolicule(7.097, -5.622, -12.401, 0.23 );
-    drawMolicule(6.3, -4.234, -13.87, 0.23 );
-    drawMolicule(7.172, -3.968, -14.467, 0.23 );
-    drawMolicule(5.558, -5.329, -14.6, 0.23 );
-    drawMolicule(4.911, -4.882, -15.355, 0.23 );
-    drawMolicule(5.387, -3.11, -13.66, 0.23 );
-    drawMolicule(-0.508, -2.712, -12.1, 0.23 );
-    drawMolicule(-1.1, -3.551, -12.174, 0.23 );
-    drawMolicule(-0.94, -1.785, -11.987, 0.23 );
-    drawMolicule(0.81, -2.827, -12.15, 0.23 );
-    drawMolicule(1.548, -1.714, -12.05, 0.23 );
-    drawMolicule(2.902, -1.771, -12.1, 0.23 );
-    drawMolicule(3.611, -0.761, -12.01, 0.23 );
-    drawMolicule(3.515, -3.013, -12.25, 0.23 );
-    drawMolicule(2.775, -4.147, -12.35, 0.23 );
-    drawMolicule(3.281, -5.104, -12.473, 0.23 );
-    drawMolicule(1.416, -4.113, -12.3, 0.23 );
-    drawMolicule(0.819, -5.022, -12.371, 0.23 );
-    drawMolicule(8.189, -3.51, -10.53, 0.23 );
-    drawMolicule(9.638, -3.338, -10.31, 0.23 );
-    drawMolicule(7.536, -4.582, -9.74, 0.23 );
-    drawMolicule(7.43, -2.13, -10.28, 0.23 );
-    drawMolicule(8.6, 1.61, -8.7, 0.23 );
-    drawMolicule(5.841, 0.47, -8.92, 0.23 );
-    drawMolicule(5.602, 1.448, -8.502, 0.23 );
-    drawMolicule(7.039, -0.147, -8.21, 0.23 );
-    drawMolicule(7.15, 0.221, -7.19, 0.23 );
-    drawMolicule(8.195, 0.3, -9.09, 0.23 );
-    drawMolicule(9.046, -0.377, -9.021, 0.23 );
-    drawMolicule(7.585, 0.278, -10.49, 0.23 );
-    drawMolicule(8.134, 1.006, -11.087, 0.23 );
-    drawMolicule(7.629, -1.044, -11.22, 0.23 );
-    drawMolicule(6.843, -1.063, -11.975, 0.23 );
-    drawMolicule(6.186, 0.65, -10.28, 0.23 );
-    drawMolicule(0.254, -1.812, -8.59, 0.23 );
-    drawMolicule(-0.749, -1.602, -8.492, 0.23 );
-    drawMolicule(0.57, -2.789, -8.68, 0.23 );
-    drawMolicule(1.152, -0.813, -8.6, 0.23 );
-    drawMolicule(2.54, -1.026, -8.73, 0.23 );
-    drawMolicule(3.297, -2.174, -8.88, 0.23 );
-    drawMolicule(4.518, -1.734, -8.95, 0.23 );
-    drawMolicule(5.383, -2.388, -9.062, 0.23 );
-    drawMolicule(4.615, -0.371, -8.87, 0.23 );
-    drawMolicule(3.329, 0.088, -8.73, 0.23 );
-    drawMolicule(2.937, 1.369, -8.61, 0.23 );
-    drawMolicule(1.628, 1.435, -8.49, 0.23 );
-    drawMolicule(1.221, 2.44, -8.383, 0.23 );
-    drawMolicule(0.73, 0.455, -8.48, 0.23 );
-    drawMolicule(8.688, 1.973, -7.15, 0.23 );
-    drawMolicule(9.759, 2.965, -6.93, 0.23 );
-    drawMolicule(8.79, 0.723, -6.36, 0.23 );
-    drawMolicule(7.263, 2.644, -6.9, 0.23 );
-    drawMolicule(6.012, 6.358, -5.32, 0.23 );
-    drawMolicule(4.449, 3.814, -5.54, 0.23 );
-    drawMolicule(3.681, 4.464, -5.122, 0.23 );
-    drawMolicule(5.781, 4.018, -4.83, 0.23 );
-    drawMolicule(5.655, 4.382, -3.81, 0.23 );
-    drawMolicule(6.453, 5.06, -5.71, 0.23 );
-    drawMolicule(7.54, 5.013, -5.641, 0.23 );
-    drawMolicule(5.973, 4.683, -7.11, 0.23 );
-    drawMolicule(5.99, 5.595, -7.707, 0.23 );
-    drawMolicule(6.786, 3.639, -7.84, 0.23 );
-    drawMolicule(6.16, 3.162, -8.595, 0.23 );
-    drawMolicule(4.622, 4.162, -6.9, 0.23 );
-    drawMolicule(1.271, -1.317, -5.21, 0.23 );
-    drawMolicule(0.336, -1.736, -5.112, 0.23 );
-    drawMolicule(2.1, -1.921, -5.3, 0.23 );
-    drawMolicule(1.41, 0.02, -5.22, 0.23 );
-    drawMolicule(2.658, 0.663, -5.35, 0.23 );
-    drawMolicule(3.946, 0.179, -5.5, 0.23 );
-    drawMolicule(4.675, 1.253, -5.57, 0.23 );
-    drawMolicule(5.759, 1.232, -5.682, 0.23 );
-    drawMolicule(3.952, 2.412, -5.49, 0.23 );
-    drawMolicule(2.642, 2.028, -5.35, 0.23 );
-    drawMolicule(1.571, 2.834, -5.23, 0.23 );
-    drawMolicule(0.474, 2.118, -5.11, 0.23 );
-    drawMolicule(-0.447, 2.692, -5.003, 0.23 );
-    drawMolicule(0.324, 0.797, -5.1, 0.23 );
-    drawMolicule(5.869, 6.703, -3.77, 0.23 );
-    drawMolicule(6.153, 8.135, -3.55, 0.23 );
-    drawMolicule(6.686, 5.751, -2.98, 0.23 );
-    drawMolicule(4.322, 6.408, -3.52, 0.23 );
-    drawMolicule(1.126, 8.677, -1.94, 0.23 );
-    drawMolicule(1.358, 5.7, -2.16, 0.23 );
-    drawMolicule(0.354, 5.775, -1.742, 0.23 );
-    drawMolicule(2.315, 6.649, -1.45, 0.23 );
-    drawMolicule(1.999, 6.869, -0.43, 0.23 );
-    drawMolicule(2.247, 7.887, -2.33, 0.23 );
-    drawMolicule(3.154, 8.487, -2.261, 0.23 );
-    drawMolicule(2.08, 7.3, -3.73, 0.23 );
-    drawMolicule(1.557, 8.047, -4.327, 0.23 );
-    drawMolicule(3.351, 6.932, -4.46, 0.23 );
-    drawMolicule(3.125, 6.18, -5.215, 0.23 );
-    drawMolicule(1.293, 6.084, -3.52, 0.23 );
-    drawMolicule(-2.299, 1.943, -1.59, 0.23 );
-    drawMolicule(-2.894, 2.784, -1.583, 0.23 );
-    drawMolicule(-2.726, 1.01, -1.497, 0.23 );
-    drawMolicule(1.681, -0.315, -1.82, 0.23 );
-    drawMolicule(1.143, 0.792, -1.84, 0.23 );
-    drawMolicule(1.735, 2.068, -1.97, 0.23 );
-    drawMolicule(3.077, 2.43, -2.11, 0.23 );
-    drawMolicule(3.046, 3.735, -2.19, 0.23 );
-    drawMolicule(3.943, 4.343, -2.309, 0.23 );
-    drawMolicule(1.779, 4.275, -2.11, 0.23 );
-    drawMolicule(0.934, 3.196, -1.97, 0.23 );
-    drawMolicule(-0.418, 3.263, -1.85, 0.23 );
-    drawMolicule(-0.974, 2.061, -1.72, 0.23 );
-    drawMolicule(-0.255, 0.884, -1.72, 0.23 );
-    drawMolicule(-0.783, 0.005, -1.625, 0.23 );
-    drawMolicule(0.808, 8.873, -0.39, 0.23 );
-    drawMolicule(0.196, 10.198, -0.17, 0.23 );
-    drawMolicule(2.029, 8.583, 0.4, 0.23 );
-    drawMolicule(-0.27, 7.725, -0.14, 0.23 );
-    drawMolicule(-4.189, 7.682, 1.44, 0.23 );
-    drawMolicule(-2.252, 5.41, 1.22, 0.23 );
-    drawMolicule(-3.108, 4.88, 1.638, 0.23 );
-    drawMolicule(-2.035, 6.74, 1.93, 0.23 );
-    drawMolicule(-2.42, 6.732, 2.95, 0.23 );
-    drawMolicule(-2.818, 7.701, 1.05, 0.23 );
-    drawMolicule(-2.437, 8.72, 1.119, 0.23 );
-    drawMolicule(-2.608, 7.128, -0.35, 0.23 );
-    drawMolicule(-3.47, 7.426, -0.947, 0.23 );
-    drawMolicule(-1.364, 7.578, -1.08, 0.23 );
-    drawMolicule(-1.104, 6.836, -1.835, 0.23 );
-    drawMolicule(-2.53, 5.682, -0.14, 0.23 );
-    drawMolicule(1.645, 0.802, 1.55, 0.23 );
-    drawMolicule(1.755, -0.217, 1.648, 0.23 );
-    drawMolicule(2.476, 1.404, 1.46, 0.23 );
-    drawMolicule(0.417, 1.347, 1.54, 0.23 );
-    drawMolicule(0.191, 2.733, 1.41, 0.23 );
-    drawMolicule(1.049, 3.808, 1.26, 0.23 );
-    drawMolicule(0.253, 4.833, 1.19, 0.23 );
-    drawMolicule(0.608, 5.858, 1.078, 0.23 );
-    drawMolicule(-1.073, 4.504, 1.27, 0.23 );
-    drawMolicule(-1.112, 3.139, 1.41, 0.23 );
-    drawMolicule(-2.21, 2.37, 1.53, 0.23 );
-    drawMolicule(-1.868, 1.105, 1.65, 0.23 );
-    drawMolicule(-2.698, 0.407, 1.757, 0.23 );
-    drawMolicule(-0.658, 0.554, 1.66, 0.23 );
-    drawMolicule(-4.562, 7.653, 2.99, 0.23 );
-    drawMolicule(-5.836, 8.366, 3.21, 0.23 );
-    drawMolicule(-3.403, 8.136, 3.78, 0.23 );
-    drawMolicule(-4.759, 6.091, 3.24, 0.23 );
-    drawMolicule(-7.904, 3.753, 4.82, 0.23 );
-    drawMolicule(-5.002, 3.053, 4.6, 0.23 );
-    drawMolicule(-5.383, 2.121, 5.018, 0.23 );
-    drawMolicule(-5.608, 4.257, 5.31, 0.23 );
-    drawMolicule(-5.915, 4.024, 6.33, 0.23 );
-    drawMolicule(-6.806, 4.574, 4.43, 0.23 );
-    drawMolicule(-7.097, 5.622, 4.499, 0.23 );
-    drawMolicule(-6.3, 4.234, 3.03, 0.23 );
-    drawMolicule(-7.172, 3.968, 2.433, 0.23 );
-    drawMolicule(-5.558, 5.329, 2.3, 0.23 );
-    drawMolicule(-4.911, 4.882, 1.545, 0.23 );
-    drawMolicule(-5.387, 3.11, 3.24, 0.23 );
-    drawMolicule(0.859, 1.616, 4.93, 0.23 );
-    drawMolicule(1.548, 0.856, 5.028, 0.23 );
-    drawMolicule(1.178, 2.591, 4.84, 0.23 );
-    drawMolicule(-0.454, 1.335, 4.92, 0.23 );
-    drawMolicule(-1.452, 2.323, 4.79, 0.23 );
-    drawMolicule(-1.39, 3.697, 4.64, 0.23 );
-    drawMolicule(-2.636, 4.059, 4.57, 0.23 );
-    drawMolicule(-2.951, 5.096, 4.458, 0.23 );
-    drawMolicule(-3.515, 3.013, 4.65, 0.23 );
-    drawMolicule(-2.745, 1.886, 4.79, 0.23 );
-    drawMolicule(-3.181, 0.618, 4.91, 0.23 );
-    drawMolicule(-2.161, -0.204, 5.03, 0.23 );
-    drawMolicule(-2.422, -1.257, 5.137, 0.23 );
-    drawMolicule(-0.858, 0.061, 5.04, 0.23 );
-    drawMolicule(-8.189, 3.51, 6.37, 0.23 );
-    drawMolicule(-9.638, 3.338, 6.59, 0.23 );
-    drawMolicule(-7.536, 4.582, 7.16, 0.23 );
-    drawMolicule(-7.43, 2.13, 6.62, 0.23 );
-    drawMolicule(-8.6, -1.61, 8.2, 0.23 );
-    drawMolicule(-5.841, -0.47, 7.98, 0.23 );
-    drawMolicule(-5.602, -1.448, 8.398, 0.23 );
-    drawMolicule(-7.039, 0.147, 8.69, 0.23 );
-    drawMolicule(-7.15, -0.221, 9.71, 0.23 );
-    drawMolicule(-8.195, -0.3, 7.81, 0.23 );
-    drawMolicule(-9.046, 0.377, 7.879, 0.23 );
-    drawMolicule(-7.585, -0.278, 6.41, 0.23 );
-    drawMolicule(-8.134, -1.006, 5.813, 0.23 );
-    drawMolicule(-7.629, 1.044, 5.68, 0.23 );
-    drawMolicule(-6.843, 1.063, 4.925, 0.23 );
-    drawMolicule(-6.186, -0.65, 6.62, 0.23 );
-    drawMolicule(-1.184, 2.493, 8.18, 0.23 );
-    drawMolicule(-1.197, 3.52, 8.106, 0.23 );
-    drawMolicule(-0.288, 1.996, 8.293, 0.23 );
-    drawMolicule(-2.317, 1.811, 8.13, 0.23 );
-    drawMolicule(-2.26, 0.477, 8.23, 0.23 );
-    drawMolicule(-3.389, -0.273, 8.18, 0.23 );
-    drawMolicule(-3.369, -1.507, 8.27, 0.23 );
-    drawMolicule(-4.615, 0.371, 8.03, 0.23 );
-    drawMolicule(-4.683, 1.723, 7.93, 0.23 );
-    drawMolicule(-5.655, 2.201, 7.807, 0.23 );
-    drawMolicule(-3.563, 2.495, 7.98, 0.23 );
-    drawMolicule(-3.614, 3.582, 7.909, 0.23 );
-    drawMolicule(-8.688, -1.973, 9.75, 0.23 );
-    drawMolicule(-9.759, -2.965, 9.97, 0.23 );
-    drawMolicule(-8.79, -0.723, 10.54, 0.23 );
-    drawMolicule(-7.263, -2.644, 10.0, 0.23 );
-    drawMolicule(-6.012, -6.358, 11.58, 0.23 );
-    drawMolicule(-4.449, -3.814, 11.36, 0.23 );
-    drawMolicule(-3.681, -4.464, 11.778, 0.23 );
-    drawMolicule(-5.781, -4.018, 12.07, 0.23 );
-    drawMolicule(-5.655, -4.382, 13.09, 0.23 );
-    drawMolicule(-6.453, -5.06, 11.19, 0.23 );
-    drawMolicule(-7.54, -5.013, 11.259, 0.23 );
-    drawMolicule(-5.973, -4.683, 9.79, 0.23 );
-    drawMolicule(-5.99, -5.595, 9.193, 0.23 );
-    drawMolicule(-6.786, -3.639, 9.06, 0.23 );
-    drawMolicule(-6.16, -3.162, 8.305, 0.23 );
-    drawMolicule(-4.622, -4.162, 10.0, 0.23 );
-    drawMolicule(-2.483, 1.337, 11.56, 0.23 );
-    drawMolicule(-2.973, 0.203, 11.51, 0.23 );
-    drawMolicule(-2.176, -0.914, 11.6, 0.23 );
-    drawMolicule(-1.165, -0.753, 11.708, 0.23 );
-    drawMolicule(-2.593, -2.23, 11.56, 0.23 );
-    drawMolicule(-1.809, -3.159, 11.65, 0.23 );
-    drawMolicule(-3.952, -2.412, 11.41, 0.23 );
-    drawMolicule(-4.823, -1.356, 11.31, 0.23 );
-    drawMolicule(-5.889, -1.548, 11.188, 0.23 );
-    drawMolicule(-4.379, -0.084, 11.36, 0.23 );
-    drawMolicule(-5.286, 1.105, 11.25, 0.23 );
-    drawMolicule(-4.689, 2.015, 11.21, 0.23 );
-    drawMolicule(-5.869, -6.703, 13.13, 0.23 );
-    drawMolicule(-6.153, -8.135, 13.35, 0.23 );
-    drawMolicule(-6.686, -5.751, 13.92, 0.23 );
-    drawMolicule(-4.322, -6.408, 13.38, 0.23 );
-    drawMolicule(-1.126, -8.677, 14.96, 0.23 );
-    drawMolicule(-1.358, -5.7, 14.74, 0.23 );
-    drawMolicule(-0.354, -5.775, 15.158, 0.23 );
-    drawMolicule(-2.315, -6.649, 15.45, 0.23 );
-    drawMolicule(-1.999, -6.869, 16.47, 0.23 );
-    drawMolicule(-2.247, -7.887, 14.57, 0.23 );
-    drawMolicule(-3.154, -8.487, 14.639, 0.23 );
-    drawMolicule(-2.08, -7.3, 13.17, 0.23 );
-    drawMolicule(-1.557, -8.047, 12.573, 0.23 );
-    drawMolicule(-3.351, -6.932, 12.44, 0.23 );
-    drawMolicule(-3.125, -6.18, 11.685, 0.23 );
-    drawMolicule(-1.293, -6.084, 13.38, 0.23 );
-    drawMolicule(-1.802, 0.318, 15.07, 0.23 );
-    drawMolicule(-1.292, 1.208, 15.168, 0.23 );
-    drawMolicule(-2.828, 0.32, 14.98, 0.23 );
-    drawMolicule(-1.129, -0.845, 15.06, 0.23 );
-    drawMolicule(-1.761, -2.099, 14.93, 0.23 );
-    drawMolicule(-3.087, -2.464, 14.78, 0.23 );
-    drawMolicule(-3.045, -3.761, 14.71, 0.23 );
-    drawMolicule(-3.935, -4.382, 14.598, 0.23 );
-    drawMolicule(-1.779, -4.275, 14.79, 0.23 );
-    drawMolicule(-0.945, -3.193, 14.93, 0.23 );
-    drawMolicule(0.395, -3.216, 15.05, 0.23 );
-    drawMolicule(0.862, -1.992, 15.17, 0.23 );
-    drawMolicule(1.944, -1.915, 15.277, 0.23 );
-    drawMolicule(0.207, -0.835, 15.18, 0.23 );
-    drawMolicule(4.562, 7.653, 17.29, 0.23 );
-    drawMolicule(5.836, 8.366, 17.07, 0.23 );
-    drawMolicule(3.403, 8.136, 16.5, 0.23 );
-    drawMolicule(4.759, 6.091, 17.04, 0.23 );
-    drawMolicule(7.904, 3.753, 15.46, 0.23 );
-    drawMolicule(5.002, 3.053, 15.68, 0.23 );
-    drawMolicule(5.383, 2.121, 15.262, 0.23 );
-    drawMolicule(5.608, 4.257, 14.97, 0.23 );
-    drawMolicule(5.915, 4.024, 13.95, 0.23 );
-    drawMolicule(6.806, 4.574, 15.85, 0.23 );
-    drawMolicule(7.097, 5.622, 15.781, 0.23 );
-    drawMolicule(6.3, 4.234, 17.25, 0.23 );
-    drawMolicule(7.172, 3.968, 17.847, 0.23 );
-    drawMolicule(5.558, 5.329, 17.98, 0.23 );
-    drawMolicule(4.911, 4.882, 18.735, 0.23 );
-    drawMolicule(5.387, 3.11, 17.04, 0.23 );
-    drawMolicule(-0.505, 2.774, 15.48, 0.23 );
-    drawMolicule(0.726, 2.891, 15.53, 0.23 );
-    drawMolicule(1.542, 1.787, 15.44, 0.23 );
-    drawMolicule(1.076, 0.875, 15.332, 0.23 );
-    drawMolicule(2.922, 1.777, 15.48, 0.23 );
-    drawMolicule(3.563, 0.745, 15.39, 0.23 );
-    drawMolicule(3.515, 3.013, 15.63, 0.23 );
-    drawMolicule(2.78, 4.168, 15.73, 0.23 );
-    drawMolicule(3.292, 5.122, 15.852, 0.23 );
-    drawMolicule(1.434, 4.139, 15.68, 0.23 );
-    drawMolicule(0.583, 5.369, 15.79, 0.23 );
-    drawMolicule(1.221, 6.252, 15.804, 0.23 );
-    drawMolicule(8.189, 3.51, 13.91, 0.23 );
-    drawMolicule(9.638, 3.338, 13.69, 0.23 );
-    drawMolicule(7.536, 4.582, 13.12, 0.23 );
-    drawMolicule(7.43, 2.13, 13.66, 0.23 );
-    drawMolicule(8.6, -1.61, 12.08, 0.23 );
-    drawMolicule(5.841, -0.47, 12.3, 0.23 );
-    drawMolicule(5.602, -1.448, 11.882, 0.23 );
-    drawMolicule(7.039, 0.147, 11.59, 0.23 );
-    drawMolicule(7.15, -0.221, 10.57, 0.23 );
-    drawMolicule(8.195, -0.3, 12.47, 0.23 );
-    drawMolicule(9.046, 0.377, 12.401, 0.23 );
-    drawMolicule(7.585, -0.278, 13.87, 0.23 );
-    drawMolicule(8.134, -1.006, 14.467, 0.23 );
-    drawMolicule(7.629, 1.045, 14.6, 0.23 );
-    drawMolicule(6.843, 1.063, 15.355, 0.23 );
-    drawMolicule(6.186, -0.65, 13.66, 0.23 );
-    drawMolicule(0.254, 1.812, 11.97, 0.23 );
-    drawMolicule(-0.749, 1.602, 11.872, 0.23 );
-    drawMolicule(0.57, 2.789, 12.06, 0.23 );
-    drawMolicule(1.152, 0.813, 11.98, 0.23 );
-    drawMolicule(2.54, 1.026, 12.11, 0.23 );
-    drawMolicule(3.297, 2.174, 12.26, 0.23 );
-    drawMolicule(4.518, 1.734, 12.33, 0.23 );
-    drawMolicule(5.383, 2.388, 12.442, 0.23 );
-    drawMolicule(4.615, 0.371, 12.25, 0.23 );
-    drawMolicule(3.329, -0.088, 12.11, 0.23 );
-    drawMolicule(2.937, -1.369, 11.99, 0.23 );
-    drawMolicule(1.628, -1.435, 11.87, 0.23 );
-    drawMolicule(1.221, -2.44, 11.763, 0.23 );
-    drawMolicule(0.73, -0.455, 11.86, 0.23 );
-    drawMolicule(8.688, -1.973, 10.53, 0.23 );
-    drawMolicule(9.759, -2.965, 10.31, 0.23 );
-    drawMolicule(8.79, -0.723, 9.74, 0.23 );
-    drawMolicule(7.263, -2.644, 10.28, 0.23 );
-    drawMolicule(6.012, -6.358, 8.7, 0.23 );
-    drawMolicule(4.449, -3.814, 8.92, 0.23 );
-    drawMolicule(3.681, -4.464, 8.502, 0.23 );
-    drawMolicule(5.781, -4.018, 8.21, 0.23 );
-    drawMolicule(5.655, -4.382, 7.19, 0.23 );
-    drawMolicule(6.453, -5.06, 9.09, 0.23 );
-    drawMolicule(7.54, -5.012, 9.021, 0.23 );
-    drawMolicule(5.973, -4.683, 10.49, 0.23 );
-    drawMolicule(5.99, -5.595, 11.087, 0.23 );
-    drawMolicule(6.786, -3.639, 11.22, 0.23 );
-    drawMolicule(6.16, -3.162, 11.975, 0.23 );
-    drawMolicule(4.622, -4.162, 10.28, 0.23 );
-    drawMolicule(-0.718, -2.923, 8.35, 0.23 );
-    drawMolicule(-0.705, -3.953, 8.343, 0.23 );
-    drawMolicule(-1.612, -2.419, 8.257, 0.23 );
-    drawMolicule(1.175, 1.243, 8.58, 0.23 );
-    drawMolicule(1.39, 0.031, 8.6, 0.23 );
-    drawMolicule(2.619, -0.653, 8.73, 0.23 );
-    drawMolicule(3.917, -0.157, 8.87, 0.23 );
-    drawMolicule(4.66, -1.231, 8.95, 0.23 );
-    drawMolicule(5.742, -1.196, 9.069, 0.23 );
-    drawMolicule(3.952, -2.412, 8.87, 0.23 );
-    drawMolicule(2.635, -2.037, 8.73, 0.23 );
-    drawMolicule(1.58, -2.885, 8.61, 0.23 );
-    drawMolicule(0.423, -2.24, 8.48, 0.23 );
-    drawMolicule(0.313, -0.865, 8.48, 0.23 );
-    drawMolicule(-0.631, -0.464, 8.385, 0.23 );
-    drawMolicule(5.869, -6.703, 7.15, 0.23 );
-    drawMolicule(6.153, -8.135, 6.93, 0.23 );
-    drawMolicule(6.686, -5.751, 6.36, 0.23 );
-    drawMolicule(4.322, -6.408, 6.9, 0.23 );
-    drawMolicule(1.126, -8.677, 5.32, 0.23 );
-    drawMolicule(1.358, -5.7, 5.54, 0.23 );
-    drawMolicule(0.354, -5.775, 5.122, 0.23 );
-    drawMolicule(2.315, -6.649, 4.83, 0.23 );
-    drawMolicule(1.999, -6.869, 3.81, 0.23 );
-    drawMolicule(2.247, -7.887, 5.71, 0.23 );
-    drawMolicule(3.154, -8.487, 5.641, 0.23 );
-    drawMolicule(2.08, -7.3, 7.11, 0.23 );
-    drawMolicule(1.557, -8.047, 7.707, 0.23 );
-    drawMolicule(3.351, -6.932, 7.84, 0.23 );
-    drawMolicule(3.125, -6.18, 8.595, 0.23 );
-    drawMolicule(1.293, -6.084, 6.9, 0.23 );
-    drawMolicule(2.795, -0.377, 5.34, 0.23 );
-    drawMolicule(2.525, -1.583, 5.39, 0.23 );
-    drawMolicule(1.223, -2.019, 5.3, 0.23 );
-    drawMolicule(0.5, -1.293, 5.192, 0.23 );
-    drawMolicule(0.787, -3.328, 5.34, 0.23 );
-    drawMolicule(-0.393, -3.619, 5.25, 0.23 );
-    drawMolicule(1.779, -4.274, 5.49, 0.23 );
-    drawMolicule(3.105, -3.932, 5.59, 0.23 );
-    drawMolicule(3.854, -4.714, 5.712, 0.23 );
-    drawMolicule(3.493, -2.642, 5.54, 0.23 );
-    drawMolicule(4.926, -2.213, 5.65, 0.23 );
-    drawMolicule(5.569, -3.093, 5.664, 0.23 );
-    drawMolicule(0.808, -8.873, 3.77, 0.23 );
-    drawMolicule(0.196, -10.198, 3.55, 0.23 );
-    drawMolicule(2.029, -8.583, 2.98, 0.23 );
-    drawMolicule(-0.27, -7.725, 3.52, 0.23 );
-    drawMolicule(-4.189, -7.682, 1.94, 0.23 );
-    drawMolicule(-2.252, -5.41, 2.16, 0.23 );
-    drawMolicule(-3.108, -4.88, 1.742, 0.23 );
-    drawMolicule(-2.035, -6.74, 1.45, 0.23 );
-    drawMolicule(-2.42, -6.732, 0.43, 0.23 );
-    drawMolicule(-2.818, -7.701, 2.33, 0.23 );
-    drawMolicule(-2.437, -8.72, 2.261, 0.23 );
-    drawMolicule(-2.608, -7.128, 3.73, 0.23 );
-    drawMolicule(-3.47, -7.426, 4.327, 0.23 );
-    drawMolicule(-1.364, -7.578, 4.46, 0.23 );
-    drawMolicule(-1.104, -6.836, 5.215, 0.23 );
-    drawMolicule(-2.53, -5.682, 3.52, 0.23 );
-    drawMolicule(2.039, -1.948, 1.96, 0.23 );
-    drawMolicule(1.112, -2.765, 2.01, 0.23 );
-    drawMolicule(-0.197, -2.352, 1.92, 0.23 );
-    drawMolicule(-0.356, -1.34, 1.812, 0.23 );
-    drawMolicule(-1.32, -3.155, 1.96, 0.23 );
-    drawMolicule(-2.445, -2.697, 1.87, 0.23 );
-    drawMolicule(-1.073, -4.504, 2.11, 0.23 );
-    drawMolicule(0.201, -5.006, 2.21, 0.23 );
-    drawMolicule(0.347, -6.079, 2.332, 0.23 );
-    drawMolicule(1.273, -4.191, 2.16, 0.23 );
-    drawMolicule(2.684, -4.686, 2.27, 0.23 );
-    drawMolicule(2.687, -5.776, 2.284, 0.23 );
-    drawMolicule(-4.562, -7.653, 0.39, 0.23 );
-    drawMolicule(-5.836, -8.366, 0.17, 0.23 );
-    drawMolicule(-3.403, -8.136, -0.4, 0.23 );
-    drawMolicule(-4.759, -6.091, 0.14, 0.23 );
-    drawMolicule(-7.904, -3.753, -1.44, 0.23 );
-    drawMolicule(-5.002, -3.053, -1.22, 0.23 );
-    drawMolicule(-5.383, -2.121, -1.638, 0.23 );
-    drawMolicule(-5.608, -4.257, -1.93, 0.23 );
-    drawMolicule(-5.915, -4.024, -2.95, 0.23 );
-    drawMolicule(-6.806, -4.574, -1.05, 0.23 );
-    drawMolicule(-7.097, -5.622, -1.119, 0.23 );
-    drawMolicule(-6.3, -4.234, 0.35, 0.23 );
-    drawMolicule(-7.172, -3.968, 0.947, 0.23 );
-    drawMolicule(-5.558, -5.329, 1.08, 0.23 );
-    drawMolicule(-4.911, -4.882, 1.835, 0.23 );
-    drawMolicule(-5.387, -3.11, 0.14, 0.23 );
-    drawMolicule(0.508, -2.712, -1.42, 0.23 );
-    drawMolicule(1.1, -3.551, -1.346, 0.23 );
-    drawMolicule(0.94, -1.785, -1.533, 0.23 );
-    drawMolicule(-0.81, -2.827, -1.37, 0.23 );
-    drawMolicule(-1.548, -1.714, -1.47, 0.23 );
-    drawMolicule(-2.902, -1.771, -1.42, 0.23 );
-    drawMolicule(-3.611, -0.761, -1.51, 0.23 );
-    drawMolicule(-3.515, -3.013, -1.27, 0.23 );
-    drawMolicule(-2.775, -4.147, -1.17, 0.23 );
-    drawMolicule(-3.281, -5.104, -1.047, 0.23 );
-    drawMolicule(-1.416, -4.113, -1.22, 0.23 );
-    drawMolicule(-0.819, -5.022, -1.149, 0.23 );
-    drawMolicule(-8.189, -3.51, -2.99, 0.23 );
-    drawMolicule(-9.638, -3.338, -3.21, 0.23 );
-    drawMolicule(-7.536, -4.582, -3.78, 0.23 );
-    drawMolicule(-7.43, -2.13, -3.24, 0.23 );
-    drawMolicule(-8.6, 1.61, -4.82, 0.23 );
-    drawMolicule(-5.841, 0.47, -4.6, 0.23 );
-    drawMolicule(-5.602, 1.448, -5.018, 0.23 );
-    drawMolicule(-7.039, -0.147, -5.31, 0.23 );
-    drawMolicule(-7.15, 0.221, -6.33, 0.23 );
-    drawMolicule(-8.195, 0.3, -4.43, 0.23 );
-    drawMolicule(-9.046, -0.377, -4.499, 0.23 );
-    drawMolicule(-7.585, 0.278, -3.03, 0.23 );
-    drawMolicule(-8.134, 1.006, -2.433, 0.23 );
-    drawMolicule(-7.629, -1.044, -2.3, 0.23 );
-    drawMolicule(-6.843, -1.063, -1.545, 0.23 );
-    drawMolicule(-6.186, 0.65, -3.24, 0.23 );
-    drawMolicule(-1.223, -2.541, -4.8, 0.23 );
-    drawMolicule(-2.286, -1.912, -4.75, 0.23 );
-    drawMolicule(-2.298, -0.539, -4.84, 0.23 );
-    drawMolicule(-1.385, -0.076, -4.948, 0.23 );
-    drawMolicule(-3.408, 0.28, -4.8, 0.23 );
-    drawMolicule(-3.321, 1.492, -4.89, 0.23 );
-    drawMolicule(-4.615, -0.371, -4.65, 0.23 );
-    drawMolicule(-4.699, -1.738, -4.55, 0.23 );
-    drawMolicule(-5.674, -2.209, -4.428, 0.23 );
-    drawMolicule(-3.593, -2.506, -4.6, 0.23 );
-    drawMolicule(-3.627, -4.001, -4.49, 0.23 );
-    drawMolicule(-4.663, -4.341, -4.476, 0.23 );
-    drawMolicule(-8.688, 1.973, -6.37, 0.23 );
-    drawMolicule(-9.759, 2.965, -6.59, 0.23 );
-    drawMolicule(-8.79, 0.723, -7.16, 0.23 );
-    drawMolicule(-7.263, 2.644, -6.62, 0.23 );
-    drawMolicule(-6.012, 6.358, -8.2, 0.23 );
-    drawMolicule(-4.449, 3.814, -7.98, 0.23 );
-    drawMolicule(-3.681, 4.464, -8.398, 0.23 );
-    drawMolicule(-5.781, 4.018, -8.69, 0.23 );
-    drawMolicule(-5.655, 4.382, -9.71, 0.23 );
-    drawMolicule(-6.453, 5.06, -7.81, 0.23 );
-    drawMolicule(-7.54, 5.013, -7.879, 0.23 );
-    drawMolicule(-5.973, 4.683, -6.41, 0.23 );
-    drawMolicule(-5.99, 5.595, -5.813, 0.23 );
-    drawMolicule(-6.786, 3.639, -5.68, 0.23 );
-    drawMolicule(-6.16, 3.163, -4.925, 0.23 );
-    drawMolicule(-4.622, 4.162, -6.62, 0.23 );
-    drawMolicule(-2.483, -1.337, -8.18, 0.23 );
-    drawMolicule(-2.973, -0.203, -8.13, 0.23 );
-    drawMolicule(-2.176, 0.914, -8.22, 0.23 );
-    drawMolicule(-1.165, 0.753, -8.328, 0.23 );
-    drawMolicule(-2.593, 2.23, -8.18, 0.23 );
-    drawMolicule(-1.809, 3.159, -8.27, 0.23 );
-    drawMolicule(-3.952, 2.412, -8.03, 0.23 );
-    drawMolicule(-4.823, 1.356, -7.93, 0.23 );
-    drawMolicule(-5.889, 1.548, -7.808, 0.23 );
-    drawMolicule(-4.379, 0.084, -7.98, 0.23 );
-    drawMolicule(-5.286, -1.105, -7.87, 0.23 );
-    drawMolicule(-6.324, -0.771, -7.856, 0.23 );
-    drawMolicule(-5.869, 6.703, -9.75, 0.23 );
-    drawMolicule(-6.153, 8.135, -9.97, 0.23 );
-    drawMolicule(-6.686, 5.751, -10.54, 0.23 );
-    drawMolicule(-4.322, 6.408, -10.0, 0.23 );
-    drawMolicule(-1.126, 8.677, -11.58, 0.23 );
-    drawMolicule(-1.358, 5.7, -11.36, 0.23 );
-    drawMolicule(-0.354, 5.775, -11.778, 0.23 );
-    drawMolicule(-2.315, 6.649, -12.07, 0.23 );
-    drawMolicule(-1.999, 6.869, -13.09, 0.23 );
-    drawMolicule(-2.247, 7.887, -11.19, 0.23 );
-    drawMolicule(-3.154, 8.487, -11.259, 0.23 );
-    drawMolicule(-2.08, 7.3, -9.79, 0.23 );
-    drawMolicule(-1.557, 8.047, -9.193, 0.23 );
-    drawMolicule(-3.351, 6.932, -9.06, 0.23 );
-    drawMolicule(-3.125, 6.18, -8.305, 0.23 );
-    drawMolicule(-1.293, 6.084, -10.0, 0.23 );
-    drawMolicule(2.299, 1.943, -11.93, 0.23 );
-    drawMolicule(2.894, 2.784, -11.937, 0.23 );
-    drawMolicule(2.726, 1.01, -12.023, 0.23 );
-    drawMolicule(-1.681, -0.315, -11.7, 0.23 );
-    drawMolicule(-1.143, 0.792, -11.68, 0.23 );
-    drawMolicule(-1.735, 2.068, -11.55, 0.23 );
-    drawMolicule(-3.077, 2.43, -11.41, 0.23 );
-    drawMolicule(-3.046, 3.735, -11.33, 0.23 );
-    drawMolicule(-3.943, 4.343, -11.211, 0.23 );
-    drawMolicule(-1.779, 4.275, -11.41, 0.23 );
-    drawMolicule(-0.934, 3.196, -11.55, 0.23 );
-    drawMolicule(0.418, 3.263, -11.67, 0.23 );
-    drawMolicule(0.974, 2.061, -11.8, 0.23 );
-    drawMolicule(0.255, 0.884, -11.8, 0.23 );
-    drawMolicule(0.783, 0.005, -11.895, 0.23 );
-    drawMolicule(-0.808, 8.873, -13.13, 0.23 );
-    drawMolicule(-0.196, 10.198, -13.35, 0.23 );
-    drawMolicule(-2.029, 8.583, -13.92, 0.23 );
-    drawMolicule(0.27, 7.725, -13.38, 0.23 );
-    drawMolicule(4.189, 7.682, -14.96, 0.23 );
-    drawMolicule(2.252, 5.41, -14.74, 0.23 );
-    drawMolicule(3.108, 4.88, -15.158, 0.23 );
-    drawMolicule(2.035, 6.74, -15.45, 0.23 );
-    drawMolicule(2.42, 6.732, -16.47, 0.23 );
-    drawMolicule(2.818, 7.701, -14.57, 0.23 );
-    drawMolicule(2.437, 8.72, -14.639, 0.23 );
-    drawMolicule(2.608, 7.128, -13.17, 0.23 );
-    drawMolicule(3.47, 7.426, -12.573, 0.23 );
-    drawMolicule(1.364, 7.578, -12.44, 0.23 );
-    drawMolicule(1.104, 6.836, -11.685, 0.23 );
-    drawMolicule(2.53, 5.682, -13.38, 0.23 );
-    drawMolicule(-2.039, 1.948, -14.94, 0.23 );
-    drawMolicule(-1.112, 2.765, -14.89, 0.23 );
-    drawMolicule(0.197, 2.352, -14.98, 0.23 );
-    drawMolicule(0.356, 1.34, -15.088, 0.23 );
-    drawMolicule(1.32, 3.155, -14.94, 0.23 );
-    drawMolicule(2.445, 2.697, -15.03, 0.23 );
-    drawMolicule(1.073, 4.504, -14.79, 0.23 );
-    drawMolicule(-0.201, 5.006, -14.69, 0.23 );
-    drawMolicule(-0.347, 6.079, -14.568, 0.23 );
-    drawMolicule(-1.273, 4.191, -14.74, 0.23 );
-    drawMolicule(-2.684, 4.686, -14.63, 0.23 );
-    drawMolicule(-2.687, 5.776, -14.616, 0.23 );
+    meshDraw(atomMesh);
+    meshDraw(bondMesh);
 
-    // draw Bonds
-    drawBond( -0.5385, -8.586, -17.2275, 0.767041937893, 0.0996573818139, 0.0, -0.429722630381 , 0.17, 0.797259054511 );
-    drawBond( 0.0005, -8.012, -17.1025, 0.767041937893, 0.0996573818139, 0.0, -0.429722630381 , 0.17, 0.797259054511 );
-    drawBond( 0.5435, -7.68825, -17.275, 1.46923152124, -0.340713127315, 0.0, -0.396532086471 , 0.17, 0.724921547479 );
-    drawBond( 1.0905, -7.61475, -17.745, 1.46923152124, -0.340713127315, 0.0, -0.396532086471 , 0.17, 0.724921547479 );
-    drawBond( 1.986, -7.353, -17.615, 1.26837964835, 1.10298531014, 0.0, -1.87960784359 , 0.17, 1.51093878102 );
-    drawBond( 2.713, -7.4145, -16.55, 1.95539727544, 2.13812086656, 0.0, -0.320718129984 , 0.17, 1.5272291904 );
-    drawBond( 3.84625, -7.68675, -15.5575, 1.58412520835, -0.138988019762, 0.0, 0.488596346396 , 0.17, 0.712759075705 );
-    drawBond( 3.16075, -7.69625, -15.7525, 1.58412520835, -0.138988019762, 0.0, 0.488596346396 , 0.17, 0.712759075705 );
-    drawBond( 2.4265, -7.2205, -15.41, 0.886467117752, 1.33777656729, 0.0, 1.19031710476 , 0.17, 1.52020064465 );
-    drawBond( 2.3215, -5.478, -16.02, 1.76429283744, -0.480936940565, 0.0, -0.0983091687331 , 0.17, 0.707260206713 );
-    drawBond( 2.4605, -5.614, -16.7, 1.76429283744, -0.480936940565, 0.0, -0.0983091687331 , 0.17, 0.707260206713 );
-    drawBond( 2.1435, -6.075, -15.325, 2.63246704173, 1.08146052396, 0.0, 0.330530892536 , 0.17, 1.52318383657 );
-    drawBond( 1.95725, -5.1835, -15.6675, 0.916026795503, 0.0185967781148, 0.0, 0.438512027946 , 0.17, 0.743871124591 );
-    drawBond( 1.36775, -4.7305, -15.6425, 0.916026795503, 0.0185967781148, 0.0, 0.438512027946 , 0.17, 0.743871124591 );
-    drawBond( 2.5495, -6.0435, -17.0925, 2.98789208917, -0.076820614909, 0.0, -0.0285333712519 , 0.17, 0.731624903895 );
-    drawBond( 2.5885, -6.7665, -17.1975, 2.98789208917, -0.076820614909, 0.0, -0.0285333712519 , 0.17, 0.731624903895 );
-    drawBond( -0.655, -9.20425, -17.235, 2.68531296781, 0.0811798695798, 0.0, -0.225827637195 , 0.17, 0.737998814362 );
-    drawBond( -0.349, -9.86675, -17.125, 2.68531296781, 0.0811798695798, 0.0, -0.225827637195 , 0.17, 0.737998814362 );
-    drawBond( -1.11325, -8.8005, -17.0925, 1.37396728394, 0.292875985711, 0.0, 0.452660226017 , 0.17, 0.741458191674 );
-    drawBond( -1.72375, -8.6555, -16.6975, 1.37396728394, 0.292875985711, 0.0, 0.452660226017 , 0.17, 0.741458191674 );
-    drawBond( 0.9605, -0.69175, -15.2425, 1.99809565839, -0.00332396694478, 0.0, -0.402200000318 , 0.17, 0.664793388956 );
-    drawBond( 1.5655, -0.96725, -15.2475, 1.99809565839, -0.00332396694478, 0.0, -0.402200000318 , 0.17, 0.664793388956 );
-    drawBond( 1.95641807552, -1.41347295238, -15.3545386026, 2.86255268966, -0.0394769565696, 0.0, -0.112509326223 , 0.075, 0.65794927616 );
-    drawBond( 1.95058192448, -1.42902704762, -15.2054613974, 2.86255268966, -0.0394769565696, 0.0, -0.112509326223 , 0.075, 0.65794927616 );
-    drawBond( 2.12741807552, -2.04597295238, -15.4145386026, 2.86255268966, -0.0394769565696, 0.0, -0.112509326223 , 0.075, 0.65794927616 );
-    drawBond( 2.12158192448, -2.06152704762, -15.2654613974, 2.86255268966, -0.0394769565696, 0.0, -0.112509326223 , 0.075, 0.65794927616 );
-    drawBond( 1.9355, -2.56225, -15.4, 2.17898002595, -0.0403760882206, 0.0, 0.369441207219 , 0.17, 0.672934803677 );
-    drawBond( 1.3865, -2.94675, -15.46, 2.17898002595, -0.0403760882206, 0.0, 0.369441207219 , 0.17, 0.672934803677 );
-    drawBond( 0.457766804781, -2.94371179916, -15.4154476195, 1.2687419504, 0.0, 0.0, 1.77831815061 , 0.075, 1.36478752925 );
-    drawBond( 0.463233195219, -2.92828820084, -15.5645523805, 1.2687419504, 0.0, 0.0, 1.77831815061 , 0.075, 1.36478752925 );
-    drawBond( 1.10225, -3.48025, -15.525, 3.03552289548, -0.0480450189926, 0.0, 0.0133839695765 , 0.17, 0.68635741418 );
-    drawBond( 1.08275, -4.16275, -15.595, 3.03552289548, -0.0480450189926, 0.0, 0.0133839695765 , 0.17, 0.68635741418 );
-    drawBond( -0.304, -2.04, -15.425, 0.18593829272, 0.183340194175, 0.0, 0.318729876027 , 0.17, 1.41030918596 );
-    drawBond( -0.4055, -3.00175, -15.5275, 2.460636001, -0.0518841874394, 0.0, 0.296777552154 , 0.17, 0.691789165859 );
-    drawBond( -0.8345, -3.53925, -15.6025, 2.460636001, -0.0518841874394, 0.0, 0.296777552154 , 0.17, 0.691789165859 );
-    drawBond( -0.724, -1.21075, -15.3575, 1.15311331105, 0.00335885862311, 0.0, 0.412467838917 , 0.17, 0.671771724621 );
-    drawBond( -1.338, -0.93825, -15.3525, 1.15311331105, 0.0033588586231, 0.0, 0.412467838917 , 0.17, 0.671771724621 );
-    drawBond( 0.0785, -4.75075, -15.69, 1.32801717514, 0.0273709115668, 0.0, -0.45367285922 , 0.17, 0.684272789171 );
-    drawBond( 0.7415, -4.58625, -15.65, 1.32801717514, 0.0273709115668, 0.0, -0.45367285922 , 0.17, 0.684272789171 );
-    drawBond( -0.4492790372, -4.5692158794, -15.7670709968, 0.662166605382, 0.0227442175344, 0.0, 0.258634245105 , 0.075, 0.649834786696 );
-    drawBond( -0.4547209628, -4.5842841206, -15.6179290032, 0.662166605382, 0.0227442175344, 0.0, 0.258634245105 , 0.075, 0.649834786696 );
-    drawBond( -0.8472790372, -4.0567158794, -15.7320709968, 0.662166605382, 0.0227442175344, 0.0, 0.258634245105 , 0.075, 0.649834786696 );
-    drawBond( -0.8527209628, -4.0717841206, -15.5829290032, 0.662166605382, 0.0227442175344, 0.0, 0.258634245105 , 0.075, 0.649834786696 );
-    drawBond( 0.386479101889, -0.759734069709, -15.1954258055, 2.20340702223, -0.0402366325629, 0.0, 0.360453166709 , 0.075, 0.670610542715 );
-    drawBond( 0.392020898111, -0.744765930291, -15.3445741945, 2.20340702223, -0.0402366325629, 0.0, 0.360453166709 , 0.075, 0.670610542715 );
-    drawBond( -0.151020898111, -1.15623406971, -15.2554258055, 2.20340702223, -0.0402366325629, 0.0, 0.360453166709 , 0.075, 0.670610542715 );
-    drawBond( -0.145479101889, -1.14126593029, -15.4045741945, 2.20340702223, -0.0402366325629, 0.0, 0.360453166709 , 0.075, 0.670610542715 );
-    drawBond( 2.894, -5.0125, -15.3665, 2.07851542864, -0.113917462621, 0.0, 0.233285521539 , 0.17, 0.545059629765 );
-    drawBond( 2.466, -5.2775, -15.5755, 2.07851542864, -0.113917462621, 0.0, 0.233285521539 , 0.17, 0.545059629765 );
-    drawBond( 2.32375, -6.734, -14.205, 1.57813402359, -0.278018888252, 0.0, 0.104938501938 , 0.17, 0.545135075004 );
-    drawBond( 2.13125, -6.738, -14.715, 1.57813402359, -0.278018888252, 0.0, 0.104938501938 , 0.17, 0.545135075004 );
-    drawBond( 2.53225, -8.46525, -15.79825, 0.36312782174, -0.0188039479947, 0.0, -0.103830495449 , 0.17, 0.545041970861 );
-    drawBond( 2.72275, -7.95575, -15.83275, 0.36312782174, -0.0188039479947, 0.0, -0.103830495449 , 0.17, 0.545041970861 );
-    drawBond( 3.2545, -7.3515, -17.69775, 1.29389489222, 0.162693248384, 0.0, 0.234910519442 , 0.17, 0.545036007985 );
-    drawBond( 2.8235, -7.2025, -17.39925, 1.29389489222, 0.162693248384, 0.0, 0.234910519442 , 0.17, 0.545036007985 );
-    drawBond( 1.169, -7.0215, -18.54625, 2.31952562235, 0.205745205704, 0.0, -0.0708526536201 , 0.17, 0.545020412462 );
-    drawBond( 1.299, -7.3925, -18.16875, 2.31952562235, 0.205745205704, 0.0, -0.0708526536201 , 0.17, 0.545020412462 );
-    drawBond( -1.7275, -0.03775, -15.2765, 2.9980116884, -0.0252250672199, 0.0, -0.0283138509612 , 0.17, 0.514797290203 );
-    drawBond( -1.6725, -0.54725, -15.3255, 2.9980116884, -0.0252250672199, 0.0, -0.0283138509612 , 0.17, 0.514797290203 );
-    drawBond( -2.26825, -1.2535, -15.4175, 0.946630514219, 0.0231768021144, 0.0, -0.213999139523 , 0.17, 0.515040046987 );
-    drawBond( -1.85275, -0.9525, -15.3725, 0.946630514219, 0.0231768021144, 0.0, -0.213999139523 , 0.17, 0.515040046987 );
-    drawBond( -0.51925, -5.60175, -15.794, 0.348358460452, 0.030534048143, 0.0, -0.0967820275962 , 0.17, 0.545250859697 );
-    drawBond( -0.34175, -5.08925, -15.738, 0.348358460452, 0.030534048143, 0.0, -0.0967820275962 , 0.17, 0.545250859697 );
-    drawBond( 2.4905, -0.5815, -15.16975, 2.26596429037, -0.029150787186, 0.0, 0.226122928639 , 0.17, 0.544874526841 );
-    drawBond( 2.0755, -0.9305, -15.22325, 2.26596429037, -0.029150787186, 0.0, 0.226122928639 , 0.17, 0.544874526841 );
-    drawBond( 4.61125, -7.2625, -13.8475, 0.201019151813, 0.0996312145176, 0.0, -0.0785093970399 , 0.17, 0.797049716141 );
-    drawBond( 4.70975, -6.4815, -13.7225, 0.201019151813, 0.0996312145176, 0.0, -0.0785093970399 , 0.17, 0.797049716141 );
-    drawBond( 4.95875, -5.9005, -13.895, 1.0174946668, -0.340761749797, 0.0, -0.289647487328 , 0.17, 0.725024999569 );
-    drawBond( 5.35825, -5.5195, -14.365, 1.0174946668, -0.340761749797, 0.0, -0.289647487328 , 0.17, 0.725024999569 );
-    drawBond( 5.929, -4.7815, -14.235, 0.760072646544, 1.10287732233, 0.0, -1.12100681255 , 0.17, 1.5107908525 );
-    drawBond( 6.553, -4.404, -13.17, 1.79534177899, 2.13775736696, 0.0, -0.772646591202 , 0.17, 1.52696954783 );
-    drawBond( 7.6295, -3.95825, -12.1775, 2.18460067102, -0.138975810508, 0.0, 0.391270358814 , 0.17, 0.712696464142 );
-    drawBond( 7.0805, -4.36875, -12.3725, 2.18460067102, -0.138975810508, 0.0, 0.391270358814 , 0.17, 0.712696464142 );
-    drawBond( 6.207, -4.4155, -12.03, 1.36068734218, 1.33751112862, 0.0, 1.82083901374 , 0.17, 1.5198990098 );
-    drawBond( 5.09825, -3.06725, -12.64, 1.61110150756, -0.480961697436, 0.0, -0.136154598171 , 0.17, 0.707296613876 );
-    drawBond( 5.29075, -3.09575, -13.32, 1.61110150756, -0.480961697436, 0.0, -0.136154598171 , 0.17, 0.707296613876 );
-    drawBond( 5.305, -3.655, -11.945, 2.48209902354, 1.08166163989, 0.0, -0.923221061649 , 0.17, 1.52346709843 );
-    drawBond( 5.61525, -3.391, -13.7125, 2.44676342644, -0.076819628229, 0.0, -0.333982478919 , 0.17, 0.731615506943 );
-    drawBond( 6.07175, -3.953, -13.8175, 2.44676342644, -0.076819628229, 0.0, -0.333982478919 , 0.17, 0.731615506943 );
-    drawBond( 4.63025, -3.043, -12.2875, 1.54391819686, 0.0186047247024, 0.0, 0.553304512648 , 0.17, 0.744188988094 );
-    drawBond( 3.88675, -3.023, -12.2625, 1.54391819686, 0.0186047247024, 0.0, 0.553304512648 , 0.17, 0.744188988094 );
-    drawBond( 4.8805, -7.83125, -13.855, 2.07478453951, 0.0812036398507, 0.0, -0.470242896227 , 0.17, 0.738214907734 );
-    drawBond( 5.5175, -8.18775, -13.745, 2.07478453951, 0.0812036398507, 0.0, -0.470242896227 , 0.17, 0.738214907734 );
-    drawBond( 4.27225, -7.77375, -13.7125, 1.9024308881, 0.292984443593, 0.0, 0.429834139398 , 0.17, 0.74173276859 );
-    drawBond( 3.69275, -8.01525, -13.3175, 1.9024308881, 0.292984443593, 0.0, 0.429834139398 , 0.17, 0.74173276859 );
-    drawBond( 3.36175, -2.7025, -12.2125, 0.470122828671, 0.0522426684449, 0.0, 0.213498371712 , 0.17, 0.696568912599 );
-    drawBond( 3.05525, -2.0815, -12.1375, 0.470122828671, 0.0522426684449, 0.0, 0.213498371712 , 0.17, 0.696568912599 );
-    drawBond( 3.08151961442, -1.52653653525, -12.0029663602, 0.615817313884, 0.0278389745905, 0.0, -0.219309255385 , 0.075, 0.618643879789 );
-    drawBond( 3.07698038558, -1.51046346475, -12.1520336398, 0.615817313884, 0.0278389745905, 0.0, -0.219309255385 , 0.075, 0.618643879789 );
-    drawBond( 3.43601961442, -1.02153653525, -11.9579663602, 0.615817313884, 0.0278389745905, 0.0, -0.219309255385 , 0.075, 0.618643879789 );
-    drawBond( 3.43148038558, -1.00546346475, -12.1070336398, 0.615817313884, 0.0278389745905, 0.0, -0.219309255385 , 0.075, 0.618643879789 );
-    drawBond( 2.5635, -1.75675, -12.0875, 1.52875230292, 0.0169515163407, 0.0, 0.459047062507 , 0.17, 0.678060653629 );
-    drawBond( 1.8865, -1.72825, -12.0625, 1.52875230292, 0.0169515163407, 0.0, 0.459047062507 , 0.17, 0.678060653629 );
-    drawBond( 1.36563445119, -2.00006903764, -12.0004392383, 2.55188501414, -0.0334795926648, 0.0, 0.247079393866 , 0.075, 0.669591853296 );
-    drawBond( 1.36136554881, -1.98443096236, -12.1495607617, 2.55188501414, -0.0334795926648, 0.0, 0.247079393866 , 0.075, 0.669591853296 );
-    drawBond( 0.996634451189, -2.55656903764, -12.0504392383, 2.55188501414, -0.0334795926648, 0.0, 0.247079393866 , 0.075, 0.669591853296 );
-    drawBond( 0.992365548811, -2.54093096236, -12.1995607617, 2.55188501414, -0.0334795926648, 0.0, 0.247079393866 , 0.075, 0.669591853296 );
-    drawBond( 0.4805, -2.79825, -12.1375, 1.48382557584, 0.0165494004801, 0.0, 0.436242196655 , 0.17, 0.661976019203 );
-    drawBond( -0.1785, -2.74075, -12.1125, 1.48382557584, 0.0165494004801, 0.0, 0.436242196655 , 0.17, 0.661976019203 );
-    drawBond( 1.113, -3.47, -12.225, 2.68965284303, -0.214428239745, 0.0, -0.86629008857 , 0.17, 1.4295215983 );
-    drawBond( 2.09799939747, -4.13784521414, -12.2504533331, 1.59579259967, -0.068017222084, 0.0, -1.84870809624 , 0.075, 1.36034444168 );
-    drawBond( 2.09300060253, -4.12215478586, -12.3995466669, 1.59579259967, -0.068017222084, 0.0, -1.84870809624 , 0.075, 1.36034444168 );
-    drawBond( 2.96, -3.8635, -12.325, 0.582319546287, 0.0339444030733, 0.0, -0.251188582742 , 0.17, 0.678888061465 );
-    drawBond( 3.33, -3.2965, -12.275, 0.582319546287, 0.0339444030733, 0.0, -0.251188582742 , 0.17, 0.678888061465 );
-    drawBond( 5.28775, -2.354, -11.9865, 2.59615194417, -0.113924604047, 0.0, 0.103840368761 , 0.17, 0.545093799268 );
-    drawBond( 5.09725, -2.82, -12.1955, 2.59615194417, -0.113924604047, 0.0, 0.103840368761 , 0.17, 0.545093799268 );
-    drawBond( 5.83825, -4.08225, -10.825, 1.78614301513, -0.278048005657, 0.0, 0.0836869977811 , 0.17, 0.545192167955 );
-    drawBond( 5.68475, -4.19875, -11.335, 1.78614301513, -0.278048005657, 0.0, 0.0836869977811 , 0.17, 0.545192167955 );
-    drawBond( 7.02425, -5.36, -12.41825, 0.277982028772, -0.0187996986445, 0.0, 0.0792856855878 , 0.17, 0.544918801291 );
-    drawBond( 6.87875, -4.836, -12.45275, 0.277982028772, -0.0187996986445, 0.0, 0.0792856855878 , 0.17, 0.544918801291 );
-    drawBond( 6.954, -4.0345, -14.31775, 1.8173809326, 0.162644772346, 0.0, 0.23756489361 , 0.17, 0.544873609198 );
-    drawBond( 6.518, -4.1675, -14.01925, 1.8173809326, 0.162644772346, 0.0, 0.23756489361 , 0.17, 0.544873609198 );
-    drawBond( 5.07275, -4.99375, -15.16625, 1.99328608763, 0.205767195678, 0.0, -0.17633294782 , 0.17, 0.545078664048 );
-    drawBond( 5.39625, -5.21725, -14.78875, 1.99328608763, 0.205767195678, 0.0, -0.17633294782 , 0.17, 0.545078664048 );
-    drawBond( -0.952, -3.34125, -12.1555, 0.618132234009, 0.0190456668891, 0.0, -0.152365335113 , 0.17, 0.514747753759 );
-    drawBond( -0.656, -2.92175, -12.1185, 0.618132234009, 0.0190456668891, 0.0, -0.152365335113 , 0.17, 0.514747753759 );
-    drawBond( -0.832, -2.01675, -12.01525, 2.69269321486, -0.0290676164507, 0.0, -0.111125754927 , 0.17, 0.514471087623 );
-    drawBond( -0.616, -2.48025, -12.07175, 2.69269321486, -0.0290676164507, 0.0, -0.111125754927 , 0.17, 0.514471087623 );
-    drawBond( 3.1545, -4.86475, -12.44225, 0.498327459678, 0.0335021779199, 0.0, 0.137821967703 , 0.17, 0.544750860486 );
-    drawBond( 2.9015, -4.38625, -12.38075, 0.498327459678, 0.0335021779199, 0.0, 0.137821967703 , 0.17, 0.544750860486 );
-    drawBond( 0.96825, -4.79475, -12.35325, 0.58434338673, 0.0193444952942, 0.0, -0.162657235079 , 0.17, 0.5449153604 );
-    drawBond( 1.26675, -4.34025, -12.31775, 0.58434338673, 0.0193444952942, 0.0, -0.162657235079 , 0.17, 0.5449153604 );
-    drawBond( 7.99925, -3.165, -10.4675, 0.524885460395, 0.0996670433556, 0.0, 0.302589143628 , 0.17, 0.797336346845 );
-    drawBond( 7.61975, -2.475, -10.3425, 0.524885460395, 0.0996670433556, 0.0, 0.302589143628 , 0.17, 0.797336346845 );
-    drawBond( 7.47975, -1.8585, -10.515, 0.724322927904, -0.340757860254, 0.0, -0.0721391640325 , 0.17, 0.725016723945 );
-    drawBond( 7.57925, -1.3155, -10.985, 0.724322927904, -0.340757860254, 0.0, -0.0721391640325 , 0.17, 0.725016723945 );
-    drawBond( 7.607, -0.383, -10.855, 0.505293475727, 1.10288481175, 0.0, 0.0664752489276 , 0.17, 1.51080111199 );
-    drawBond( 7.89, 0.289, -9.79, 1.55639113467, 2.13819190907, 0.0, -0.931640760381 , 0.17, 1.52727993505 );
-    drawBond( 8.49875, 1.2825, -8.7975, 2.73617127875, -0.138992226064, 0.0, 0.144338080913 , 0.17, 0.712780646482 );
-    drawBond( 8.29625, 0.6275, -8.9925, 2.73617127875, -0.138992226064, 0.0, 0.144338080913 , 0.17, 0.712780646482 );
-    drawBond( 7.617, 0.0765, -8.65, 1.86927838299, 1.33764197303, 0.0, 1.75717513729 , 0.17, 1.52004769662 );
-    drawBond( 5.92725, 0.515, -9.26, 1.44320379266, -0.480955808781, 0.0, -0.12200717208 , 0.17, 0.707287954089 );
-    drawBond( 6.09975, 0.605, -9.94, 1.44320379266, -0.480955808781, 0.0, -0.12200717208 , 0.17, 0.707287954089 );
-    drawBond( 6.44, 0.1615, -8.565, 1.98786370231, 1.08143814955, 0.0, -1.82473648333 , 0.17, 1.52315232331 );
-    drawBond( 5.5345, 0.25975, -8.9075, 2.17165687483, 0.0185945934683, 0.0, 0.455939431842 , 0.17, 0.743783738731 );
-    drawBond( 4.9215, -0.16075, -8.8825, 2.17165687483, 0.0185945934683, 0.0, 0.455939431842 , 0.17, 0.743783738731 );
-    drawBond( 6.53575, 0.557, -10.3325, 1.82793328019, -0.0767952262921, 0.0, -0.511602483727 , 0.17, 0.731383107544 );
-    drawBond( 7.23525, 0.371, -10.4375, 1.82793328019, -0.0767952262921, 0.0, -0.511602483727 , 0.17, 0.731383107544 );
-    drawBond( 8.55125, -3.467, -10.475, 1.45397310222, 0.0811615341464, 0.0, -0.534559377174 , 0.17, 0.737832128604 );
-    drawBond( 9.27575, -3.381, -10.365, 1.45397310222, 0.0811615341464, 0.0, -0.534559377174 , 0.17, 0.737832128604 );
-    drawBond( 8.02575, -3.778, -10.3325, 2.37863128564, 0.292919400316, 0.0, 0.242121985324 , 0.17, 0.741568102065 );
-    drawBond( 7.69925, -4.314, -9.9375, 2.37863128564, 0.292919400316, 0.0, 0.242121985324 , 0.17, 0.741568102065 );
-    drawBond( 0.9545, 0.7, -8.4825, 0.741793290054, -0.00332312353066, 0.0, -0.298416493053 , 0.17, 0.664624706131 );
-    drawBond( 1.4035, 1.19, -8.4875, 0.741793290054, -0.00332312353066, 0.0, -0.298416493053 , 0.17, 0.664624706131 );
-    drawBond( 1.96174328201, 1.41331853773, -8.44546148863, 1.62096382756, -0.0394843424663, 0.0, -0.43070836907 , 0.075, 0.658072374439 );
-    drawBond( 1.94875671799, 1.42368146227, -8.59453851137, 1.62096382756, -0.0394843424663, 0.0, -0.43070836907 , 0.075, 0.658072374439 );
-    drawBond( 2.61624328201, 1.38031853773, -8.50546148863, 1.62096382756, -0.0394843424663, 0.0, -0.43070836907 , 0.075, 0.658072374439 );
-    drawBond( 2.60325671799, 1.39068146227, -8.65453851137, 1.62096382756, -0.0394843424663, 0.0, -0.43070836907 , 0.075, 0.658072374439 );
-    drawBond( 3.035, 1.04875, -8.64, 2.83186414923, -0.04035, 0.0, -0.13181 , 0.17, 0.6725 );
-    drawBond( 3.231, 0.40825, -8.7, 2.83186414923, -0.04035, 0.0, -0.13181 , 0.17, 0.6725 );
-    drawBond( 2.92800938346, -0.464015516275, -8.80455218327, 2.52534553063, 0.0, 0.0, 1.07706938791 , 0.075, 1.36510695552 );
-    drawBond( 2.94099061654, -0.473984483725, -8.65544781673, 2.52534553063, 0.0, 0.0, 1.07706938791 , 0.075, 1.36510695552 );
-    drawBond( 3.6505, -0.02675, -8.765, 1.91176245848, -0.0480415895345, 0.0, -0.441296315295 , 0.17, 0.686308421921 );
-    drawBond( 4.2935, -0.25625, -8.835, 1.91176245848, -0.0480415895345, 0.0, -0.441296315295 , 0.17, 0.686308421921 );
-    drawBond( 1.846, -0.9195, -8.665, 1.41917935762, 0.183332865847, 0.0, 1.95743090612 , 0.17, 1.41025281421 );
-    drawBond( 2.72925, -1.313, -8.7675, 2.54974949095, -0.0518728568834, 0.0, -0.261785017738 , 0.17, 0.691638091779 );
-    drawBond( 3.10775, -1.887, -8.8425, 2.54974949095, -0.0518728568834, 0.0, -0.261785017738 , 0.17, 0.691638091779 );
-    drawBond( 0.9275, -1.06275, -8.5975, 2.40935540338, 0.00335829662925, 0.0, 0.301575037306 , 0.17, 0.671659325849 );
-    drawBond( 0.4785, -1.56225, -8.5925, 2.40935540338, 0.00335829662925, 0.0, 0.301575037306 , 0.17, 0.671659325849 );
-    drawBond( 4.54225, -1.39325, -8.93, 0.0919875309771, 0.0273757410858, 0.0, -0.0331930860666 , 0.17, 0.684393527146 );
-    drawBond( 4.59075, -0.71175, -8.89, 0.0919875309771, 0.0273757410858, 0.0, -0.0331930860666 , 0.17, 0.684393527146 );
-    drawBond( 4.21907459311, -1.84891721845, -8.85792908962, 1.91614793667, 0.0227455639906, 0.0, 0.396747623322 , 0.075, 0.649873256874 );
-    drawBond( 4.20642540689, -1.83908278155, -9.00707091038, 1.91614793667, 0.0227455639906, 0.0, 0.396747623322 , 0.075, 0.649873256874 );
-    drawBond( 3.60857459311, -2.06891721845, -8.82292908962, 1.91614793667, 0.0227455639906, 0.0, 0.396747623322 , 0.075, 0.649873256874 );
-    drawBond( 3.59592540689, -2.05908278155, -8.97207091038, 1.91614793667, 0.0227455639906, 0.0, 0.396747623322 , 0.075, 0.649873256874 );
-    drawBond( 0.829239262619, 0.142948541056, -8.58457422167, 2.80848434513, -0.0402526669924, 0.0, -0.141555212256 , 0.075, 0.670877783206 );
-    drawBond( 0.841760737381, 0.133051458944, -8.43542577833, 2.80848434513, -0.0402526669924, 0.0, -0.141555212256 , 0.075, 0.670877783206 );
-    drawBond( 1.04023926262, -0.491051458944, -8.64457422167, 2.80848434513, -0.0402526669924, 0.0, -0.141555212256 , 0.075, 0.670877783206 );
-    drawBond( 1.05276073738, -0.500948541056, -8.49542577833, 2.80848434513, -0.0402526669924, 0.0, -0.141555212256 , 0.075, 0.670877783206 );
-    drawBond( 5.66175, 1.2035, -8.6065, 2.68409646285, -0.113915976765, 0.0, -0.0651337761884 , 0.17, 0.545052520405 );
-    drawBond( 5.78125, 0.7145, -8.8155, 2.68409646285, -0.113915976765, 0.0, -0.0651337761884 , 0.17, 0.545052520405 );
-    drawBond( 7.12225, 0.129, -7.445, 1.91517116354, -0.277955263712, 0.0, 0.0302480728157 , 0.17, 0.545010321003 );
-    drawBond( 7.06675, -0.055, -7.955, 1.91517116354, -0.277955263712, 0.0, 0.0302480728157 , 0.17, 0.545010321003 );
-    drawBond( 8.83325, -0.20775, -9.03825, 0.900379711505, -0.0187960974191, 0.0, 0.231818534835 , 0.17, 0.544814417944 );
-    drawBond( 8.40775, 0.13075, -9.07275, 0.900379711505, -0.0187960974191, 0.0, 0.231818534835 , 0.17, 0.544814417944 );
-    drawBond( 7.99675, 0.824, -10.93775, 2.30228193212, 0.16266154888, 0.0, 0.149583233392 , 0.17, 0.544929811994 );
-    drawBond( 7.72225, 0.46, -10.63925, 2.30228193212, 0.16266154888, 0.0, 0.149583233392 , 0.17, 0.544929811994 );
-    drawBond( 7.0395, -1.05825, -11.78625, 1.55336485287, 0.205744599648, 0.0, -0.214192391157 , 0.17, 0.545018807015 );
-    drawBond( 7.4325, -1.04875, -11.40875, 1.55336485287, 0.205744599648, 0.0, -0.214192391157 , 0.17, 0.545018807015 );
-    drawBond( -0.49825, -1.6545, -8.5165, 1.77623604345, -0.025220878816, 0.0, -0.258127974004 , 0.17, 0.514711812571 );
-    drawBond( 0.00325, -1.7595, -8.5655, 1.77623604345, -0.025220878816, 0.0, -0.258127974004 , 0.17, 0.514711812571 );
-    drawBond( 0.491, -2.54475, -8.6575, 0.324419538314, 0.023192305432, 0.0, 0.0814307612945 , 0.17, 0.515384565155 );
-    drawBond( 0.333, -2.05625, -8.6125, 0.324419538314, 0.023192305432, 0.0, 0.0814307612945 , 0.17, 0.515384565155 );
-    drawBond( 5.16675, -2.2245, -9.034, 0.927416700492, 0.0305249445536, 0.0, 0.235750687847 , 0.17, 0.5450882956 );
-    drawBond( 4.73425, -1.8975, -8.978, 0.927416700492, 0.0305249445536, 0.0, 0.235750687847 , 0.17, 0.5450882956 );
-    drawBond( 1.32275, 2.18875, -8.40975, 2.74503922856, -0.029145509117, 0.0, -0.110861889819 , 0.17, 0.544775871345 );
-    drawBond( 1.52625, 1.68625, -8.46325, 2.74503922856, -0.029145509117, 0.0, -0.110861889819 , 0.17, 0.544775871345 );
-    drawBond( 8.33175, 2.14075, -7.0875, 1.13653086931, 0.0996745877218, 0.0, 0.568145150014 , 0.17, 0.797396701774 );
-    drawBond( 7.61925, 2.47625, -6.9625, 1.13653086931, 0.0996745877218, 0.0, 0.568145150014 , 0.17, 0.797396701774 );
-    drawBond( 7.14375, 2.89275, -7.135, 0.81423259246, -0.340640910124, 0.0, 0.172857142691 , 0.17, 0.724767893881 );
-    drawBond( 6.90525, 3.39025, -7.605, 0.81423259246, -0.340640910124, 0.0, 0.172857142691 , 0.17, 0.724767893881 );
-    drawBond( 6.3795, 4.161, -7.475, 0.808160375672, 1.10319521595, 0.0, 1.22862700078 , 0.17, 1.51122632322 );
-    drawBond( 6.213, 4.8715, -6.41, 1.32137113112, 2.1381667007, 0.0, -0.733085725954 , 0.17, 1.52726192907 );
-    drawBond( 6.12225, 6.0335, -5.4175, 2.71578829441, -0.138963497568, 0.0, -0.15713564725 , 0.17, 0.71263332086 );
-    drawBond( 6.34275, 5.3845, -5.6125, 2.71578829441, -0.138963497568, 0.0, -0.15713564725 , 0.17, 0.71263332086 );
-    drawBond( 6.117, 4.539, -5.27, 2.32584816293, 1.33799015362, 0.0, 1.02173793549 , 0.17, 1.52044335639 );
-    drawBond( 4.49225, 3.901, -5.88, 1.32220975131, -0.480908696948, 0.0, -0.0611744151264 , 0.17, 0.707218671982 );
-    drawBond( 4.57875, 4.075, -6.56, 1.32220975131, -0.480908696948, 0.0, -0.0611744151264 , 0.17, 0.707218671982 );
-    drawBond( 5.115, 3.916, -5.185, 1.43645833834, 1.08142579681, 0.0, -2.02881572021 , 0.17, 1.52313492508 );
-    drawBond( 4.32475, 3.4635, -5.5275, 2.79933151364, 0.0186040696153, 0.0, 0.184924451976 , 0.17, 0.744162784611 );
-    drawBond( 4.07625, 2.7625, -5.5025, 2.79933151364, 0.0186040696153, 0.0, 0.184924451976 , 0.17, 0.744162784611 );
-    drawBond( 4.95975, 4.29225, -6.9525, 1.20671976101, -0.0768141922922, 0.0, -0.494171303746 , 0.17, 0.731563736116 );
-    drawBond( 5.63525, 4.55275, -7.0575, 1.20671976101, -0.0768141922922, 0.0, -0.494171303746 , 0.17, 0.731563736116 );
-    drawBond( 8.95575, 2.221, -7.095, 0.833966479396, 0.0811973067595, 0.0, -0.395283252452 , 0.17, 0.738157334177 );
-    drawBond( 9.49125, 2.717, -6.985, 0.833966479396, 0.0811973067595, 0.0, -0.395283252452 , 0.17, 0.738157334177 );
-    drawBond( 8.7135, 1.6605, -6.9525, 2.57423559847, 0.292740306885, 0.0, -0.0377968497497 , 0.17, 0.741114700974 );
-    drawBond( 8.7645, 1.0355, -6.5575, 2.57423559847, 0.292740306885, 0.0, -0.0377968497497 , 0.17, 0.741114700974 );
-    drawBond( 0.3615, 1.12725, -5.1025, 0.113314893224, -0.0033238165187, 0.0, -0.0498572477806 , 0.17, 0.664763303741 );
-    drawBond( 0.4365, 1.78775, -5.1075, 0.113314893224, -0.0033238165187, 0.0, -0.0498572477806 , 0.17, 0.664763303741 );
-    drawBond( 0.756547352031, 2.29663078719, -5.06546130101, 0.995251915864, -0.0394641419519, 0.0, -0.36076803101 , 0.075, 0.657735699198 );
-    drawBond( 0.739952647969, 2.29736921281, -5.21453869899, 0.995251915864, -0.0394641419519, 0.0, -0.36076803101 , 0.075, 0.657735699198 );
-    drawBond( 1.30504735203, 2.65463078719, -5.12546130101, 0.995251915864, -0.0394641419519, 0.0, -0.36076803101 , 0.075, 0.657735699198 );
-    drawBond( 1.28845264797, 2.65536921281, -5.27453869899, 0.995251915864, -0.0394641419519, 0.0, -0.36076803101 , 0.075, 0.657735699198 );
-    drawBond( 1.83875, 2.6325, -5.26, 2.21294427471, -0.0403728782724, 0.0, -0.360327938581 , 0.17, 0.67288130454 );
-    drawBond( 2.37425, 2.2295, -5.32, 2.21294427471, -0.0403728782724, 0.0, -0.360327938581 , 0.17, 0.67288130454 );
-    drawBond( 2.64182142429, 1.34571627689, -5.42455241896, 3.12987157866, 0.0, 0.0, -0.0218415003147 , 0.075, 1.36509376967 );
-    drawBond( 2.65817857571, 1.34528372311, -5.27544758104, 3.12987157866, 0.0, 0.0, -0.0218415003147 , 0.075, 1.36509376967 );
-    drawBond( 2.9695, 2.124, -5.385, 1.28718345558, -0.0480298459294, 0.0, -0.449422129768 , 0.17, 0.686140656134 );
-    drawBond( 3.6245, 2.316, -5.455, 1.28718345558, -0.0480298459294, 0.0, -0.449422129768 , 0.17, 0.686140656134 );
-    drawBond( 2.034, 0.3415, -5.285, 2.044355549, 0.183288613122, 0.0, 1.75957068597 , 0.17, 1.40991240863 );
-    drawBond( 2.98, 0.542, -5.3875, 1.92803514335, -0.0519033055306, 0.0, -0.445676383489 , 0.17, 0.692044073741 );
-    drawBond( 3.624, 0.3, -5.4625, 1.92803514335, -0.0519033055306, 0.0, -0.445676383489 , 0.17, 0.692044073741 );
-    drawBond( 1.37525, -0.31425, -5.2175, 3.03773489429, 0.00336060820388, 0.0, 0.0467124540339 , 0.17, 0.672121640776 );
-    drawBond( 1.30575, -0.98275, -5.2125, 3.03773489429, 0.00336060820388, 0.0, 0.0467124540339 , 0.17, 0.672121640776 );
-    drawBond( 4.49425, 1.54275, -5.55, 0.560481734964, 0.0273672066532, 0.0, 0.247331130128 , 0.17, 0.68418016633 );
-    drawBond( 4.13275, 2.12225, -5.51, 0.560481734964, 0.0273672066532, 0.0, 0.247331130128 , 0.17, 0.68418016633 );
-    drawBond( 4.50075584429, 0.98424053481, -5.47792895629, 2.54312270307, 0.0227487682359, 0.0, 0.236912172057 , 0.075, 0.64996480674 );
-    drawBond( 4.48474415571, 0.98475946519, -5.62707104371, 2.54312270307, 0.0227487682359, 0.0, 0.236912172057 , 0.075, 0.64996480674 );
-    drawBond( 4.13625584429, 0.44724053481, -5.44292895629, 2.54312270307, 0.0227487682359, 0.0, 0.236912172057 , 0.075, 0.64996480674 );
-    drawBond( 4.12024415571, 0.44775946519, -5.59207104371, 2.54312270307, 0.0227487682359, 0.0, 0.236912172057 , 0.075, 0.64996480674 );
-    drawBond( 0.587523823567, 0.603073017138, -5.20457396664, 2.18896066531, -0.0402215427352, 0.0, -0.364004961754 , 0.075, 0.670359045587 );
-    drawBond( 0.603476176433, 0.602426982862, -5.05542603336, 2.18896066531, -0.0402215427352, 0.0, -0.364004961754 , 0.075, 0.670359045587 );
-    drawBond( 1.13052382357, 0.214573017138, -5.26457396664, 2.18896066531, -0.0402215427352, 0.0, -0.364004961754 , 0.075, 0.670359045587 );
-    drawBond( 1.14647617643, 0.213926982862, -5.11542603336, 2.18896066531, -0.0402215427352, 0.0, -0.364004961754 , 0.075, 0.670359045587 );
-    drawBond( 3.873, 4.3015, -5.2265, 2.21004727201, -0.113854560392, 0.0, -0.20918732627 , 0.17, 0.544758662162 );
-    drawBond( 4.257, 3.9765, -5.4355, 2.21004727201, -0.113854560392, 0.0, -0.20918732627 , 0.17, 0.544758662162 );
-    drawBond( 5.6865, 4.291, -4.065, 1.91118188384, -0.278028594393, 0.0, -0.0343447087191 , 0.17, 0.545154106652 );
-    drawBond( 5.7495, 4.109, -4.575, 1.91118188384, -0.278028594393, 0.0, -0.0343447087191 , 0.17, 0.545154106652 );
-    drawBond( 7.26825, 5.02475, -5.65825, 1.52767165925, -0.0188059734177, 0.0, 0.296262218914 , 0.17, 0.545100678774 );
-    drawBond( 6.72475, 5.04825, -5.69275, 1.52767165925, -0.0188059734177, 0.0, 0.296262218914 , 0.17, 0.545100678774 );
-    drawBond( 5.98575, 5.367, -7.55775, 2.56180107221, 0.162705912765, 0.0, 0.00463316669515 , 0.17, 0.545078434723 );
-    drawBond( 5.97725, 4.911, -7.25925, 2.56180107221, 0.162705912765, 0.0, 0.00463316669515 , 0.17, 0.545078434723 );
-    drawBond( 6.3165, 3.28125, -8.40625, 1.11812435935, 0.205852622608, 0.0, -0.170680452652 , 0.17, 0.54530496055 );
-    drawBond( 6.6295, 3.51975, -8.02875, 1.11812435935, 0.205852622608, 0.0, -0.170680452652 , 0.17, 0.54530496055 );
-    drawBond( 0.56975, -1.63125, -5.1365, 1.15153493556, -0.0252170348673, 0.0, -0.240591097969 , 0.17, 0.514633364639 );
-    drawBond( 1.03725, -1.42175, -5.1855, 1.15153493556, -0.0252170348673, 0.0, -0.240591097969 , 0.17, 0.514633364639 );
-    drawBond( 1.89275, -1.77, -5.2775, 0.943925746685, 0.0231668832874, 0.0, 0.213392736058 , 0.17, 0.514819628608 );
-    drawBond( 1.47825, -1.468, -5.2325, 0.943925746685, 0.0231668832874, 0.0, 0.213392736058 , 0.17, 0.514819628608 );
-    drawBond( 5.488, 1.23725, -5.654, 1.55152860121, 0.0305192421924, 0.0, 0.295382665505 , 0.17, 0.544986467722 );
-    drawBond( 4.946, 1.24775, -5.598, 1.55152860121, 0.0305192421924, 0.0, 0.295382665505 , 0.17, 0.544986467722 );
-    drawBond( -0.21675, 2.5485, -5.02975, 2.12512123586, -0.0291705775718, 0.0, -0.251085064894 , 0.17, 0.545244440595 );
-    drawBond( 0.24375, 2.2615, -5.08325, 2.12512123586, -0.0291705775718, 0.0, -0.251085064894 , 0.17, 0.545244440595 );
-    drawBond( 5.48225, 6.62925, -3.7075, 1.75686811217, 0.0996622029031, 0.0, 0.616709711565 , 0.17, 0.797297623225 );
-    drawBond( 4.70875, 6.48175, -3.5825, 1.75686811217, 0.0996622029031, 0.0, 0.616709711565 , 0.17, 0.797297623225 );
-    drawBond( 4.07925, 6.539, -3.755, 1.20091281176, -0.340629804663, 0.0, 0.351863340775 , 0.17, 0.724744265241 );
-    drawBond( 3.59375, 6.801, -4.225, 1.20091281176, -0.340629804663, 0.0, 0.351863340775 , 0.17, 0.724744265241 );
-    drawBond( 2.7155, 7.116, -4.095, 1.324810104, 1.10318555488, 0.0, 1.92075183597 , 0.17, 1.51121308888 );
-    drawBond( 2.1635, 7.5935, -3.03, 1.17628856801, 2.13813415857, 0.0, -0.255048860343 , 0.17, 1.52723868469 );
-    drawBond( 1.40625, 8.4795, -2.0375, 2.15805819428, -0.139013289855, 0.0, -0.399574097249 , 0.17, 0.712888665922 );
-    drawBond( 1.96675, 8.0845, -2.2325, 2.15805819428, -0.139013289855, 0.0, -0.399574097249 , 0.17, 0.712888665922 );
-    drawBond( 2.281, 7.268, -1.89, 2.52223286526, 1.33796700228, 0.0, -0.103388359267 , 0.17, 1.52041704805 );
-    drawBond( 1.34175, 5.796, -2.5, 1.29590526698, -0.480986573201, 0.0, 0.0229883288662 , 0.17, 0.707333195884 );
-    drawBond( 1.30925, 5.988, -3.18, 1.29590526698, -0.480986573201, 0.0, 0.0229883288662 , 0.17, 0.707333195884 );
-    drawBond( 1.8365, 6.1745, -1.805, 0.898255949031, 1.08156796134, 0.0, -1.45783174508 , 0.17, 1.52333515682 );
-    drawBond( 1.46325, 5.34375, -2.1475, 2.85241732909, 0.0185841246094, 0.0, -0.156478329212 , 0.17, 0.743364984378 );
-    drawBond( 1.67375, 4.63125, -2.1225, 2.85241732909, 0.0185841246094, 0.0, -0.156478329212 , 0.17, 0.743364984378 );
-    drawBond( 1.48975, 6.388, -3.5725, 0.590202341169, -0.0768390007174, 0.0, -0.287963302688 , 0.17, 0.731800006832 );
-    drawBond( 1.88325, 6.996, -3.6775, 0.590202341169, -0.0768390007174, 0.0, -0.287963302688 , 0.17, 0.731800006832 );
-    drawBond( 5.94, 7.061, -3.715, 0.24579588005, 0.0812005665005, 0.0, -0.104822549482 , 0.17, 0.738186968186 );
-    drawBond( 6.082, 7.777, -3.605, 0.24579588005, 0.0812005665005, 0.0, -0.104822549482 , 0.17, 0.738186968186 );
-    drawBond( 6.07325, 6.465, -3.5725, 2.26809055486, 0.2927995284, 0.0, -0.30280660089 , 0.17, 0.741264628861 );
-    drawBond( 6.48175, 5.989, -3.1775, 2.26809055486, 0.2927995284, 0.0, -0.30280660089 , 0.17, 0.741264628861 );
-    drawBond( 1.56775, 4.00525, -2.075, 2.47063857899, 0.0482170701101, 0.0, 0.291024458879 , 0.17, 0.688815287287 );
-    drawBond( 1.14525, 3.46575, -2.005, 2.47063857899, 0.0482170701101, 0.0, 0.291024458879 , 0.17, 0.688815287287 );
-    drawBond( 0.596, 3.21275, -1.94, 1.52147420063, 0.040769028686, 0.0, 0.459331056529 , 0.17, 0.679483811433 );
-    drawBond( -0.08, 3.24625, -1.88, 1.52147420063, 0.040769028686, 0.0, 0.459331056529 , 0.17, 0.679483811433 );
-    drawBond( -0.549965646033, 2.96702028725, -1.74296755992, 2.69811334989, 0.0432486965121, 0.0, 0.18497134816 , 0.075, 0.665364561725 );
-    drawBond( -0.564034353967, 2.95797971275, -1.89203244008, 2.69811334989, 0.0432486965121, 0.0, 0.18497134816 , 0.075, 0.665364561725 );
-    drawBond( -0.827965646033, 2.36602028725, -1.67796755992, 2.69811334989, 0.0432486965121, 0.0, 0.18497134816 , 0.075, 0.665364561725 );
-    drawBond( -0.842034353967, 2.35697971275, -1.82703244008, 2.69811334989, 0.0432486965121, 0.0, 0.18497134816 , 0.075, 0.665364561725 );
-    drawBond( -1.30525, 2.0315, -1.6875, 1.65919637072, 0.0434388853016, 0.0, 0.442742484805 , 0.17, 0.668290543102 );
-    drawBond( -1.96775, 1.9725, -1.6225, 1.65919637072, 0.0434388853016, 0.0, 0.442742484805 , 0.17, 0.668290543102 );
-    drawBond( -0.79425, 1.76675, -1.72, 2.59321510197, 0.0, 0.0, -0.247917544343 , 0.17, 0.689617647686 );
-    drawBond( -0.43475, 1.17825, -1.72, 2.59321510197, 0.0, 0.0, -0.247917544343 , 0.17, 0.689617647686 );
-    drawBond( 0.0945, 0.861, -1.75, 1.63626980154, -0.0421846085676, 0.0, -0.491450689813 , 0.17, 0.70307680946 );
-    drawBond( 0.7935, 0.815, -1.81, 1.63626980154, -0.0421846085676, 0.0, -0.491450689813 , 0.17, 0.70307680946 );
-    drawBond( 1.27083395003, 0.510708598712, -1.90956500391, 2.68893758039, 0.00615486189934, 0.0, -0.165565785092 , 0.075, 0.615486189934 );
-    drawBond( 1.28416604997, 0.519791401288, -1.76043499609, 2.68893758039, 0.00615486189934, 0.0, -0.165565785092 , 0.075, 0.615486189934 );
-    drawBond( 1.53983395003, -0.0427914012878, -1.89956500391, 2.68893758039, 0.00615486189934, 0.0, -0.165565785092 , 0.075, 0.615486189934 );
-    drawBond( 1.55316604997, -0.0337085987122, -1.75043499609, 2.68893758039, 0.00615486189934, 0.0, -0.165565785092 , 0.075, 0.615486189934 );
-    drawBond( 1.439, 1.43, -1.905, 2.69814073551, 0.183642658443, 0.0, 0.836280413835 , 0.17, 1.41263583418 );
-    drawBond( 1.32787105274, 2.6274286908, -2.04456647988, 2.52411603673, 0.0, 0.0, -1.10815824231 , 0.075, 1.3834684673 );
-    drawBond( 1.34112894726, 2.6365713092, -1.89543352012, 2.52411603673, 0.0, 0.0, -1.10815824231 , 0.075, 1.3834684673 );
-    drawBond( 2.0705, 2.1585, -2.005, 1.3086783488, -0.0488949874732, 0.0, -0.468693379921 , 0.17, 0.698499821045 );
-    drawBond( 2.7415, 2.3395, -2.075, 1.3086783488, -0.0488949874732, 0.0, -0.468693379921 , 0.17, 0.698499821045 );
-    drawBond( 3.06259058113, 2.75159354991, -2.20455850183, 0.0656497909924, -0.0261563453104, 0.0, 0.0101355838078 , 0.075, 0.653908632761 );
-    drawBond( 3.07590941887, 2.76090645009, -2.05544149817, 0.0656497909924, -0.0261563453104, 0.0, 0.0101355838078 , 0.075, 0.653908632761 );
-    drawBond( 3.04709058113, 3.40409354991, -2.24455850183, 0.0656497909924, -0.0261563453104, 0.0, 0.0101355838078 , 0.075, 0.653908632761 );
-    drawBond( 3.06040941887, 3.41340645009, -2.09544149817, 0.0656497909924, -0.0261563453104, 0.0, 0.0101355838078 , 0.075, 0.653908632761 );
-    drawBond( 2.72925, 3.87, -2.17, 1.16862370537, 0.0275919481008, 0.0, 0.436987478047 , 0.17, 0.689798702521 );
-    drawBond( 2.09575, 4.14, -2.13, 1.16862370537, 0.0275919481008, 0.0, 0.436987478047 , 0.17, 0.689798702521 );
-    drawBond( 0.605, 5.75625, -1.8465, 1.63965038588, -0.113917702273, 0.0, -0.273620509767 , 0.17, 0.545060776428 );
-    drawBond( 1.107, 5.71875, -2.0555, 1.63965038588, -0.113917702273, 0.0, -0.273620509767 , 0.17, 0.545060776428 );
-    drawBond( 2.078, 6.814, -0.685, 1.77397910337, -0.27801502909, 0.0, -0.0861301462672 , 0.17, 0.54512750802 );
-    drawBond( 2.236, 6.704, -1.195, 1.77397910337, -0.27801502909, 0.0, -0.0861301462672 , 0.17, 0.54512750802 );
-    drawBond( 2.92725, 8.337, -2.27825, 2.15390147036, -0.0187970393447, 0.0, 0.247085720081 , 0.17, 0.544841720135 );
-    drawBond( 2.47375, 8.037, -2.31275, 2.15390147036, -0.0187970393447, 0.0, 0.247085720081 , 0.17, 0.544841720135 );
-    drawBond( 1.68775, 7.86025, -4.17775, 2.3259014622, 0.162672024777, 0.0, -0.142508323214 , 0.17, 0.544964907127 );
-    drawBond( 1.94925, 7.48675, -3.87925, 2.3259014622, 0.162672024777, 0.0, -0.142508323214 , 0.17, 0.544964907127 );
-    drawBond( 3.1815, 6.368, -5.02625, 0.808833662984, 0.205608018315, 0.0, -0.0615462412439 , 0.17, 0.544657002158 );
-    drawBond( 3.2945, 6.744, -4.64875, 0.808833662984, 0.205608018315, 0.0, -0.0615462412439 , 0.17, 0.544657002158 );
-    drawBond( -2.74525, 2.57375, -1.58475, 2.52582416358, -0.00180288648769, 0.0, -0.153245351454 , 0.17, 0.515110425055 );
-    drawBond( -2.44775, 2.15325, -1.58825, 2.52582416358, -0.00180288648769, 0.0, -0.153245351454 , 0.17, 0.515110425055 );
-    drawBond( -2.61925, 1.24325, -1.52025, 0.438043504494, -0.0239538985384, 0.0, -0.109981878235 , 0.17, 0.515137602976 );
-    drawBond( -2.40575, 1.70975, -1.56675, 0.438043504494, -0.0239538985384, 0.0, -0.109981878235 , 0.17, 0.515137602976 );
-    drawBond( 3.71875, 4.191, -2.27925, 2.16243242382, 0.0324320577072, 0.0, 0.244466855154 , 0.17, 0.545076600121 );
-    drawBond( 3.27025, 3.887, -2.21975, 2.16243242382, 0.0324320577072, 0.0, 0.244466855154 , 0.17, 0.545076600121 );
-    drawBond( -0.651, 0.22475, -1.64875, 0.547979044523, -0.0244573113429, 0.0, -0.13593116199 , 0.17, 0.514890765114 );
-    drawBond( -0.387, 0.66425, -1.69625, 0.547979044523, -0.0244573113429, 0.0, -0.13593116199 , 0.17, 0.514890765114 );
-    drawBond( 0.5385, 8.586, -0.3275, 2.3745507157, 0.0996573818139, 0.0, 0.429722630381 , 0.17, 0.797259054511 );
-    drawBond( -0.0005, 8.012, -0.2025, 2.3745507157, 0.0996573818139, 0.0, 0.429722630381 , 0.17, 0.797259054511 );
-    drawBond( -0.5435, 7.68825, -0.375, 1.67236113235, -0.340713127315, 0.0, 0.396532086471 , 0.17, 0.724921547479 );
-    drawBond( -1.0905, 7.61475, -0.845, 1.67236113235, -0.340713127315, 0.0, 0.396532086471 , 0.17, 0.724921547479 );
-    drawBond( -1.986, 7.353, -0.715, 1.87321300524, 1.10298531014, 0.0, 1.87960784359 , 0.17, 1.51093878102 );
-    drawBond( -2.713, 7.4145, 0.35, 1.18619537815, 2.13812086656, 0.0, 0.320718129984 , 0.17, 1.5272291904 );
-    drawBond( -3.84625, 7.68675, 1.3425, 1.55746744524, -0.138988019762, 0.0, -0.488596346396 , 0.17, 0.712759075705 );
-    drawBond( -3.16075, 7.69625, 1.1475, 1.55746744524, -0.138988019762, 0.0, -0.488596346396 , 0.17, 0.712759075705 );
-    drawBond( -2.4265, 7.2205, 1.49, 2.25512553584, 1.33777656729, 0.0, -1.19031710476 , 0.17, 1.52020064465 );
-    drawBond( -2.3215, 5.478, 0.88, 1.37729981615, -0.480936940565, 0.0, 0.0983091687331 , 0.17, 0.707260206713 );
-    drawBond( -2.4605, 5.614, 0.2, 1.37729981615, -0.480936940565, 0.0, 0.0983091687331 , 0.17, 0.707260206713 );
-    drawBond( -2.1435, 6.075, 1.575, 0.509125611864, 1.08146052396, 0.0, -0.330530892536 , 0.17, 1.52318383657 );
-    drawBond( -1.95725, 5.1835, 1.2325, 2.22556585809, 0.0185967781148, 0.0, -0.438512027946 , 0.17, 0.743871124591 );
-    drawBond( -1.36775, 4.7305, 1.2575, 2.22556585809, 0.0185967781148, 0.0, -0.438512027946 , 0.17, 0.743871124591 );
-    drawBond( -2.5495, 6.0435, -0.1925, 0.153700564424, -0.076820614909, 0.0, 0.0285333712519 , 0.17, 0.731624903895 );
-    drawBond( -2.5885, 6.7665, -0.2975, 0.153700564424, -0.076820614909, 0.0, 0.0285333712519 , 0.17, 0.731624903895 );
-    drawBond( 0.655, 9.20425, -0.335, 0.456279685775, 0.0811798695798, 0.0, 0.225827637195 , 0.17, 0.737998814362 );
-    drawBond( 0.349, 9.86675, -0.225, 0.456279685775, 0.0811798695798, 0.0, 0.225827637195 , 0.17, 0.737998814362 );
-    drawBond( 1.11325, 8.8005, -0.1925, 1.76762536965, 0.292875985711, 0.0, -0.452660226017 , 0.17, 0.741458191674 );
-    drawBond( 1.72375, 8.6555, 0.2025, 1.76762536965, 0.292875985711, 0.0, -0.452660226017 , 0.17, 0.741458191674 );
-    drawBond( -0.9605, 0.69175, 1.6575, 1.1434969952, -0.00332396694478, 0.0, 0.402200000318 , 0.17, 0.664793388956 );
-    drawBond( -1.5655, 0.96725, 1.6525, 1.1434969952, -0.00332396694478, 0.0, 0.402200000318 , 0.17, 0.664793388956 );
-    drawBond( -1.95641807524, 1.41347295175, 1.54546139742, 0.279039963928, -0.0394769565696, 0.0, 0.112509326223 , 0.075, 0.65794927616 );
-    drawBond( -1.95058192476, 1.42902704825, 1.69453860258, 0.279039963928, -0.0394769565696, 0.0, 0.112509326223 , 0.075, 0.65794927616 );
-    drawBond( -2.12741807524, 2.04597295175, 1.48546139742, 0.279039963928, -0.0394769565696, 0.0, 0.112509326223 , 0.075, 0.65794927616 );
-    drawBond( -2.12158192476, 2.06152704825, 1.63453860258, 0.279039963928, -0.0394769565696, 0.0, 0.112509326223 , 0.075, 0.65794927616 );
-    drawBond( -1.9355, 2.56225, 1.5, 0.962612627637, -0.0403760882206, 0.0, -0.369441207219 , 0.17, 0.672934803677 );
-    drawBond( -1.3865, 2.94675, 1.44, 0.962612627637, -0.0403760882206, 0.0, -0.369441207219 , 0.17, 0.672934803677 );
-    drawBond( -0.457766804843, 2.9437117986, 1.48455238045, 1.87285070318, 0.0, 0.0, -1.77831815061 , 0.075, 1.36478752925 );
-    drawBond( -0.463233195157, 2.9282882014, 1.33544761955, 1.87285070318, 0.0, 0.0, -1.77831815061 , 0.075, 1.36478752925 );
-    drawBond( -1.10225, 3.48025, 1.375, 0.106069758109, -0.0480450189926, 0.0, -0.0133839695765 , 0.17, 0.68635741418 );
-    drawBond( -1.08275, 4.16275, 1.305, 0.106069758109, -0.0480450189926, 0.0, -0.0133839695765 , 0.17, 0.68635741418 );
-    drawBond( 0.304, 2.04, 1.475, 2.95565436087, 0.183340194175, 0.0, -0.318729876027 , 0.17, 1.41030918596 );
-    drawBond( 0.4055, 3.00175, 1.3725, 0.680956652591, -0.0518841874394, 0.0, -0.296777552154 , 0.17, 0.691789165859 );
-    drawBond( 0.8345, 3.53925, 1.2975, 0.680956652591, -0.0518841874394, 0.0, -0.296777552154 , 0.17, 0.691789165859 );
-    drawBond( 0.724, 1.21075, 1.5425, 1.98847934254, 0.00335885862311, 0.0, -0.412467838917 , 0.17, 0.671771724621 );
-    drawBond( 1.338, 0.93825, 1.5475, 1.98847934254, 0.00335885862311, 0.0, -0.412467838917 , 0.17, 0.671771724621 );
-    drawBond( -0.0785, 4.75075, 1.21, 1.81357547845, 0.0273709115668, 0.0, 0.45367285922 , 0.17, 0.684272789171 );
-    drawBond( -0.7415, 4.58625, 1.25, 1.81357547845, 0.0273709115668, 0.0, 0.45367285922 , 0.17, 0.684272789171 );
-    drawBond( 0.4492790372, 4.5692158794, 1.13292900319, 2.47942604821, 0.0227442175344, 0.0, -0.258634245105 , 0.075, 0.649834786696 );
-    drawBond( 0.4547209628, 4.5842841206, 1.28207099681, 2.47942604821, 0.0227442175344, 0.0, -0.258634245105 , 0.075, 0.649834786696 );
-    drawBond( 0.8472790372, 4.0567158794, 1.16792900319, 2.47942604821, 0.0227442175344, 0.0, -0.258634245105 , 0.075, 0.649834786696 );
-    drawBond( 0.8527209628, 4.0717841206, 1.31707099681, 2.47942604821, 0.0227442175344, 0.0, -0.258634245105 , 0.075, 0.649834786696 );
-    drawBond( -0.386479101563, 0.759734069178, 1.70457419451, 0.938185631357, -0.0402366325629, 0.0, -0.360453166709 , 0.075, 0.670610542715 );
-    drawBond( -0.392020898437, 0.744765930822, 1.55542580549, 0.938185631357, -0.0402366325629, 0.0, -0.360453166709 , 0.075, 0.670610542715 );
-    drawBond( 0.151020898437, 1.15623406918, 1.64457419451, 0.938185631357, -0.0402366325629, 0.0, -0.360453166709 , 0.075, 0.670610542715 );
-    drawBond( 0.145479101563, 1.14126593082, 1.49542580549, 0.938185631357, -0.0402366325629, 0.0, -0.360453166709 , 0.075, 0.670610542715 );
-    drawBond( -2.894, 5.0125, 1.5335, 1.06307722495, -0.113917462621, 0.0, -0.233285521539 , 0.17, 0.545059629765 );
-    drawBond( -2.466, 5.2775, 1.3245, 1.06307722495, -0.113917462621, 0.0, -0.233285521539 , 0.17, 0.545059629765 );
-    drawBond( -2.32375, 6.734, 2.695, 1.56345863, -0.278018888252, 0.0, -0.104938501938 , 0.17, 0.545135075004 );
-    drawBond( -2.13125, 6.738, 2.185, 1.56345863, -0.278018888252, 0.0, -0.104938501938 , 0.17, 0.545135075004 );
-    drawBond( -2.53225, 8.46525, 1.10175, 2.77846483185, -0.0188039479947, 0.0, 0.103830495449 , 0.17, 0.545041970861 );
-    drawBond( -2.72275, 7.95575, 1.06725, 2.77846483185, -0.0188039479947, 0.0, 0.103830495449 , 0.17, 0.545041970861 );
-    drawBond( -3.2545, 7.3515, -0.79775, 1.84769776137, 0.162693248384, 0.0, -0.234910519442 , 0.17, 0.545036007985 );
-    drawBond( -2.8235, 7.2025, -0.49925, 1.84769776137, 0.162693248384, 0.0, -0.234910519442 , 0.17, 0.545036007985 );
-    drawBond( -1.169, 7.0215, -1.64625, 0.822067031237, 0.205745205704, 0.0, 0.0708526536201 , 0.17, 0.545020412462 );
-    drawBond( -1.299, 7.3925, -1.26875, 0.822067031237, 0.205745205704, 0.0, 0.0708526536201 , 0.17, 0.545020412462 );
-    drawBond( 1.7275, 0.03775, 1.6235, 0.143580965193, -0.0252250672199, 0.0, 0.0283138509612 , 0.17, 0.514797290203 );
-    drawBond( 1.6725, 0.54725, 1.5745, 0.143580965193, -0.0252250672199, 0.0, 0.0283138509612 , 0.17, 0.514797290203 );
-    drawBond( 2.26825, 1.2535, 1.4825, 2.19496213937, 0.0231768021144, 0.0, 0.213999139523 , 0.17, 0.515040046987 );
-    drawBond( 1.85275, 0.9525, 1.5275, 2.19496213937, 0.0231768021144, 0.0, 0.213999139523 , 0.17, 0.515040046987 );
-    drawBond( 0.51925, 5.60175, 1.106, 2.79323419314, 0.030534048143, 0.0, 0.0967820275962 , 0.17, 0.545250859697 );
-    drawBond( 0.34175, 5.08925, 1.162, 2.79323419314, 0.030534048143, 0.0, 0.0967820275962 , 0.17, 0.545250859697 );
-    drawBond( -2.4905, 0.5815, 1.73025, 0.875628363223, -0.029150787186, 0.0, -0.226122928639 , 0.17, 0.544874526841 );
-    drawBond( -2.0755, 0.9305, 1.67675, 0.875628363223, -0.029150787186, 0.0, -0.226122928639 , 0.17, 0.544874526841 );
-    drawBond( -4.61125, 7.2625, 3.0525, 2.94057350178, 0.0996312145176, 0.0, 0.0785093970399 , 0.17, 0.797049716141 );
-    drawBond( -4.70975, 6.4815, 3.1775, 2.94057350178, 0.0996312145176, 0.0, 0.0785093970399 , 0.17, 0.797049716141 );
-    drawBond( -4.95875, 5.9005, 3.005, 2.12409798679, -0.340761749797, 0.0, 0.289647487328 , 0.17, 0.725024999569 );
-    drawBond( -5.35825, 5.5195, 2.535, 2.12409798679, -0.340761749797, 0.0, 0.289647487328 , 0.17, 0.725024999569 );
-    drawBond( -5.929, 4.7815, 2.665, 2.38152000705, 1.10287732232, 0.0, 1.12100681255 , 0.17, 1.5107908525 );
-    drawBond( -6.553, 4.404, 3.73, 1.3462508746, 2.13775736696, 0.0, 0.772646591202 , 0.17, 1.52696954783 );
-    drawBond( -7.6295, 3.95825, 4.7225, 0.95699198257, -0.138975810508, 0.0, -0.391270358814 , 0.17, 0.712696464142 );
-    drawBond( -7.0805, 4.36875, 4.5275, 0.95699198257, -0.138975810508, 0.0, -0.391270358814 , 0.17, 0.712696464142 );
-    drawBond( -6.207, 4.4155, 4.87, 1.78090531141, 1.33751112862, 0.0, -1.82083901374 , 0.17, 1.5198990098 );
-    drawBond( -5.09825, 3.06725, 4.26, 1.53049114603, -0.480961697436, 0.0, 0.136154598171 , 0.17, 0.707296613876 );
-    drawBond( -5.29075, 3.09575, 3.58, 1.53049114603, -0.480961697436, 0.0, 0.136154598171 , 0.17, 0.707296613876 );
-    drawBond( -5.305, 3.655, 4.955, 0.659493630045, 1.08166163989, 0.0, 0.923221061649 , 0.17, 1.52346709843 );
-    drawBond( -4.63025, 3.043, 4.6125, 1.59767445673, 0.0186047247024, 0.0, -0.553304512648 , 0.17, 0.744188988094 );
-    drawBond( -3.88675, 3.023, 4.6375, 1.59767445673, 0.0186047247024, 0.0, -0.553304512648 , 0.17, 0.744188988094 );
-    drawBond( -5.61525, 3.391, 3.1875, 0.694829227152, -0.076819628229, 0.0, 0.333982478919 , 0.17, 0.731615506943 );
-    drawBond( -6.07175, 3.953, 3.0825, 0.694829227152, -0.076819628229, 0.0, 0.333982478919 , 0.17, 0.731615506943 );
-    drawBond( -4.8805, 7.83125, 3.045, 1.06680811408, 0.0812036398507, 0.0, 0.470242896227 , 0.17, 0.738214907734 );
-    drawBond( -5.5175, 8.18775, 3.155, 1.06680811408, 0.0812036398507, 0.0, 0.470242896227 , 0.17, 0.738214907734 );
-    drawBond( -4.27225, 7.77375, 3.1875, 1.23916176549, 0.292984443593, 0.0, -0.429834139398 , 0.17, 0.74173276859 );
-    drawBond( -3.69275, 8.01525, 3.5825, 1.23916176549, 0.292984443593, 0.0, -0.429834139398 , 0.17, 0.74173276859 );
-    drawBond( -1.18375, -0.00525, 5.0375, 1.77143096177, -0.00332427999723, 0.0, 0.433153683639 , 0.17, 0.664855999446 );
-    drawBond( -1.83525, -0.13775, 5.0325, 1.77143096177, -0.00332427999723, 0.0, 0.433153683639 , 0.17, 0.664855999446 );
-    drawBond( -2.41378984951, -0.00650579388233, 4.92546126433, 0.895834359129, -0.0394643586037, 0.0, 0.335447048131 , 0.075, 0.657739310061 );
-    drawBond( -2.41821015049, 0.00950579388233, 5.07453873567, 0.895834359129, -0.0394643586037, 0.0, 0.335447048131 , 0.075, 0.657739310061 );
-    drawBond( -2.92378984951, 0.404494206118, 4.86546126433, 0.895834359129, -0.0394643586037, 0.0, 0.335447048131 , 0.075, 0.657739310061 );
-    drawBond( -2.92821015049, 0.420505793882, 5.01453873567, 0.895834359129, -0.0394643586037, 0.0, 0.335447048131 , 0.075, 0.657739310061 );
-    drawBond( -3.072, 0.935, 4.88, 0.34257287269, -0.0403867304941, 0.0, -0.146738454128 , 0.17, 0.673112174901 );
-    drawBond( -2.854, 1.569, 4.82, 0.34257287269, -0.0403867304941, 0.0, -0.146738454128 , 0.17, 0.673112174901 );
-    drawBond( -2.1008220533, 2.11234570842, 4.86455234662, 1.24487526831, 0.0, 0.0, -1.76475222354 , 0.075, 1.36485090761 );
-    drawBond( -2.0961779467, 2.09665429158, 4.71544765338, 1.24487526831, 0.0, 0.0, -1.76475222354 , 0.075, 1.36485090761 );
-    drawBond( -2.9375, 2.16775, 4.755, 0.606978626713, -0.0480231248984, 0.0, 0.264127186941 , 0.17, 0.686044641405 );
-    drawBond( -3.3225, 2.73125, 4.685, 0.606978626713, -0.0480231248984, 0.0, 0.264127186941 , 0.17, 0.686044641405 );
-    drawBond( -0.953, 1.829, 4.855, 2.34695336255, 0.183343696919, 0.0, -1.40751545789 , 0.17, 1.41033613015 );
-    drawBond( -1.4365, 2.6665, 4.7525, 0.117583435526, -0.0518832523556, 0.0, -0.0214450776403 , 0.17, 0.691776698075 );
-    drawBond( -1.4055, 3.3535, 4.6775, 0.117583435526, -0.0518832523556, 0.0, -0.0214450776403 , 0.17, 0.691776698075 );
-    drawBond( -0.12575, 1.40525, 4.9225, 1.3599690065, 0.00335692381505, 0.0, -0.440764096915 , 0.17, 0.671384763009 );
-    drawBond( 0.53075, 1.54575, 4.9275, 1.3599690065, 0.00335692381505, 0.0, -0.440764096915 , 0.17, 0.671384763009 );
-    drawBond( -2.85575, 3.7975, 4.59, 2.44069888012, 0.0273726651972, 0.0, 0.300757158855 , 0.17, 0.684316629931 );
-    drawBond( -3.29525, 3.2745, 4.63, 2.44069888012, 0.0273726651972, 0.0, 0.300757158855 , 0.17, 0.684316629931 );
-    drawBond( -2.32227281935, 3.96080474244, 4.51292908298, 1.85312043628, 0.022739632253, 0.0, -0.404765454103 , 0.075, 0.649703778656 );
-    drawBond( -2.32672718065, 3.97619525756, 4.66207091702, 1.85312043628, 0.022739632253, 0.0, -0.404765454103 , 0.075, 0.649703778656 );
-    drawBond( -1.69927281935, 3.77980474244, 4.54792908298, 1.85312043628, 0.022739632253, 0.0, -0.404765454103 , 0.075, 0.649703778656 );
-    drawBond( -1.70372718065, 3.79519525756, 4.69707091702, 1.85312043628, 0.022739632253, 0.0, -0.404765454103 , 0.075, 0.649703778656 );
-    drawBond( -0.759158485189, 0.387183641475, 5.08457413763, 0.319473021768, -0.0402569596468, 0.0, -0.135531764144 , 0.075, 0.670949327446 );
-    drawBond( -0.754841514811, 0.371816358525, 4.93542586237, 0.319473021768, -0.0402569596468, 0.0, -0.135531764144 , 0.075, 0.670949327446 );
-    drawBond( -0.557158485189, 1.02418364148, 5.02457413763, 0.319473021768, -0.0402569596468, 0.0, -0.135531764144 , 0.075, 0.670949327446 );
-    drawBond( -0.552841514811, 1.00881635852, 4.87542586237, 0.319473021768, -0.0402569596468, 0.0, -0.135531764144 , 0.075, 0.670949327446 );
-    drawBond( -5.28775, 2.354, 4.9135, 0.54544070942, -0.113924604047, 0.0, -0.103840368761 , 0.17, 0.545093799268 );
-    drawBond( -5.09725, 2.82, 4.7045, 0.54544070942, -0.113924604047, 0.0, -0.103840368761 , 0.17, 0.545093799268 );
-    drawBond( -5.83825, 4.08225, 6.075, 1.35544963846, -0.278048005657, 0.0, -0.0836869977811 , 0.17, 0.545192167955 );
-    drawBond( -5.68475, 4.19875, 5.565, 1.35544963846, -0.278048005657, 0.0, -0.0836869977811 , 0.17, 0.545192167955 );
-    drawBond( -7.02425, 5.36, 4.48175, 2.86361062482, -0.0187996986445, 0.0, -0.0792856855878 , 0.17, 0.544918801291 );
-    drawBond( -6.87875, 4.836, 4.44725, 2.86361062482, -0.0187996986445, 0.0, -0.0792856855878 , 0.17, 0.544918801291 );
-    drawBond( -6.954, 4.0345, 2.58225, 1.32421172099, 0.162644772346, 0.0, -0.23756489361 , 0.17, 0.544873609198 );
-    drawBond( -6.518, 4.1675, 2.88075, 1.32421172099, 0.162644772346, 0.0, -0.23756489361 , 0.17, 0.544873609198 );
-    drawBond( -5.07275, 4.99375, 1.73375, 1.14830656596, 0.205767195678, 0.0, 0.17633294782 , 0.17, 0.545078664048 );
-    drawBond( -5.39625, 5.21725, 2.11125, 1.14830656596, 0.205767195678, 0.0, 0.17633294782 , 0.17, 0.545078664048 );
-    drawBond( 1.37575, 1.046, 5.0035, 0.741423609483, -0.0252471875909, 0.0, 0.177503186226 , 0.17, 0.515248726345 );
-    drawBond( 1.03125, 1.426, 4.9545, 0.741423609483, -0.0252471875909, 0.0, 0.177503186226 , 0.17, 0.515248726345 );
-    drawBond( 1.09825, 2.34725, 4.8625, 2.81389748399, 0.0231704777141, 0.0, 0.0821264710089 , 0.17, 0.514899504758 );
-    drawBond( 0.93875, 1.85975, 4.9075, 2.81389748399, 0.0231704777141, 0.0, 0.0821264710089 , 0.17, 0.514899504758 );
-    drawBond( -2.87225, 4.83675, 4.486, 2.82972297359, 0.0305076415346, 0.0, -0.0858027418159 , 0.17, 0.544779313117 );
-    drawBond( -2.71475, 4.31825, 4.542, 2.82972297359, 0.0305076415346, 0.0, -0.0858027418159 , 0.17, 0.544779313117 );
-    drawBond( -2.35675, -0.99375, 5.11025, 0.261738292509, -0.0291609233082, 0.0, -0.0711308503125 , 0.17, 0.545063987069 );
-    drawBond( -2.22625, -0.46725, 5.05675, 0.261738292509, -0.0291609233082, 0.0, -0.0711308503125 , 0.17, 0.545063987069 );
-    drawBond( -7.99925, 3.165, 6.4325, 2.6167071932, 0.0996670433556, 0.0, -0.302589143628 , 0.17, 0.797336346845 );
-    drawBond( -7.61975, 2.475, 6.5575, 2.6167071932, 0.0996670433556, 0.0, -0.302589143628 , 0.17, 0.797336346845 );
-    drawBond( -7.47975, 1.8585, 6.385, 2.41726972569, -0.340757860254, 0.0, 0.0721391640325 , 0.17, 0.725016723945 );
-    drawBond( -7.57925, 1.3155, 5.915, 2.41726972569, -0.340757860254, 0.0, 0.0721391640325 , 0.17, 0.725016723945 );
-    drawBond( -7.607, 0.383, 6.045, 2.63629917786, 1.10288481175, 0.0, -0.0664752489276 , 0.17, 1.51080111199 );
-    drawBond( -7.89, -0.289, 7.11, 1.58520151892, 2.13819190907, 0.0, 0.931640760381 , 0.17, 1.52727993505 );
-    drawBond( -8.49875, -1.2825, 8.1025, 0.405421374835, -0.138992226064, 0.0, -0.144338080913 , 0.17, 0.712780646482 );
-    drawBond( -8.29625, -0.6275, 7.9075, 0.405421374835, -0.138992226064, 0.0, -0.144338080913 , 0.17, 0.712780646482 );
-    drawBond( -7.617, -0.0765, 8.25, 1.2723142706, 1.33764197303, 0.0, -1.75717513729 , 0.17, 1.52004769662 );
-    drawBond( -5.92725, -0.515, 7.64, 1.69838886093, -0.480955808781, 0.0, 0.12200717208 , 0.17, 0.707287954089 );
-    drawBond( -6.09975, -0.605, 6.96, 1.69838886093, -0.480955808781, 0.0, 0.12200717208 , 0.17, 0.707287954089 );
-    drawBond( -6.44, -0.1615, 8.335, 1.15372895128, 1.08143814955, 0.0, 1.82473648333 , 0.17, 1.52315232331 );
-    drawBond( -6.53575, -0.557, 6.5675, 1.3136593734, -0.0767952262921, 0.0, 0.511602483727 , 0.17, 0.731383107544 );
-    drawBond( -7.23525, -0.371, 6.4625, 1.3136593734, -0.0767952262921, 0.0, 0.511602483727 , 0.17, 0.731383107544 );
-    drawBond( -5.5345, -0.25975, 7.9925, 0.969935778763, 0.0185945934683, 0.0, -0.455939431842 , 0.17, 0.743783738731 );
-    drawBond( -4.9215, 0.16075, 8.0175, 0.969935778763, 0.0185945934683, 0.0, -0.455939431842 , 0.17, 0.743783738731 );
-    drawBond( -8.55125, 3.467, 6.425, 1.68761955137, 0.0811615341464, 0.0, 0.534559377174 , 0.17, 0.737832128604 );
-    drawBond( -9.27575, 3.381, 6.535, 1.68761955137, 0.0811615341464, 0.0, 0.534559377174 , 0.17, 0.737832128604 );
-    drawBond( -8.02575, 3.778, 6.5675, 0.762961367955, 0.292919400316, 0.0, -0.242121985324 , 0.17, 0.741568102065 );
-    drawBond( -7.69925, 4.314, 6.9625, 0.762961367955, 0.292919400316, 0.0, -0.242121985324 , 0.17, 0.741568102065 );
-    drawBond( -4.3085, 0.21, 8.0675, 2.05141503568, 0.0522356559258, 0.0, -0.426939427767 , 0.17, 0.696475412344 );
-    drawBond( -3.6955, -0.112, 8.1425, 2.05141503568, 0.0522356559258, 0.0, -0.426939427767 , 0.17, 0.696475412344 );
-    drawBond( -3.39056117362, -0.576332171797, 8.27703351968, 3.06701852691, 0.0278423840574, 0.0, -0.0061871964572 , 0.075, 0.61871964572 );
-    drawBond( -3.37743882638, -0.586667828203, 8.12796648032, 3.06701852691, 0.0278423840574, 0.0, -0.0061871964572 , 0.075, 0.61871964572 );
-    drawBond( -3.38056117362, -1.1933321718, 8.32203351968, 3.06701852691, 0.0278423840574, 0.0, -0.0061871964572 , 0.075, 0.61871964572 );
-    drawBond( -3.36743882638, -1.2036678282, 8.17296648032, 3.06701852691, 0.0278423840574, 0.0, -0.0061871964572 , 0.075, 0.61871964572 );
-    drawBond( -3.10675, -0.0855, 8.1925, 0.984882185688, 0.0169541707627, 0.0, -0.382825175821 , 0.17, 0.678166830507 );
-    drawBond( -2.54225, 0.2895, 8.2175, 0.984882185688, 0.0169541707627, 0.0, -0.382825175821 , 0.17, 0.678166830507 );
-    drawBond( -2.26792398315, 0.805428282692, 8.13043956552, 0.0860719002123, -0.0334739170848, 0.0, 0.0190801327383 , 0.075, 0.669478341696 );
-    drawBond( -2.28057601685, 0.815571717308, 8.27956043448, 0.0860719002123, -0.0334739170848, 0.0, 0.0190801327383 , 0.075, 0.669478341696 );
-    drawBond( -2.29642398315, 1.47242828269, 8.08043956552, 0.0860719002123, -0.0334739170848, 0.0, 0.0190801327383 , 0.075, 0.669478341696 );
-    drawBond( -2.30907601685, 1.48257171731, 8.22956043448, 0.0860719002123, -0.0334739170848, 0.0, 0.0190801327383 , 0.075, 0.669478341696 );
-    drawBond( -2.03375, 1.9815, 8.1425, 1.02938002788, 0.0165421478729, 0.0, -0.3748450708 , 0.17, 0.661685914917 );
-    drawBond( -1.46725, 2.3225, 8.1675, 1.02938002788, 0.0165421478729, 0.0, -0.3748450708 , 0.17, 0.661685914917 );
-    drawBond( -2.94, 2.153, 8.055, 1.07178343162, -0.21439360998, 0.0, 1.78089625357 , 0.17, 1.4292907332 );
-    drawBond( -4.12963219245, 2.11387745274, 8.02954679183, 2.17383015173, -0.068060340875, 0.0, 1.5245516356 , 0.075, 1.3612068175 );
-    drawBond( -4.11636780755, 2.10412254726, 7.88045320817, 2.17383015173, -0.068060340875, 0.0, 1.5245516356 , 0.075, 1.3612068175 );
-    drawBond( -4.666, 1.385, 7.955, 3.05238497999, 0.0339349377486, 0.0, -0.023075757669 , 0.17, 0.678698754972 );
-    drawBond( -4.632, 0.709, 8.005, 3.05238497999, 0.0339349377486, 0.0, -0.023075757669 , 0.17, 0.678698754972 );
-    drawBond( -5.66175, -1.2035, 8.2935, 0.457496190743, -0.113915976765, 0.0, 0.0651337761884 , 0.17, 0.545052520405 );
-    drawBond( -5.78125, -0.7145, 8.0845, 0.457496190743, -0.113915976765, 0.0, 0.0651337761884 , 0.17, 0.545052520405 );
-    drawBond( -7.12225, -0.129, 9.455, 1.22642149005, -0.277955263712, 0.0, -0.0302480728157 , 0.17, 0.545010321003 );
-    drawBond( -7.06675, 0.055, 8.945, 1.22642149005, -0.277955263712, 0.0, -0.0302480728157 , 0.17, 0.545010321003 );
-    drawBond( -8.83325, 0.20775, 7.86175, 2.24121294209, -0.0187960974191, 0.0, -0.231818534835 , 0.17, 0.544814417944 );
-    drawBond( -8.40775, -0.13075, 7.82725, 2.24121294209, -0.0187960974191, 0.0, -0.231818534835 , 0.17, 0.544814417944 );
-    drawBond( -7.99675, -0.824, 5.96225, 0.839310721469, 0.16266154888, 0.0, -0.149583233392 , 0.17, 0.544929811994 );
-    drawBond( -7.72225, -0.46, 6.26075, 0.839310721469, 0.16266154888, 0.0, -0.149583233392 , 0.17, 0.544929811994 );
-    drawBond( -7.0395, 1.05825, 5.11375, 1.58822780072, 0.205744599648, 0.0, 0.214192391157 , 0.17, 0.545018807015 );
-    drawBond( -7.4325, 1.04875, 5.49125, 1.58822780072, 0.205744599648, 0.0, 0.214192391157 , 0.17, 0.545018807015 );
-    drawBond( -1.19375, 3.26325, 8.1245, 3.06856480157, 0.0190502756279, 0.0, -0.00334667004274 , 0.17, 0.514872314268 );
-    drawBond( -1.18725, 2.74975, 8.1615, 3.06856480157, 0.0190502756279, 0.0, -0.00334667004274 , 0.17, 0.514872314268 );
-    drawBond( -0.512, 2.12025, 8.26475, 1.06770116771, -0.0291207215592, 0.0, 0.230904128469 , 0.17, 0.515411001047 );
-    drawBond( -0.96, 2.36875, 8.20825, 1.06770116771, -0.0291207215592, 0.0, 0.230904128469 , 0.17, 0.515411001047 );
-    drawBond( -5.412, 2.0815, 7.83775, 2.0247000514, 0.0335216890731, 0.0, -0.264903103894 , 0.17, 0.545068115009 );
-    drawBond( -4.926, 1.8425, 7.89925, 2.0247000514, 0.0335216890731, 0.0, -0.264903103894 , 0.17, 0.545068115009 );
-    drawBond( -3.60125, 3.31025, 7.92675, 3.06134353058, 0.0193565438725, 0.0, -0.0139039963028 , 0.17, 0.545254756971 );
-    drawBond( -3.57575, 2.76675, 7.96225, 3.06134353058, 0.0193565438725, 0.0, -0.0139039963028 , 0.17, 0.545254756971 );
-    drawBond( -8.33175, -2.14075, 9.8125, 2.00506178428, 0.0996745877218, 0.0, -0.568145150014 , 0.17, 0.797396701774 );
-    drawBond( -7.61925, -2.47625, 9.9375, 2.00506178428, 0.0996745877218, 0.0, -0.568145150014 , 0.17, 0.797396701774 );
-    drawBond( -7.14375, -2.89275, 9.765, 2.32736006113, -0.340640910124, 0.0, -0.172857142691 , 0.17, 0.724767893881 );
-    drawBond( -6.90525, -3.39025, 9.295, 2.32736006113, -0.340640910124, 0.0, -0.172857142691 , 0.17, 0.724767893881 );
-    drawBond( -6.3795, -4.161, 9.425, 2.33343227792, 1.10319521595, 0.0, -1.22862700078 , 0.17, 1.51122632322 );
-    drawBond( -6.213, -4.8715, 10.49, 1.82022152247, 2.1381667007, 0.0, 0.733085725954 , 0.17, 1.52726192907 );
-    drawBond( -6.12225, -6.0335, 11.4825, 0.425804359184, -0.138963497568, 0.0, 0.15713564725 , 0.17, 0.71263332086 );
-    drawBond( -6.34275, -5.3845, 11.2875, 0.425804359184, -0.138963497568, 0.0, 0.15713564725 , 0.17, 0.71263332086 );
-    drawBond( -6.117, -4.539, 11.63, 0.815744490658, 1.33799015362, 0.0, -1.02173793549 , 0.17, 1.52044335639 );
-    drawBond( -4.49225, -3.901, 11.02, 1.81938290228, -0.480908696948, 0.0, 0.0611744151264 , 0.17, 0.707218671982 );
-    drawBond( -4.57875, -4.075, 10.34, 1.81938290228, -0.480908696948, 0.0, 0.0611744151264 , 0.17, 0.707218671982 );
-    drawBond( -5.115, -3.916, 11.715, 1.70513431525, 1.08142579681, 0.0, 2.02881572021 , 0.17, 1.52313492508 );
-    drawBond( -4.95975, -4.29225, 9.9475, 1.93487289258, -0.0768141922922, 0.0, 0.494171303746 , 0.17, 0.731563736116 );
-    drawBond( -5.63525, -4.55275, 9.8425, 1.93487289258, -0.0768141922922, 0.0, 0.494171303746 , 0.17, 0.731563736116 );
-    drawBond( -4.32475, -3.4635, 11.3725, 0.342261139952, 0.0186040696153, 0.0, -0.184924451976 , 0.17, 0.744162784611 );
-    drawBond( -4.07625, -2.7625, 11.3975, 0.342261139952, 0.0186040696153, 0.0, -0.184924451976 , 0.17, 0.744162784611 );
-    drawBond( -8.95575, -2.221, 9.805, 2.30762617419, 0.0811973067595, 0.0, 0.395283252452 , 0.17, 0.738157334177 );
-    drawBond( -9.49125, -2.717, 9.915, 2.30762617419, 0.0811973067595, 0.0, 0.395283252452 , 0.17, 0.738157334177 );
-    drawBond( -8.7135, -1.6605, 9.9475, 0.567357055118, 0.292740306885, 0.0, 0.0377968497497 , 0.17, 0.741114700974 );
-    drawBond( -8.7645, -1.0355, 10.3425, 0.567357055118, 0.292740306885, 0.0, 0.0377968497497 , 0.17, 0.741114700974 );
-    drawBond( -3.61225, -2.3665, 11.4475, 1.43846068177, 0.0517242463091, 0.0, -0.468621671561 , 0.17, 0.689656617455 );
-    drawBond( -2.93275, -2.2755, 11.5225, 1.43846068177, 0.0517242463091, 0.0, -0.468621671561 , 0.17, 0.689656617455 );
-    drawBond( -2.40523994706, -2.46193582792, 11.6570453179, 2.43741181518, 0.0274259864226, 0.0, -0.238910815059 , 0.075, 0.609466364946 );
-    drawBond( -2.38876005294, -2.46256417208, 11.5079546821, 2.43741181518, 0.0274259864226, 0.0, -0.238910815059 , 0.075, 0.609466364946 );
-    drawBond( -2.01323994706, -2.92643582792, 11.7020453179, 2.43741181518, 0.0274259864226, 0.0, -0.238910815059 , 0.075, 0.609466364946 );
-    drawBond( -1.99676005294, -2.92706417208, 11.5529546821, 2.43741181518, 0.0274259864226, 0.0, -0.238910815059 , 0.075, 0.609466364946 );
-    drawBond( -2.48875, -1.901, 11.57, 0.308181671376, 0.0138106661679, 0.0, -0.1439761948 , 0.17, 0.690533308393 );
-    drawBond( -2.28025, -1.243, 11.59, 0.308181671376, 0.0138106661679, 0.0, -0.1439761948 , 0.17, 0.690533308393 );
-    drawBond( -2.37525, -0.63475, 11.5775, 0.622739750146, -0.0309405516677, 0.0, 0.273995774213 , 0.17, 0.687567814837 );
-    drawBond( -2.77375, -0.07625, 11.5325, 0.622739750146, -0.0309405516677, 0.0, 0.273995774213 , 0.17, 0.687567814837 );
-    drawBond( -2.85853686228, 0.486730174728, 11.5970677979, 0.409757156147, 0.0154543480937, 0.0, -0.151452611318 , 0.075, 0.618173923746 );
-    drawBond( -2.84246313772, 0.486269825272, 11.4479322021, 0.409757156147, 0.0154543480937, 0.0, -0.151452611318 , 0.075, 0.618173923746 );
-    drawBond( -2.61353686228, 1.05373017473, 11.6220677979, 0.409757156147, 0.0154543480937, 0.0, -0.151452611318 , 0.075, 0.618173923746 );
-    drawBond( -2.59746313772, 1.05326982527, 11.4729322021, 0.409757156147, 0.0154543480937, 0.0, -0.151452611318 , 0.075, 0.618173923746 );
-    drawBond( -3.676, 0.0595, 11.435, 1.77104922829, -0.216421723725, 0.0, 2.02859295705 , 0.17, 1.4428114915 );
-    drawBond( -4.59263890047, -0.720199434786, 11.2604677719, 2.8037931737, -0.0674095690535, 0.0, 0.598596973195 , 0.075, 1.34819138107 );
-    drawBond( -4.60936109953, -0.719800565214, 11.4095322281, 2.8037931737, -0.0674095690535, 0.0, 0.598596973195 , 0.075, 1.34819138107 );
-    drawBond( -4.60525, -1.62, 11.335, 2.44868929233, 0.0343126889795, 0.0, -0.298863521011 , 0.17, 0.686253779589 );
-    drawBond( -4.16975, -2.148, 11.385, 2.44868929233, 0.0343126889795, 0.0, -0.298863521011 , 0.17, 0.686253779589 );
-    drawBond( -4.8325, 0.5105, 11.305, 0.655183209783, -0.16494389046, 0.0, 1.36003735134 , 0.17, 1.49948991327 );
-    drawBond( -3.873, -4.3015, 11.6735, 0.931545381579, -0.113854560392, 0.0, 0.20918732627 , 0.17, 0.544758662162 );
-    drawBond( -4.257, -3.9765, 11.4645, 0.931545381579, -0.113854560392, 0.0, 0.20918732627 , 0.17, 0.544758662162 );
-    drawBond( -5.6865, -4.291, 12.835, 1.23041076975, -0.278028594393, 0.0, 0.0343447087191 , 0.17, 0.545154106652 );
-    drawBond( -5.7495, -4.109, 12.325, 1.23041076975, -0.278028594393, 0.0, 0.0343447087191 , 0.17, 0.545154106652 );
-    drawBond( -7.26825, -5.02475, 11.24175, 1.61392099434, -0.0188059734177, 0.0, -0.296262218914 , 0.17, 0.545100678774 );
-    drawBond( -6.72475, -5.04825, 11.20725, 1.61392099434, -0.0188059734177, 0.0, -0.296262218914 , 0.17, 0.545100678774 );
-    drawBond( -5.98575, -5.367, 9.34225, 0.579791581379, 0.162705912765, 0.0, -0.00463316669515 , 0.17, 0.545078434723 );
-    drawBond( -5.97725, -4.911, 9.64075, 0.579791581379, 0.162705912765, 0.0, -0.00463316669515 , 0.17, 0.545078434723 );
-    drawBond( -6.3165, -3.28125, 8.49375, 2.02346829424, 0.205852622608, 0.0, 0.170680452652 , 0.17, 0.54530496055 );
-    drawBond( -6.6295, -3.51975, 8.87125, 2.02346829424, 0.205852622608, 0.0, 0.170680452652 , 0.17, 0.54530496055 );
-    drawBond( -1.41775, -0.79325, 11.681, 1.7278397635, -0.0277943460798, 0.0, 0.260185961913 , 0.17, 0.514710112588 );
-    drawBond( -1.92325, -0.87375, 11.627, 1.7278397635, -0.0277943460798, 0.0, 0.260185961913 , 0.17, 0.514710112588 );
-    drawBond( -5.6225, -1.5, 11.2185, 1.39372597589, 0.0332450559632, 0.0, -0.29048548899 , 0.17, 0.54500091743 );
-    drawBond( -5.0895, -1.404, 11.2795, 1.39372597589, 0.0332450559632, 0.0, -0.29048548899 , 0.17, 0.54500091743 );
-    drawBond( -4.83825, 1.7875, 11.22, 2.55995269806, 0.010890863143, 0.0, 0.16254613241 , 0.17, 0.544543157151 );
-    drawBond( -5.13675, 1.3325, 11.24, 2.55995269806, 0.010890863143, 0.0, 0.16254613241 , 0.17, 0.544543157151 );
-    drawBond( -5.48225, -6.62925, 13.1925, 1.38472454142, 0.0996622029031, 0.0, -0.616709711565 , 0.17, 0.797297623225 );
-    drawBond( -4.70875, -6.48175, 13.3175, 1.38472454142, 0.0996622029031, 0.0, -0.616709711565 , 0.17, 0.797297623225 );
-    drawBond( -4.07925, -6.539, 13.145, 1.94067984183, -0.340629804663, 0.0, -0.351863340775 , 0.17, 0.724744265241 );
-    drawBond( -3.59375, -6.801, 12.675, 1.94067984183, -0.340629804663, 0.0, -0.351863340775 , 0.17, 0.724744265241 );
-    drawBond( -2.7155, -7.116, 12.805, 1.81678254959, 1.10318555488, 0.0, -1.92075183597 , 0.17, 1.51121308888 );
-    drawBond( -2.1635, -7.5935, 13.87, 1.96530408558, 2.13813415857, 0.0, 0.255048860343 , 0.17, 1.52723868469 );
-    drawBond( -1.40625, -8.4795, 14.8625, 0.983534459308, -0.139013289855, 0.0, 0.399574097249 , 0.17, 0.712888665922 );
-    drawBond( -1.96675, -8.0845, 14.6675, 0.983534459308, -0.139013289855, 0.0, 0.399574097249 , 0.17, 0.712888665922 );
-    drawBond( -2.281, -7.268, 15.01, 0.619359788328, 1.33796700228, 0.0, 0.103388359267 , 0.17, 1.52041704805 );
-    drawBond( -1.34175, -5.796, 14.4, 1.84568738661, -0.480986573201, 0.0, -0.0229883288662 , 0.17, 0.707333195884 );
-    drawBond( -1.30925, -5.988, 13.72, 1.84568738661, -0.480986573201, 0.0, -0.0229883288662 , 0.17, 0.707333195884 );
-    drawBond( -1.8365, -6.1745, 15.095, 2.24333670456, 1.08156796134, 0.0, 1.45783174508 , 0.17, 1.52333515682 );
-    drawBond( -1.46325, -5.34375, 14.7525, 0.289175324499, 0.0185841246095, 0.0, 0.156478329212 , 0.17, 0.743364984378 );
-    drawBond( -1.67375, -4.63125, 14.7775, 0.289175324499, 0.0185841246095, 0.0, 0.156478329212 , 0.17, 0.743364984378 );
-    drawBond( -1.48975, -6.388, 13.3275, 2.55139031242, -0.0768390007174, 0.0, 0.287963302688 , 0.17, 0.731800006832 );
-    drawBond( -1.88325, -6.996, 13.2225, 2.55139031242, -0.0768390007174, 0.0, 0.287963302688 , 0.17, 0.731800006832 );
-    drawBond( -5.94, -7.061, 13.185, 2.89579677354, 0.0812005665005, 0.0, 0.104822549482 , 0.17, 0.738186968186 );
-    drawBond( -6.082, -7.777, 13.295, 2.89579677354, 0.0812005665005, 0.0, 0.104822549482 , 0.17, 0.738186968186 );
-    drawBond( -6.07325, -6.465, 13.3275, 0.873502098725, 0.2927995284, 0.0, 0.30280660089 , 0.17, 0.741264628861 );
-    drawBond( -6.48175, -5.989, 13.7225, 0.873502098725, 0.2927995284, 0.0, 0.30280660089 , 0.17, 0.741264628861 );
-    drawBond( 0.37075, -1.12425, 15.1775, 2.62640812608, -0.00332394156086, 0.0, -0.217718172236 , 0.17, 0.664788312172 );
-    drawBond( 0.69825, -1.70275, 15.1725, 2.62640812608, -0.00332394156086, 0.0, -0.217718172236 , 0.17, 0.664788312172 );
-    drawBond( 0.738318290642, -2.30257709875, 15.2145385862, 2.76632938883, -0.0394664224373, 0.0, 0.153590160652 , 0.075, 0.657773707288 );
-    drawBond( 0.752181709358, -2.29342290125, 15.0654614138, 2.76632938883, -0.0394664224373, 0.0, 0.153590160652 , 0.075, 0.657773707288 );
-    drawBond( 0.504818290642, -2.91457709875, 15.1545385862, 2.76632938883, -0.0394664224373, 0.0, 0.153590160652 , 0.075, 0.657773707288 );
-    drawBond( 0.518681709358, -2.90542290125, 15.0054614138, 2.76632938883, -0.0394664224373, 0.0, 0.153590160652 , 0.075, 0.657773707288 );
-    drawBond( 0.06, -3.21025, 15.02, 1.55370222664, -0.0403667697494, 0.0, 0.450762262201 , 0.17, 0.672779495823 );
-    drawBond( -0.61, -3.19875, 14.96, 1.55370222664, -0.0403667697494, 0.0, 0.450762262201 , 0.17, 0.672779495823 );
-    drawBond( -1.34625674663, -2.64136687926, 14.8554475873, 0.64086336579, 0.0, 0.0, 1.11368067432 , 0.075, 1.36480474794 );
-    drawBond( -1.35974325337, -2.65063312074, 15.0045524127, 0.64086336579, 0.0, 0.0, 1.11368067432 , 0.075, 1.36480474794 );
-    drawBond( -1.1535, -3.4635, 14.895, 2.47818511031, -0.0480645711517, 0.0, 0.286327516718 , 0.17, 0.686636730739 );
-    drawBond( -1.5705, -4.0045, 14.825, 2.47818511031, -0.0480645711517, 0.0, 0.286327516718 , 0.17, 0.686636730739 );
-    drawBond( -1.445, -1.472, 14.995, 0.475210938442, 0.183334110301, 0.0, -0.89128582854 , 0.17, 1.41026238693 );
-    drawBond( -2.0925, -2.19025, 14.8925, 1.83778556356, -0.0518802843694, 0.0, 0.458621713825 , 0.17, 0.691737124925 );
-    drawBond( -2.7555, -2.37275, 14.8175, 1.83778556356, -0.0518802843694, 0.0, 0.458621713825 , 0.17, 0.691737124925 );
-    drawBond( -1.29725, -0.55425, 15.0625, 0.524640233994, 0.00335931354595, 0.0, 0.226081801642 , 0.17, 0.67186270919 );
-    drawBond( -1.63375, 0.02725, 15.0675, 0.524640233994, 0.00335931354595, 0.0, 0.226081801642 , 0.17, 0.67186270919 );
-    drawBond( -2.7285, -3.8895, 14.73, 1.95577308762, 0.0273740899392, 0.0, -0.433194973288 , 0.17, 0.68435224848 );
-    drawBond( -2.0955, -4.1465, 14.77, 1.95577308762, 0.0273740899392, 0.0, -0.433194973288 , 0.17, 0.68435224848 );
-    drawBond( -3.0488695447, -3.43225366803, 14.6529290881, 0.0628571984286, 0.022742413158, 0.0, 0.0136454478948 , 0.075, 0.649783233086 );
-    drawBond( -3.0621304553, -3.44124633197, 14.8020709119, 0.0628571984286, 0.022742413158, 0.0, 0.0136454478948 , 0.075, 0.649783233086 );
-    drawBond( -3.0698695447, -2.78375366803, 14.6879290881, 0.0628571984286, 0.022742413158, 0.0, 0.0136454478948 , 0.075, 0.649783233086 );
-    drawBond( -3.0831304553, -2.79274633197, 14.8370709119, 0.0628571984286, 0.022742413158, 0.0, 0.0136454478948 , 0.075, 0.649783233086 );
-    drawBond( -0.133639658738, -0.841925051543, 15.2245743454, 1.57825120663, -0.0402424701031, 0.0, 0.448032833815 , 0.075, 0.670707835052 );
-    drawBond( -0.120360341262, -0.833074948457, 15.0754256546, 1.57825120663, -0.0402424701031, 0.0, 0.448032833815 , 0.075, 0.670707835052 );
-    drawBond( -0.801639658738, -0.846925051543, 15.1645743454, 1.57825120663, -0.0402424701031, 0.0, 0.448032833815 , 0.075, 0.670707835052 );
-    drawBond( -0.788360341262, -0.838074948457, 15.0154256546, 1.57825120663, -0.0402424701031, 0.0, 0.448032833815 , 0.075, 0.670707835052 );
-    drawBond( -0.605, -5.75625, 15.0535, 1.50194226771, -0.113917702273, 0.0, 0.273620509767 , 0.17, 0.545060776428 );
-    drawBond( -1.107, -5.71875, 14.8445, 1.50194226771, -0.113917702273, 0.0, 0.273620509767 , 0.17, 0.545060776428 );
-    drawBond( -2.078, -6.814, 16.215, 1.36761355022, -0.27801502909, 0.0, 0.0861301462672 , 0.17, 0.54512750802 );
-    drawBond( -2.236, -6.704, 15.705, 1.36761355022, -0.27801502909, 0.0, 0.0861301462672 , 0.17, 0.54512750802 );
-    drawBond( -2.92725, -8.337, 14.62175, 0.987691183232, -0.0187970393447, 0.0, -0.247085720081 , 0.17, 0.544841720135 );
-    drawBond( -2.47375, -8.037, 14.58725, 0.987691183232, -0.0187970393447, 0.0, -0.247085720081 , 0.17, 0.544841720135 );
-    drawBond( -1.68775, -7.86025, 12.72225, 0.815691191394, 0.162672024777, 0.0, 0.142508323214 , 0.17, 0.544964907127 );
-    drawBond( -1.94925, -7.48675, 13.02075, 0.815691191394, 0.162672024777, 0.0, 0.142508323214 , 0.17, 0.544964907127 );
-    drawBond( -3.1815, -6.368, 11.87375, 2.33275899061, 0.205608018315, 0.0, 0.0615462412439 , 0.17, 0.544657002158 );
-    drawBond( -3.2945, -6.744, 12.25125, 2.33275899061, 0.205608018315, 0.0, 0.0615462412439 , 0.17, 0.544657002158 );
-    drawBond( -1.4195, 0.9855, 15.1435, 2.61338100548, -0.0252457491669, 0.0, 0.131380939542 , 0.17, 0.515219370754 );
-    drawBond( -1.6745, 0.5405, 15.0945, 2.61338100548, -0.0252457491669, 0.0, 0.131380939542 , 0.17, 0.515219370754 );
-    drawBond( -2.5715, 0.3195, 15.0025, 1.57273818541, 0.0231736892833, 0.0, -0.26418005783 , 0.17, 0.514970872963 );
-    drawBond( -2.0585, 0.3185, 15.0475, 1.57273818541, 0.0231736892833, 0.0, -0.26418005783 , 0.17, 0.514970872963 );
-    drawBond( -3.7125, -4.22675, 14.626, 0.965261841787, 0.030548051329, 0.0, -0.242747907883 , 0.17, 0.54550091659 );
-    drawBond( -3.2675, -3.91625, 14.682, 0.965261841787, 0.030548051329, 0.0, -0.242747907883 , 0.17, 0.54550091659 );
-    drawBond( 1.6735, -1.93425, 15.25025, 1.6414973559, -0.0291575245413, 0.0, 0.294845248165 , 0.17, 0.545000458715 );
-    drawBond( 1.1325, -1.97275, 15.19675, 1.6414973559, -0.0291575245413, 0.0, 0.294845248165 , 0.17, 0.545000458715 );
-    drawBond( 4.28225, -7.67475, -15.0725, 1.55260794655, 0.617873580061, 0.0, -0.148688287331 , 0.17, 0.797256232337 );
-    drawBond( 4.46875, -7.66025, -14.2975, 1.55260794655, 0.617873580061, 0.0, -0.148688287331 , 0.17, 0.797256232337 );
-    drawBond( 7.97525, -3.69225, -11.6925, 1.41781170562, 0.617910518148, 0.0, -0.11361580495 , 0.17, 0.797303894384 );
-    drawBond( 8.11775, -3.57075, -10.9175, 1.41781170562, 0.617910518148, 0.0, -0.11361580495 , 0.17, 0.797303894384 );
-    drawBond( 8.622, 1.70075, -8.3125, 1.34110573097, 0.617818047269, 0.0, -0.0350761213933 , 0.17, 0.797184577121 );
-    drawBond( 8.666, 1.88225, -7.5375, 1.34110573097, 0.617818047269, 0.0, -0.0350761213933 , 0.17, 0.797184577121 );
-    drawBond( 5.97625, 6.44425, -4.9325, 1.35268284821, 0.617813307915, 0.0, 0.0569982600206 , 0.17, 0.797178461826 );
-    drawBond( 5.90475, 6.61675, -4.1575, 1.35268284821, 0.617813307915, 0.0, 0.0569982600206 , 0.17, 0.797178461826 );
-    drawBond( 1.0465, 8.726, -1.5525, 1.44755259042, 0.617821328338, 0.0, 0.126753020911 , 0.17, 0.797188810759 );
-    drawBond( 0.8875, 8.824, -0.7775, 1.44755259042, 0.617821328338, 0.0, 0.126753020911 , 0.17, 0.797188810759 );
-    drawBond( -4.28225, 7.67475, 1.8275, 1.58898470704, 0.617873580061, 0.0, 0.148688287331 , 0.17, 0.797256232337 );
-    drawBond( -4.46875, 7.66025, 2.6025, 1.58898470704, 0.617873580061, 0.0, 0.148688287331 , 0.17, 0.797256232337 );
-    drawBond( -7.97525, 3.69225, 5.2075, 1.72378094797, 0.617910518148, 0.0, 0.11361580495 , 0.17, 0.797303894384 );
-    drawBond( -8.11775, 3.57075, 5.9825, 1.72378094797, 0.617910518148, 0.0, 0.11361580495 , 0.17, 0.797303894384 );
-    drawBond( -8.622, -1.70075, 8.5875, 1.80048692262, 0.617818047269, 0.0, 0.0350761213933 , 0.17, 0.797184577121 );
-    drawBond( -8.666, -1.88225, 9.3625, 1.80048692262, 0.617818047269, 0.0, 0.0350761213933 , 0.17, 0.797184577121 );
-    drawBond( -5.97625, -6.44425, 11.9675, 1.78890980538, 0.617813307915, 0.0, -0.0569982600206 , 0.17, 0.797178461826 );
-    drawBond( -5.90475, -6.61675, 12.7425, 1.78890980538, 0.617813307915, 0.0, -0.0569982600206 , 0.17, 0.797178461826 );
-    drawBond( 4.61125, 7.2625, 17.2275, 2.94057350178, -0.0996312145176, 0.0, -0.0785093970399 , 0.17, 0.797049716141 );
-    drawBond( 4.70975, 6.4815, 17.1025, 2.94057350178, -0.0996312145176, 0.0, -0.0785093970399 , 0.17, 0.797049716141 );
-    drawBond( 4.95875, 5.9005, 17.275, 2.12409798679, 0.340761749797, 0.0, -0.289647487328 , 0.17, 0.725024999569 );
-    drawBond( 5.35825, 5.5195, 17.745, 2.12409798679, 0.340761749797, 0.0, -0.289647487328 , 0.17, 0.725024999569 );
-    drawBond( 5.929, 4.7815, 17.615, 2.38152000705, -1.10287732232, 0.0, -1.12100681255 , 0.17, 1.5107908525 );
-    drawBond( 6.553, 4.404, 16.55, 1.3462508746, -2.13775736696, 0.0, -0.772646591202 , 0.17, 1.52696954783 );
-    drawBond( 7.6295, 3.95825, 15.5575, 0.95699198257, 0.138975810508, 0.0, 0.391270358814 , 0.17, 0.712696464142 );
-    drawBond( 7.0805, 4.36875, 15.7525, 0.95699198257, 0.138975810508, 0.0, 0.391270358814 , 0.17, 0.712696464142 );
-    drawBond( 6.207, 4.4155, 15.41, 1.78090531141, -1.33751112862, 0.0, 1.82083901374 , 0.17, 1.5198990098 );
-    drawBond( 5.09825, 3.06725, 16.02, 1.53049114603, 0.480961697436, 0.0, -0.136154598171 , 0.17, 0.707296613876 );
-    drawBond( 5.29075, 3.09575, 16.7, 1.53049114603, 0.480961697436, 0.0, -0.136154598171 , 0.17, 0.707296613876 );
-    drawBond( 5.305, 3.655, 15.325, 0.659493630045, -1.08166163989, 0.0, -0.923221061649 , 0.17, 1.52346709843 );
-    drawBond( 5.61525, 3.391, 17.0925, 0.694829227152, 0.076819628229, 0.0, -0.333982478919 , 0.17, 0.731615506943 );
-    drawBond( 6.07175, 3.953, 17.1975, 0.694829227152, 0.076819628229, 0.0, -0.333982478919 , 0.17, 0.731615506943 );
-    drawBond( 4.63025, 3.043, 15.6675, 1.59767445673, -0.0186047247024, 0.0, 0.553304512648 , 0.17, 0.744188988094 );
-    drawBond( 3.88675, 3.023, 15.6425, 1.59767445673, -0.0186047247024, 0.0, 0.553304512648 , 0.17, 0.744188988094 );
-    drawBond( 4.8805, 7.83125, 17.235, 1.06680811408, -0.0812036398507, 0.0, -0.470242896227 , 0.17, 0.738214907734 );
-    drawBond( 5.5175, 8.18775, 17.125, 1.06680811408, -0.0812036398507, 0.0, -0.470242896227 , 0.17, 0.738214907734 );
-    drawBond( 4.27225, 7.77375, 17.0925, 1.23916176549, -0.292984443593, 0.0, 0.429834139398 , 0.17, 0.74173276859 );
-    drawBond( 3.69275, 8.01525, 16.6975, 1.23916176549, -0.292984443593, 0.0, 0.429834139398 , 0.17, 0.74173276859 );
-    drawBond( 3.36675, 2.704, 15.5925, 2.68204583834, -0.0517152736747, 0.0, 0.204447715261 , 0.17, 0.689536982329 );
-    drawBond( 3.07025, 2.086, 15.5175, 2.68204583834, -0.0517152736747, 0.0, 0.204447715261 , 0.17, 0.689536982329 );
-    drawBond( 3.08000317877, 1.51106322406, 15.5320450232, 2.58140104593, -0.0274094423739, 0.0, -0.195216139574 , 0.075, 0.609098719421 );
-    drawBond( 3.08449682123, 1.52693677594, 15.3829549768, 2.58140104593, -0.0274094423739, 0.0, -0.195216139574 , 0.075, 0.609098719421 );
-    drawBond( 3.40050317877, 0.99506322406, 15.4870450232, 2.58140104593, -0.0274094423739, 0.0, -0.195216139574 , 0.075, 0.609098719421 );
-    drawBond( 3.40499682123, 1.01093677594, 15.3379549768, 2.58140104593, -0.0274094423739, 0.0, -0.195216139574 , 0.075, 0.609098719421 );
-    drawBond( 2.577, 1.7795, 15.47, 1.5635531188, -0.0138061580463, 0.0, 0.476312452598 , 0.17, 0.690307902316 );
-    drawBond( 1.887, 1.7845, 15.45, 1.5635531188, -0.0138061580463, 0.0, 0.476312452598 , 0.17, 0.690307902316 );
-    drawBond( 1.338, 2.063, 15.4625, 0.63940057822, 0.0309550613794, 0.0, 0.280659223173 , 0.17, 0.687890252875 );
-    drawBond( 0.93, 2.615, 15.5075, 0.63940057822, 0.0309550613794, 0.0, 0.280659223173 , 0.17, 0.687890252875 );
-    drawBond( 0.420510629424, 2.86946279782, 15.4429318921, 1.66547874841, -0.0154694759931, 0.0, 0.38085849895 , 0.075, 0.618779039723 );
-    drawBond( 0.415989370576, 2.85403720218, 15.5920681079, 1.66547874841, -0.0154694759931, 0.0, 0.38085849895 , 0.075, 0.618779039723 );
-    drawBond( -0.194989370576, 2.81096279782, 15.4179318921, 1.66547874841, -0.0154694759931, 0.0, 0.38085849895 , 0.075, 0.618779039723 );
-    drawBond( -0.199510629424, 2.79553720218, 15.5670681079, 1.66547874841, -0.0154694759931, 0.0, 0.38085849895 , 0.075, 0.618779039723 );
-    drawBond( 1.08, 3.515, 15.605, 0.525509090539, 0.216399006467, 0.0, -1.02140331052 , 0.17, 1.44266004311 );
-    drawBond( 2.10460309332, 4.14548515726, 15.7795319844, 1.54926918321, 0.0673620256525, 0.0, -1.81338573057 , 0.075, 1.34724051305 );
-    drawBond( 2.10939690668, 4.16151484274, 15.6304680156, 1.54926918321, 0.0673620256525, 0.0, -1.81338573057 , 0.075, 1.34724051305 );
-    drawBond( 2.96375, 3.87925, 15.705, 2.57070158145, -0.0343169965178, 0.0, -0.252229924405 , 0.17, 0.686339930355 );
-    drawBond( 3.33125, 3.30175, 15.655, 2.57070158145, -0.0343169965178, 0.0, -0.252229924405 , 0.17, 0.686339930355 );
-    drawBond( 1.0085, 4.754, 15.735, 0.609130817844, 0.164970700732, 0.0, 1.27627333021 , 0.17, 1.49973364302 );
-    drawBond( 5.28775, 2.354, 15.3665, 0.54544070942, 0.113924604047, 0.0, 0.103840368761 , 0.17, 0.545093799268 );
-    drawBond( 5.09725, 2.82, 15.5755, 0.54544070942, 0.113924604047, 0.0, 0.103840368761 , 0.17, 0.545093799268 );
-    drawBond( 5.83825, 4.08225, 14.205, 1.35544963846, 0.278048005657, 0.0, 0.0836869977811 , 0.17, 0.545192167955 );
-    drawBond( 5.68475, 4.19875, 14.715, 1.35544963846, 0.278048005657, 0.0, 0.0836869977811 , 0.17, 0.545192167955 );
-    drawBond( 7.02425, 5.36, 15.79825, 2.86361062482, 0.0187996986445, 0.0, 0.0792856855878 , 0.17, 0.544918801291 );
-    drawBond( 6.87875, 4.836, 15.83275, 2.86361062482, 0.0187996986445, 0.0, 0.0792856855878 , 0.17, 0.544918801291 );
-    drawBond( 6.954, 4.0345, 17.69775, 1.32421172099, -0.162644772346, 0.0, 0.23756489361 , 0.17, 0.544873609198 );
-    drawBond( 6.518, 4.1675, 17.39925, 1.32421172099, -0.162644772346, 0.0, 0.23756489361 , 0.17, 0.544873609198 );
-    drawBond( 5.07275, 4.99375, 18.54625, 1.14830656596, -0.205767195678, 0.0, -0.17633294782 , 0.17, 0.545078664048 );
-    drawBond( 5.39625, 5.21725, 18.16875, 1.14830656596, -0.205767195678, 0.0, -0.17633294782 , 0.17, 0.545078664048 );
-    drawBond( 1.1925, 1.103, 15.359, 0.483061263994, 0.0278055957678, 0.0, -0.119975996554 , 0.17, 0.514918440144 );
-    drawBond( 1.4255, 1.559, 15.413, 0.483061263994, 0.0278055957678, 0.0, -0.119975996554 , 0.17, 0.514918440144 );
-    drawBond( 3.164, 4.8835, 15.8215, 2.63743499591, -0.033231622079, 0.0, 0.139463856594 , 0.17, 0.544780689819 );
-    drawBond( 2.908, 4.4065, 15.7605, 2.63743499591, -0.033231622079, 0.0, 0.139463856594 , 0.17, 0.544780689819 );
-    drawBond( 1.0615, 6.03125, 15.8005, 2.5157866312, -0.00381311949066, 0.0, 0.173769302503 , 0.17, 0.544731355808 );
-    drawBond( 0.7425, 5.58975, 15.7935, 2.5157866312, -0.00381311949066, 0.0, 0.173769302503 , 0.17, 0.544731355808 );
-    drawBond( 7.99925, 3.165, 13.8475, 2.6167071932, -0.0996670433556, 0.0, 0.302589143628 , 0.17, 0.797336346845 );
-    drawBond( 7.61975, 2.475, 13.7225, 2.6167071932, -0.0996670433556, 0.0, 0.302589143628 , 0.17, 0.797336346845 );
-    drawBond( 7.47975, 1.85875, 13.895, 2.41681251493, 0.340581893016, 0.0, -0.0721019113937 , 0.17, 0.724642325565 );
-    drawBond( 7.57925, 1.31625, 14.365, 2.41681251493, 0.340581893016, 0.0, -0.0721019113937 , 0.17, 0.724642325565 );
-    drawBond( 7.607, 0.3835, 14.235, 2.63661939476, -1.10352364202, 0.0, 0.0665137537658 , 0.17, 1.51167622195 );
-    drawBond( 7.89, -0.289, 13.17, 1.58520151892, -2.13819190907, 0.0, -0.931640760381 , 0.17, 1.52727993505 );
-    drawBond( 8.49875, -1.2825, 12.1775, 0.405421374835, 0.138992226064, 0.0, 0.144338080913 , 0.17, 0.712780646482 );
-    drawBond( 8.29625, -0.6275, 12.3725, 0.405421374835, 0.138992226064, 0.0, 0.144338080913 , 0.17, 0.712780646482 );
-    drawBond( 7.617, -0.0765, 12.03, 1.2723142706, -1.33764197303, 0.0, 1.75717513729 , 0.17, 1.52004769662 );
-    drawBond( 5.92725, -0.515, 12.64, 1.69838886093, 0.480955808781, 0.0, -0.12200717208 , 0.17, 0.707287954089 );
-    drawBond( 6.09975, -0.605, 13.32, 1.69838886093, 0.480955808781, 0.0, -0.12200717208 , 0.17, 0.707287954089 );
-    drawBond( 6.44, -0.1615, 11.945, 1.15372895128, -1.08143814955, 0.0, -1.82473648333 , 0.17, 1.52315232331 );
-    drawBond( 5.5345, -0.25975, 12.2875, 0.969935778763, -0.0185945934683, 0.0, 0.455939431842 , 0.17, 0.743783738731 );
-    drawBond( 4.9215, 0.16075, 12.2625, 0.969935778763, -0.0185945934683, 0.0, 0.455939431842 , 0.17, 0.743783738731 );
-    drawBond( 6.53575, -0.557, 13.7125, 1.3136593734, 0.0767952262921, 0.0, -0.511602483727 , 0.17, 0.731383107544 );
-    drawBond( 7.23525, -0.371, 13.8175, 1.3136593734, 0.0767952262921, 0.0, -0.511602483727 , 0.17, 0.731383107544 );
-    drawBond( 8.55125, 3.467, 13.855, 1.68761955137, -0.0811615341464, 0.0, -0.534559377174 , 0.17, 0.737832128604 );
-    drawBond( 9.27575, 3.381, 13.745, 1.68761955137, -0.0811615341464, 0.0, -0.534559377174 , 0.17, 0.737832128604 );
-    drawBond( 8.02575, 3.778, 13.7125, 0.762961367955, -0.292919400316, 0.0, 0.242121985324 , 0.17, 0.741568102065 );
-    drawBond( 7.69925, 4.314, 13.3175, 0.762961367955, -0.292919400316, 0.0, 0.242121985324 , 0.17, 0.741568102065 );
-    drawBond( 0.9545, -0.7, 11.8625, 2.39979936354, 0.00332312353065, 0.0, -0.298416493053 , 0.17, 0.664624706131 );
-    drawBond( 1.4035, -1.19, 11.8675, 2.39979936354, 0.00332312353065, 0.0, -0.298416493053 , 0.17, 0.664624706131 );
-    drawBond( 1.94875671799, -1.42368146227, 11.9745385114, 1.52062882603, 0.0394843424663, 0.0, -0.43070836907 , 0.075, 0.658072374439 );
-    drawBond( 1.96174328201, -1.41331853773, 11.8254614886, 1.52062882603, 0.0394843424663, 0.0, -0.43070836907 , 0.075, 0.658072374439 );
-    drawBond( 2.60325671799, -1.39068146227, 12.0345385114, 1.52062882603, 0.0394843424663, 0.0, -0.43070836907 , 0.075, 0.658072374439 );
-    drawBond( 2.61624328201, -1.38031853773, 11.8854614886, 1.52062882603, 0.0394843424663, 0.0, -0.43070836907 , 0.075, 0.658072374439 );
-    drawBond( 3.035, -1.04875, 12.02, 0.309728504356, 0.04035, 0.0, -0.13181 , 0.17, 0.6725 );
-    drawBond( 3.231, -0.40825, 12.08, 0.309728504356, 0.04035, 0.0, -0.13181 , 0.17, 0.6725 );
-    drawBond( 2.94099061654, 0.473984483725, 12.0354478167, 0.616247122955, 0.0, 0.0, 1.07706938791 , 0.075, 1.36510695552 );
-    drawBond( 2.92800938346, 0.464015516275, 12.1845521833, 0.616247122955, 0.0, 0.0, 1.07706938791 , 0.075, 1.36510695552 );
-    drawBond( 3.6505, 0.02675, 12.145, 1.22983019511, 0.0480415895345, 0.0, -0.441296315295 , 0.17, 0.686308421921 );
-    drawBond( 4.2935, 0.25625, 12.215, 1.22983019511, 0.0480415895345, 0.0, -0.441296315295 , 0.17, 0.686308421921 );
-    drawBond( 1.846, 0.9195, 12.045, 1.72241329597, -0.183332865847, 0.0, 1.95743090612 , 0.17, 1.41025281421 );
-    drawBond( 2.72925, 1.313, 12.1475, 0.591843162635, 0.0518728568834, 0.0, -0.261785017738 , 0.17, 0.691638091779 );
-    drawBond( 3.10775, 1.887, 12.2225, 0.591843162635, 0.0518728568834, 0.0, -0.261785017738 , 0.17, 0.691638091779 );
-    drawBond( 0.9275, 1.06275, 11.9775, 0.732237250211, -0.00335829662925, 0.0, 0.301575037306 , 0.17, 0.671659325849 );
-    drawBond( 0.4785, 1.56225, 11.9725, 0.732237250211, -0.00335829662925, 0.0, 0.301575037306 , 0.17, 0.671659325849 );
-    drawBond( 4.54225, 1.39325, 12.31, 3.04960512261, -0.0273757410858, 0.0, -0.0331930860666 , 0.17, 0.684393527146 );
-    drawBond( 4.59075, 0.71175, 12.27, 3.04960512261, -0.0273757410858, 0.0, -0.0331930860666 , 0.17, 0.684393527146 );
-    drawBond( 4.20642540689, 1.83908278155, 12.3870709104, 1.22544471692, -0.0227455639906, 0.0, 0.396747623322 , 0.075, 0.649873256874 );
-    drawBond( 4.21907459311, 1.84891721845, 12.2379290896, 1.22544471692, -0.0227455639906, 0.0, 0.396747623322 , 0.075, 0.649873256874 );
-    drawBond( 3.59592540689, 2.05908278155, 12.3520709104, 1.22544471692, -0.0227455639906, 0.0, 0.396747623322 , 0.075, 0.649873256874 );
-    drawBond( 3.60857459311, 2.06891721845, 12.2029290896, 1.22544471692, -0.0227455639906, 0.0, 0.396747623322 , 0.075, 0.649873256874 );
-    drawBond( 0.841760737925, -0.133051458818, 11.8154257783, 0.33310830846, 0.0402526669924, 0.0, -0.141555212256 , 0.075, 0.670877783206 );
-    drawBond( 0.829239262075, -0.142948541182, 11.9645742217, 0.33310830846, 0.0402526669924, 0.0, -0.141555212256 , 0.075, 0.670877783206 );
-    drawBond( 1.05276073793, 0.500948541182, 11.8754257783, 0.33310830846, 0.0402526669924, 0.0, -0.141555212256 , 0.075, 0.670877783206 );
-    drawBond( 1.04023926207, 0.491051458818, 12.0245742217, 0.33310830846, 0.0402526669924, 0.0, -0.141555212256 , 0.075, 0.670877783206 );
-    drawBond( 5.66175, -1.2035, 11.9865, 0.457496190743, 0.113915976765, 0.0, -0.0651337761884 , 0.17, 0.545052520405 );
-    drawBond( 5.78125, -0.7145, 12.1955, 0.457496190743, 0.113915976765, 0.0, -0.0651337761884 , 0.17, 0.545052520405 );
-    drawBond( 7.12225, -0.129, 10.825, 1.22642149005, 0.277955263712, 0.0, 0.0302480728157 , 0.17, 0.545010321003 );
-    drawBond( 7.06675, 0.055, 11.335, 1.22642149005, 0.277955263712, 0.0, 0.0302480728157 , 0.17, 0.545010321003 );
-    drawBond( 8.83325, 0.20775, 12.41825, 2.24121294209, 0.0187960974191, 0.0, 0.231818534835 , 0.17, 0.544814417944 );
-    drawBond( 8.40775, -0.13075, 12.45275, 2.24121294209, 0.0187960974191, 0.0, 0.231818534835 , 0.17, 0.544814417944 );
-    drawBond( 7.99675, -0.824, 14.31775, 0.839310721469, -0.16266154888, 0.0, 0.149583233392 , 0.17, 0.544929811994 );
-    drawBond( 7.72225, -0.46, 14.01925, 0.839310721469, -0.16266154888, 0.0, 0.149583233392 , 0.17, 0.544929811994 );
-    drawBond( 7.0395, 1.0585, 15.16625, 1.58731052615, -0.205741396179, 0.0, -0.214189056154 , 0.17, 0.545010321003 );
-    drawBond( 7.4325, 1.0495, 14.78875, 1.58731052615, -0.205741396179, 0.0, -0.214189056154 , 0.17, 0.545010321003 );
-    drawBond( -0.49825, 1.6545, 11.8965, 1.36535661014, 0.025220878816, 0.0, -0.258127974004 , 0.17, 0.514711812571 );
-    drawBond( 0.00325, 1.7595, 11.9455, 1.36535661014, 0.025220878816, 0.0, -0.258127974004 , 0.17, 0.514711812571 );
-    drawBond( 0.491, 2.54475, 12.0375, 2.81717311528, -0.023192305432, 0.0, 0.0814307612945 , 0.17, 0.515384565155 );
-    drawBond( 0.333, 2.05625, 11.9925, 2.81717311528, -0.023192305432, 0.0, 0.0814307612945 , 0.17, 0.515384565155 );
-    drawBond( 5.16675, 2.2245, 12.414, 2.2141759531, -0.0305249445536, 0.0, 0.235750687847 , 0.17, 0.5450882956 );
-    drawBond( 4.73425, 1.8975, 12.358, 2.2141759531, -0.0305249445536, 0.0, 0.235750687847 , 0.17, 0.5450882956 );
-    drawBond( 1.32275, -2.18875, 11.78975, 0.396553425028, 0.029145509117, 0.0, -0.110861889819 , 0.17, 0.544775871345 );
-    drawBond( 1.52625, -1.68625, 11.84325, 0.396553425028, 0.029145509117, 0.0, -0.110861889819 , 0.17, 0.544775871345 );
-    drawBond( 8.33175, -2.14075, 10.4675, 2.00506178428, -0.0996745877218, 0.0, 0.568145150014 , 0.17, 0.797396701774 );
-    drawBond( 7.61925, -2.47625, 10.3425, 2.00506178428, -0.0996745877218, 0.0, 0.568145150014 , 0.17, 0.797396701774 );
-    drawBond( 7.14375, -2.89275, 10.515, 2.32736006113, 0.340640910124, 0.0, 0.172857142691 , 0.17, 0.724767893881 );
-    drawBond( 6.90525, -3.39025, 10.985, 2.32736006113, 0.340640910124, 0.0, 0.172857142691 , 0.17, 0.724767893881 );
-    drawBond( 6.3795, -4.161, 10.855, 2.33343227792, -1.10319521595, 0.0, 1.22862700078 , 0.17, 1.51122632322 );
-    drawBond( 6.213, -4.8715, 9.79, 1.82022152247, -2.1381667007, 0.0, -0.733085725954 , 0.17, 1.52726192907 );
-    drawBond( 6.12225, -6.0335, 8.7975, 0.425804359184, 0.138963497568, 0.0, -0.15713564725 , 0.17, 0.71263332086 );
-    drawBond( 6.34275, -5.3845, 8.9925, 0.425804359184, 0.138963497568, 0.0, -0.15713564725 , 0.17, 0.71263332086 );
-    drawBond( 6.117, -4.539, 8.65, 0.815744490658, -1.33799015362, 0.0, 1.02173793549 , 0.17, 1.52044335639 );
-    drawBond( 4.49225, -3.901, 9.26, 1.81938290228, 0.480908696948, 0.0, -0.0611744151264 , 0.17, 0.707218671982 );
-    drawBond( 4.57875, -4.075, 9.94, 1.81938290228, 0.480908696948, 0.0, -0.0611744151264 , 0.17, 0.707218671982 );
-    drawBond( 5.115, -3.916, 8.565, 1.70513431525, -1.08142579681, 0.0, -2.02881572021 , 0.17, 1.52313492508 );
-    drawBond( 4.32475, -3.4635, 8.9075, 0.342261139952, -0.0186040696153, 0.0, 0.184924451976 , 0.17, 0.744162784611 );
-    drawBond( 4.07625, -2.7625, 8.8825, 0.342261139952, -0.0186040696153, 0.0, 0.184924451976 , 0.17, 0.744162784611 );
-    drawBond( 4.95975, -4.29225, 10.3325, 1.93487289258, 0.0768141922922, 0.0, -0.494171303746 , 0.17, 0.731563736116 );
-    drawBond( 5.63525, -4.55275, 10.4375, 1.93487289258, 0.0768141922922, 0.0, -0.494171303746 , 0.17, 0.731563736116 );
-    drawBond( 8.95575, -2.221, 10.475, 2.30762617419, -0.0811973067595, 0.0, -0.395283252452 , 0.17, 0.738157334177 );
-    drawBond( 9.49125, -2.717, 10.365, 2.30762617419, -0.0811973067595, 0.0, -0.395283252452 , 0.17, 0.738157334177 );
-    drawBond( 8.7135, -1.6605, 10.3325, 0.567357055118, -0.292740306885, 0.0, -0.0377968497497 , 0.17, 0.741114700974 );
-    drawBond( 8.7645, -1.0355, 9.9375, 0.567357055118, -0.292740306885, 0.0, -0.0377968497497 , 0.17, 0.741114700974 );
-    drawBond( 3.62275, -2.31825, 8.835, 1.29487573122, -0.0481770137099, 0.0, 0.453208050399 , 0.17, 0.688243052998 );
-    drawBond( 2.96425, -2.13075, 8.765, 1.29487573122, -0.0481770137099, 0.0, 0.453208050399 , 0.17, 0.688243052998 );
-    drawBond( 2.37125, -2.249, 8.7, 2.24470853248, -0.0407661146051, 0.0, 0.358402090904 , 0.17, 0.679435243419 );
-    drawBond( 1.84375, -2.673, 8.64, 2.24470853248, -0.0407661146051, 0.0, 0.358402090904 , 0.17, 0.679435243419 );
-    drawBond( 1.28240483977, -2.72422898663, 8.65203273755, 1.06489476375, -0.043257658715, 0.0, 0.384993162563 , 0.075, 0.665502441769 );
-    drawBond( 1.29909516023, -2.72327101337, 8.50296726245, 1.06489476375, -0.043257658715, 0.0, 0.384993162563 , 0.075, 0.665502441769 );
-    drawBond( 0.703904839771, -2.40172898663, 8.58703273755, 1.06489476375, -0.043257658715, 0.0, 0.384993162563 , 0.075, 0.665502441769 );
-    drawBond( 0.720595160229, -2.40077101337, 8.43796726245, 1.06489476375, -0.043257658715, 0.0, 0.384993162563 , 0.075, 0.665502441769 );
-    drawBond( 0.13775, -2.41075, 8.4475, 2.10734650156, -0.0434245487887, 0.0, 0.381133924368 , 0.17, 0.668069981364 );
-    drawBond( -0.43275, -2.75225, 8.3825, 2.10734650156, -0.0434245487887, 0.0, 0.381133924368 , 0.17, 0.668069981364 );
-    drawBond( 0.3955, -1.89625, 8.48, 0.0798299857122, 0.0, 0.0, 0.037933307017 , 0.17, 0.689696491219 );
-    drawBond( 0.3405, -1.20875, 8.48, 0.0798299857122, 0.0, 0.0, 0.037933307017 , 0.17, 0.689696491219 );
-    drawBond( 0.58225, -0.641, 8.51, 0.879911894885, 0.0421832964572, 0.0, -0.378595085704 , 0.17, 0.703054940954 );
-    drawBond( 1.12075, -0.193, 8.57, 0.879911894885, 0.0421832964572, 0.0, -0.378595085704 , 0.17, 0.703054940954 );
-    drawBond( 1.32818793989, 0.333757618445, 8.66956503943, 0.176308760801, -0.0061554224063, 0.0, 0.0661707908677 , 0.075, 0.61554224063 );
-    drawBond( 1.34431206011, 0.334242381555, 8.52043496057, 0.176308760801, -0.0061554224063, 0.0, 0.0661707908677 , 0.075, 0.61554224063 );
-    drawBond( 1.22068793989, 0.939757618445, 8.65956503943, 0.176308760801, -0.0061554224063, 0.0, 0.0661707908677 , 0.075, 0.61554224063 );
-    drawBond( 1.23681206011, 0.940242381555, 8.51043496057, 0.176308760801, -0.0061554224063, 0.0, 0.0661707908677 , 0.075, 0.61554224063 );
-    drawBond( 2.0045, -0.311, 8.665, 1.06529875513, -0.183626875212, 0.0, 1.73598022797 , 0.17, 1.41251442471 );
-    drawBond( 2.63505095024, -1.34479966055, 8.65543364023, 0.0115601786554, 0.0, 0.0, 0.0221454797194 , 0.075, 1.38409248246 );
-    drawBond( 2.61894904976, -1.34520033945, 8.80456635977, 0.0115601786554, 0.0, 0.0, 0.0221454797194 , 0.075, 1.38409248246 );
-    drawBond( 2.9435, -0.529, 8.765, 1.20771674172, 0.0488801033141, 0.0, -0.453188386441 , 0.17, 0.698287190202 );
-    drawBond( 3.5925, -0.281, 8.835, 1.20771674172, 0.0488801033141, 0.0, -0.453188386441 , 0.17, 0.698287190202 );
-    drawBond( 4.09462430949, -0.425649510119, 8.96455837805, 2.53368775078, 0.0261681103636, 0.0, -0.243036325002 , 0.075, 0.654202759089 );
-    drawBond( 4.11087569051, -0.425350489881, 8.81544162195, 2.53368775078, 0.0261681103636, 0.0, -0.243036325002 , 0.075, 0.654202759089 );
-    drawBond( 4.46612430949, -0.962649510119, 9.00455837805, 2.53368775078, 0.0261681103636, 0.0, -0.243036325002 , 0.075, 0.654202759089 );
-    drawBond( 4.48237569051, -0.962350489881, 8.85544162195, 2.53368775078, 0.0261681103636, 0.0, -0.243036325002 , 0.075, 0.654202759089 );
-    drawBond( 4.483, -1.52625, 8.93, 2.59874516266, -0.0275856846933, 0.0, 0.244133309536 , 0.17, 0.689642117333 );
-    drawBond( 4.129, -2.11675, 8.89, 2.59874516266, -0.0275856846933, 0.0, 0.244133309536 , 0.17, 0.689642117333 );
-    drawBond( 3.873, -4.3015, 8.6065, 0.931545381579, 0.113854560392, 0.0, -0.20918732627 , 0.17, 0.544758662162 );
-    drawBond( 4.257, -3.9765, 8.8155, 0.931545381579, 0.113854560392, 0.0, -0.20918732627 , 0.17, 0.544758662162 );
-    drawBond( 5.6865, -4.291, 7.445, 1.23041076975, 0.278028594393, 0.0, -0.0343447087191 , 0.17, 0.545154106652 );
-    drawBond( 5.7495, -4.109, 7.955, 1.23041076975, 0.278028594393, 0.0, -0.0343447087191 , 0.17, 0.545154106652 );
-    drawBond( 7.26825, -5.024, 9.03825, 1.61483736679, 0.018806724984, 0.0, 0.296274058806 , 0.17, 0.545122463305 );
-    drawBond( 6.72475, -5.048, 9.07275, 1.61483736679, 0.018806724984, 0.0, 0.296274058806 , 0.17, 0.545122463305 );
-    drawBond( 5.98575, -5.367, 10.93775, 0.579791581379, -0.162705912765, 0.0, 0.00463316669515 , 0.17, 0.545078434723 );
-    drawBond( 5.97725, -4.911, 10.63925, 0.579791581379, -0.162705912765, 0.0, 0.00463316669515 , 0.17, 0.545078434723 );
-    drawBond( 6.3165, -3.28125, 11.78625, 2.02346829424, -0.205852622608, 0.0, -0.170680452652 , 0.17, 0.54530496055 );
-    drawBond( 6.6295, -3.51975, 11.40875, 2.02346829424, -0.205852622608, 0.0, -0.170680452652 , 0.17, 0.54530496055 );
-    drawBond( -0.70825, -3.6955, 8.34475, 0.0143337979261, 0.00180268518466, 0.0, 0.00334784391437 , 0.17, 0.515052909903 );
-    drawBond( -0.71475, -3.1805, 8.34825, 0.0143337979261, 0.00180268518466, 0.0, 0.00334784391437 , 0.17, 0.515052909903 );
-    drawBond( -1.3885, -2.545, 8.28025, 2.08184213746, 0.0239587950305, 0.0, -0.230313578035 , 0.17, 0.515242903881 );
-    drawBond( -0.9415, -2.797, 8.32675, 2.08184213746, 0.0239587950305, 0.0, -0.230313578035 , 0.17, 0.515242903881 );
-    drawBond( 5.4715, -1.20475, 9.03925, 1.60293887802, -0.0324003315087, 0.0, 0.294597972205 , 0.17, 0.544543386701 );
-    drawBond( 4.9305, -1.22225, 8.97975, 1.60293887802, -0.0324003315087, 0.0, 0.294597972205 , 0.17, 0.544543386701 );
-    drawBond( -0.395, -0.56425, 8.40875, 1.97067763016, 0.0244632147954, 0.0, -0.243087102809 , 0.17, 0.515015048324 );
-    drawBond( 0.077, -0.76475, 8.45625, 1.97067763016, 0.0244632147954, 0.0, -0.243087102809 , 0.17, 0.515015048324 );
-    drawBond( 5.48225, -6.62925, 7.0875, 1.38472454142, -0.0996622029031, 0.0, 0.616709711565 , 0.17, 0.797297623225 );
-    drawBond( 4.70875, -6.48175, 6.9625, 1.38472454142, -0.0996622029031, 0.0, 0.616709711565 , 0.17, 0.797297623225 );
-    drawBond( 4.07925, -6.539, 7.135, 1.94067984183, 0.340629804663, 0.0, 0.351863340775 , 0.17, 0.724744265241 );
-    drawBond( 3.59375, -6.801, 7.605, 1.94067984183, 0.340629804663, 0.0, 0.351863340775 , 0.17, 0.724744265241 );
-    drawBond( 2.7155, -7.116, 7.475, 1.81678254959, -1.10318555488, 0.0, 1.92075183597 , 0.17, 1.51121308888 );
-    drawBond( 2.1635, -7.5935, 6.41, 1.96530408558, -2.13813415857, 0.0, -0.255048860343 , 0.17, 1.52723868469 );
-    drawBond( 1.40625, -8.4795, 5.4175, 0.983534459308, 0.139013289855, 0.0, -0.399574097249 , 0.17, 0.712888665922 );
-    drawBond( 1.96675, -8.0845, 5.6125, 0.983534459308, 0.139013289855, 0.0, -0.399574097249 , 0.17, 0.712888665922 );
-    drawBond( 2.281, -7.268, 5.27, 0.619359788328, -1.33796700228, 0.0, -0.103388359267 , 0.17, 1.52041704805 );
-    drawBond( 1.34175, -5.796, 5.88, 1.84568738661, 0.480986573201, 0.0, 0.0229883288662 , 0.17, 0.707333195884 );
-    drawBond( 1.30925, -5.988, 6.56, 1.84568738661, 0.480986573201, 0.0, 0.0229883288662 , 0.17, 0.707333195884 );
-    drawBond( 1.8365, -6.1745, 5.185, 2.24333670456, -1.08156796134, 0.0, -1.45783174508 , 0.17, 1.52333515682 );
-    drawBond( 1.48975, -6.388, 6.9525, 2.55139031242, 0.0768390007174, 0.0, -0.287963302688 , 0.17, 0.731800006832 );
-    drawBond( 1.88325, -6.996, 7.0575, 2.55139031242, 0.0768390007174, 0.0, -0.287963302688 , 0.17, 0.731800006832 );
-    drawBond( 1.46325, -5.3435, 5.5275, 0.288983643315, -0.0185961059432, 0.0, -0.156579212042 , 0.17, 0.743844237727 );
-    drawBond( 1.67375, -4.6305, 5.5025, 0.288983643315, -0.0185961059432, 0.0, -0.156579212042 , 0.17, 0.743844237727 );
-    drawBond( 5.94, -7.061, 7.095, 2.89579677354, -0.0812005665005, 0.0, -0.104822549482 , 0.17, 0.738186968186 );
-    drawBond( 6.082, -7.777, 6.985, 2.89579677354, -0.0812005665005, 0.0, -0.104822549482 , 0.17, 0.738186968186 );
-    drawBond( 6.07325, -6.465, 6.9525, 0.873502098725, -0.2927995284, 0.0, -0.30280660089 , 0.17, 0.741264628861 );
-    drawBond( 6.48175, -5.989, 6.5575, 0.873502098725, -0.2927995284, 0.0, -0.30280660089 , 0.17, 0.741264628861 );
-    drawBond( 1.531, -4.0375, 5.4525, 0.814773243045, -0.0517103108674, 0.0, 0.341977522536 , 0.17, 0.689470811565 );
-    drawBond( 1.035, -3.5645, 5.3775, 0.814773243045, -0.0517103108674, 0.0, 0.341977522536 , 0.17, 0.689470811565 );
-    drawBond( 0.498853399493, -3.40534111816, 5.24295502791, 1.81190867052, -0.0274203005317, 0.0, 0.359510606971 , 0.075, 0.609340011816 );
-    drawBond( 0.485146600507, -3.39615888184, 5.39204497209, 1.81190867052, -0.0274203005317, 0.0, 0.359510606971 , 0.075, 0.609340011816 );
-    drawBond( -0.0911466005068, -3.55084111816, 5.19795502791, 1.81190867052, -0.0274203005317, 0.0, 0.359510606971 , 0.075, 0.609340011816 );
-    drawBond( -0.104853399493, -3.54165888184, 5.34704497209, 1.81190867052, -0.0274203005317, 0.0, 0.359510606971 , 0.075, 0.609340011816 );
-    drawBond( 0.896, -3.00075, 5.33, 0.322779930171, -0.0138028149303, 0.0, -0.15045068274 , 0.17, 0.690140746515 );
-    drawBond( 1.114, -2.34625, 5.31, 0.322779930171, -0.0138028149303, 0.0, -0.15045068274 , 0.17, 0.690140746515 );
-    drawBond( 1.5485, -1.91, 5.3225, 1.2483808921, 0.0309601962203, 0.0, -0.447890838654 , 0.17, 0.688004360451 );
-    drawBond( 2.1995, -1.692, 5.3675, 1.2483808921, 0.0309601962203, 0.0, -0.447890838654 , 0.17, 0.688004360451 );
-    drawBond( 2.59913851559, -1.28603741908, 5.30293230616, 0.223870556122, -0.0154608174105, 0.0, -0.0834884140166 , 0.075, 0.618432696419 );
-    drawBond( 2.58586148441, -1.27696258092, 5.45206769384, 0.223870556122, -0.0154608174105, 0.0, -0.0834884140166 , 0.075, 0.618432696419 );
-    drawBond( 2.73413851559, -0.683037419084, 5.27793230616, 0.223870556122, -0.0154608174105, 0.0, -0.0834884140166 , 0.075, 0.618432696419 );
-    drawBond( 2.72086148441, -0.673962580916, 5.42706769384, 0.223870556122, -0.0154608174105, 0.0, -0.0834884140166 , 0.075, 0.618432696419 );
-    drawBond( 3.009, -2.1125, 5.465, 2.39514704946, 0.216385333375, 0.0, -1.39640668472 , 0.17, 1.44256888917 );
-    drawBond( 3.3058811519, -3.29175429125, 5.49046781255, 2.8471456048, 0.0674007418355, 0.0, 0.523029756643 , 0.075, 1.34801483671 );
-    drawBond( 3.2921188481, -3.28224570875, 5.63953218745, 2.8471456048, 0.0674007418355, 0.0, 0.523029756643 , 0.075, 1.34801483671 );
-    drawBond( 2.7735, -4.0175, 5.565, 1.82252885142, -0.034326010546, 0.0, 0.455162899839 , 0.17, 0.686520210919 );
-    drawBond( 2.1105, -4.1885, 5.515, 1.82252885142, -0.034326010546, 0.0, 0.455162899839 , 0.17, 0.686520210919 );
-    drawBond( 4.2095, -2.4275, 5.595, 1.28072192596, 0.164986432776, 0.0, -2.14932325607 , 0.17, 1.4998766616 );
-    drawBond( 0.605, -5.75625, 5.2265, 1.50194226771, 0.113917702273, 0.0, -0.273620509767 , 0.17, 0.545060776428 );
-    drawBond( 1.107, -5.71875, 5.4355, 1.50194226771, 0.113917702273, 0.0, -0.273620509767 , 0.17, 0.545060776428 );
-    drawBond( 2.078, -6.814, 4.065, 1.36761355022, 0.27801502909, 0.0, -0.0861301462672 , 0.17, 0.54512750802 );
-    drawBond( 2.236, -6.704, 4.575, 1.36761355022, 0.27801502909, 0.0, -0.0861301462672 , 0.17, 0.54512750802 );
-    drawBond( 2.92725, -8.337, 5.65825, 0.987691183232, 0.0187970393447, 0.0, 0.247085720081 , 0.17, 0.544841720135 );
-    drawBond( 2.47375, -8.037, 5.69275, 0.987691183232, 0.0187970393447, 0.0, 0.247085720081 , 0.17, 0.544841720135 );
-    drawBond( 1.68775, -7.86025, 7.55775, 0.815691191394, -0.162672024777, 0.0, -0.142508323214 , 0.17, 0.544964907127 );
-    drawBond( 1.94925, -7.48675, 7.25925, 0.815691191394, -0.162672024777, 0.0, -0.142508323214 , 0.17, 0.544964907127 );
-    drawBond( 3.1815, -6.368, 8.40625, 2.33275899061, -0.205608018315, 0.0, -0.0615462412439 , 0.17, 0.544657002158 );
-    drawBond( 3.2945, -6.744, 8.02875, 2.33275899061, -0.205608018315, 0.0, -0.0615462412439 , 0.17, 0.544657002158 );
-    drawBond( 0.68075, -1.4745, 5.219, 2.35274782432, 0.0278174567673, 0.0, -0.186222418914 , 0.17, 0.515138088283 );
-    drawBond( 1.04225, -1.8375, 5.273, 2.35274782432, 0.0278174567673, 0.0, -0.186222418914 , 0.17, 0.515138088283 );
-    drawBond( 3.66675, -4.5185, 5.6815, 0.770388864562, -0.0332353309334, 0.0, 0.204043138271 , 0.17, 0.544841490711 );
-    drawBond( 3.29225, -4.1275, 5.6205, 0.770388864562, -0.0332353309334, 0.0, 0.204043138271 , 0.17, 0.544841490711 );
-    drawBond( 5.40825, -2.873, 5.6605, 0.631135290927, -0.00381491169622, 0.0, 0.175213444334 , 0.17, 0.544987385175 );
-    drawBond( 5.08675, -2.433, 5.6535, 0.631135290927, -0.00381491169622, 0.0, 0.175213444334 , 0.17, 0.544987385175 );
-    drawBond( 0.5385, -8.586, 3.7075, 0.767041937893, -0.0996573818139, 0.0, 0.429722630381 , 0.17, 0.797259054511 );
-    drawBond( -0.0005, -8.012, 3.5825, 0.767041937893, -0.0996573818139, 0.0, 0.429722630381 , 0.17, 0.797259054511 );
-    drawBond( -0.5435, -7.68825, 3.755, 1.46923152124, 0.340713127315, 0.0, 0.396532086471 , 0.17, 0.724921547479 );
-    drawBond( -1.0905, -7.61475, 4.225, 1.46923152124, 0.340713127315, 0.0, 0.396532086471 , 0.17, 0.724921547479 );
-    drawBond( -1.986, -7.353, 4.095, 1.26837964835, -1.10298531014, 0.0, 1.87960784359 , 0.17, 1.51093878102 );
-    drawBond( -2.713, -7.4145, 3.03, 1.95539727544, -2.13812086656, 0.0, 0.320718129984 , 0.17, 1.5272291904 );
-    drawBond( -3.84625, -7.68675, 2.0375, 1.58412520835, 0.138988019762, 0.0, -0.488596346396 , 0.17, 0.712759075705 );
-    drawBond( -3.16075, -7.69625, 2.2325, 1.58412520835, 0.138988019762, 0.0, -0.488596346396 , 0.17, 0.712759075705 );
-    drawBond( -2.4265, -7.2205, 1.89, 0.886467117752, -1.33777656729, 0.0, -1.19031710476 , 0.17, 1.52020064465 );
-    drawBond( -2.3215, -5.478, 2.5, 1.76429283744, 0.480936940565, 0.0, 0.0983091687331 , 0.17, 0.707260206713 );
-    drawBond( -2.4605, -5.614, 3.18, 1.76429283744, 0.480936940565, 0.0, 0.0983091687331 , 0.17, 0.707260206713 );
-    drawBond( -2.1435, -6.075, 1.805, 2.63246704173, -1.08146052396, 0.0, -0.330530892536 , 0.17, 1.52318383657 );
-    drawBond( -2.5495, -6.0435, 3.5725, 2.98789208917, 0.076820614909, 0.0, 0.0285333712519 , 0.17, 0.731624903895 );
-    drawBond( -2.5885, -6.7665, 3.6775, 2.98789208917, 0.076820614909, 0.0, 0.0285333712519 , 0.17, 0.731624903895 );
-    drawBond( -1.95725, -5.1835, 2.1475, 0.916026795503, -0.0185967781148, 0.0, -0.438512027946 , 0.17, 0.743871124591 );
-    drawBond( -1.36775, -4.7305, 2.1225, 0.916026795503, -0.0185967781148, 0.0, -0.438512027946 , 0.17, 0.743871124591 );
-    drawBond( 0.655, -9.20425, 3.715, 2.68531296781, -0.0811798695798, 0.0, 0.225827637195 , 0.17, 0.737998814362 );
-    drawBond( 0.349, -9.86675, 3.605, 2.68531296781, -0.0811798695798, 0.0, 0.225827637195 , 0.17, 0.737998814362 );
-    drawBond( 1.11325, -8.8005, 3.5725, 1.37396728394, -0.292875985711, 0.0, -0.452660226017 , 0.17, 0.741458191674 );
-    drawBond( 1.72375, -8.6555, 3.1775, 1.37396728394, -0.292875985711, 0.0, -0.452660226017 , 0.17, 0.741458191674 );
-    drawBond( -1.13475, -4.16675, 2.0725, 0.211027992669, -0.0517351880977, 0.0, 0.0851906097342 , 0.17, 0.689802507969 );
-    drawBond( -1.25825, -3.49225, 1.9975, 0.211027992669, -0.0517351880977, 0.0, 0.0851906097342 , 0.17, 0.689802507969 );
-    drawBond( -1.59840320206, -3.04824037878, 1.86295482962, 1.18528745644, -0.0274046767223, 0.0, 0.342558459028 , 0.075, 0.60899281605 );
-    drawBond( -1.60409679794, -3.03275962122, 2.01204517038, 1.18528745644, -0.0274046767223, 0.0, 0.342558459028 , 0.075, 0.60899281605 );
-    drawBond( -2.16090320206, -2.81924037878, 1.81795482962, 1.18528745644, -0.0274046767223, 0.0, 0.342558459028 , 0.075, 0.60899281605 );
-    drawBond( -2.16659679794, -2.80375962122, 1.96704517038, 1.18528745644, -0.0274046767223, 0.0, 0.342558459028 , 0.075, 0.60899281605 );
-    drawBond( -1.03925, -2.95425, 1.95, 0.950341534503, -0.0138113648855, 0.0, -0.38775406916 , 0.17, 0.690568244274 );
-    drawBond( -0.47775, -2.55275, 1.93, 0.950341534503, -0.0138113648855, 0.0, -0.38775406916 , 0.17, 0.690568244274 );
-    drawBond( 0.13025, -2.45525, 1.9425, 1.8757432747, 0.0309499747577, 0.0, -0.45015018842 , 0.17, 0.687777216837 );
-    drawBond( 0.78475, -2.66175, 1.9875, 1.8757432747, 0.0309499747577, 0.0, -0.45015018842 , 0.17, 0.687777216837 );
-    drawBond( 1.34645301868, -2.56832088534, 1.92293207868, 0.849108550519, -0.0154581996849, 0.0, -0.286595022159 , 0.075, 0.618327987398 );
-    drawBond( 1.34104698132, -2.55317911466, 2.07206792132, 0.849108550519, -0.0154581996849, 0.0, -0.286595022159 , 0.075, 0.618327987398 );
-    drawBond( 1.80995301868, -2.15982088534, 1.89793207868, 0.849108550519, -0.0154581996849, 0.0, -0.286595022159 , 0.075, 0.618327987398 );
-    drawBond( 1.80454698132, -2.14467911466, 2.04706792132, 0.849108550519, -0.0154581996849, 0.0, -0.286595022159 , 0.075, 0.618327987398 );
-    drawBond( 1.1925, -3.478, 2.085, 2.98848909697, 0.216431704008, 0.0, -0.232303362302 , 0.17, 1.44287802672 );
-    drawBond( 0.734226815607, -4.59060834535, 2.25953207942, 2.22030890965, 0.067377833892, 0.0, 1.44458075864 , 0.075, 1.34755667784 );
-    drawBond( 0.739773184393, -4.60639165465, 2.11046792058, 2.22030890965, 0.067377833892, 0.0, 1.44458075864 , 0.075, 1.34755667784 );
-    drawBond( -0.1175, -4.8805, 2.185, 1.19648945954, -0.0343245538937, 0.0, 0.437294816606 , 0.17, 0.686491077874 );
-    drawBond( -0.7545, -4.6295, 2.135, 1.19648945954, -0.0343245538937, 0.0, 0.437294816606 , 0.17, 0.686491077874 );
-    drawBond( 1.9785, -4.4385, 2.215, 1.90725180178, 0.164928337771, 0.0, -2.11558076904 , 0.17, 1.49934852519 );
-    drawBond( -2.894, -5.0125, 1.8465, 2.07851542864, 0.113917462621, 0.0, -0.233285521539 , 0.17, 0.545059629765 );
-    drawBond( -2.466, -5.2775, 2.0555, 2.07851542864, 0.113917462621, 0.0, -0.233285521539 , 0.17, 0.545059629765 );
-    drawBond( -2.32375, -6.734, 0.685, 1.57813402359, 0.278018888252, 0.0, -0.104938501938 , 0.17, 0.545135075004 );
-    drawBond( -2.13125, -6.738, 1.195, 1.57813402359, 0.278018888252, 0.0, -0.104938501938 , 0.17, 0.545135075004 );
-    drawBond( -2.53225, -8.46525, 2.27825, 0.36312782174, 0.0188039479947, 0.0, 0.103830495449 , 0.17, 0.545041970861 );
-    drawBond( -2.72275, -7.95575, 2.31275, 0.36312782174, 0.0188039479947, 0.0, 0.103830495449 , 0.17, 0.545041970861 );
-    drawBond( -3.2545, -7.3515, 4.17775, 1.29389489222, -0.162693248384, 0.0, -0.234910519442 , 0.17, 0.545036007985 );
-    drawBond( -2.8235, -7.2025, 3.87925, 1.29389489222, -0.162693248384, 0.0, -0.234910519442 , 0.17, 0.545036007985 );
-    drawBond( -1.169, -7.0215, 5.02625, 2.31952562235, -0.205745205704, 0.0, 0.0708526536201 , 0.17, 0.545020412462 );
-    drawBond( -1.299, -7.3925, 4.64875, 2.31952562235, -0.205745205704, 0.0, 0.0708526536201 , 0.17, 0.545020412462 );
-    drawBond( -0.31625, -1.593, 1.839, 2.95389668411, 0.0278124770741, 0.0, -0.0409461468036 , 0.17, 0.515045871743 );
-    drawBond( -0.23675, -2.099, 1.893, 2.95389668411, 0.0278124770741, 0.0, -0.0409461468036 , 0.17, 0.515045871743 );
-    drawBond( 0.3105, -5.81075, 2.3015, 0.175494586871, -0.0332370102784, 0.0, 0.0397754385299 , 0.17, 0.544869020958 );
-    drawBond( 0.2375, -5.27425, 2.2405, 0.175494586871, -0.0332370102784, 0.0, 0.0397754385299 , 0.17, 0.544869020958 );
-    drawBond( 2.68625, -5.5035, 2.2805, 0.0131348602403, -0.00381532911425, 0.0, 0.000817570524481 , 0.17, 0.545047016321 );
-    drawBond( 2.68475, -4.9585, 2.2735, 0.0131348602403, -0.00381532911425, 0.0, 0.000817570524482 , 0.17, 0.545047016321 );
-    drawBond( -4.61125, -7.2625, 0.3275, 0.201019151813, -0.0996312145176, 0.0, 0.0785093970399 , 0.17, 0.797049716141 );
-    drawBond( -4.70975, -6.4815, 0.2025, 0.201019151813, -0.0996312145176, 0.0, 0.0785093970399 , 0.17, 0.797049716141 );
-    drawBond( -4.95875, -5.9005, 0.375, 1.0174946668, 0.340761749797, 0.0, 0.289647487328 , 0.17, 0.725024999569 );
-    drawBond( -5.35825, -5.5195, 0.845, 1.0174946668, 0.340761749797, 0.0, 0.289647487328 , 0.17, 0.725024999569 );
-    drawBond( -5.929, -4.7815, 0.715, 0.760072646544, -1.10287732232, 0.0, 1.12100681255 , 0.17, 1.5107908525 );
-    drawBond( -6.553, -4.404, -0.35, 1.79534177899, -2.13775736696, 0.0, 0.772646591202 , 0.17, 1.52696954783 );
-    drawBond( -7.6295, -3.95825, -1.3425, 2.18460067102, 0.138975810508, 0.0, -0.391270358814 , 0.17, 0.712696464142 );
-    drawBond( -7.0805, -4.36875, -1.1475, 2.18460067102, 0.138975810508, 0.0, -0.391270358814 , 0.17, 0.712696464142 );
-    drawBond( -6.207, -4.4155, -1.49, 1.36068734218, -1.33751112862, 0.0, -1.82083901374 , 0.17, 1.5198990098 );
-    drawBond( -5.09825, -3.06725, -0.88, 1.61110150756, 0.480961697436, 0.0, 0.136154598171 , 0.17, 0.707296613876 );
-    drawBond( -5.29075, -3.09575, -0.2, 1.61110150756, 0.480961697436, 0.0, 0.136154598171 , 0.17, 0.707296613876 );
-    drawBond( -5.305, -3.655, -1.575, 2.48209902354, -1.08166163989, 0.0, 0.923221061649 , 0.17, 1.52346709843 );
-    drawBond( -5.61525, -3.391, 0.1925, 2.44676342644, 0.076819628229, 0.0, 0.333982478919 , 0.17, 0.731615506943 );
-    drawBond( -6.07175, -3.953, 0.2975, 2.44676342644, 0.076819628229, 0.0, 0.333982478919 , 0.17, 0.731615506943 );
-    drawBond( -4.63025, -3.043, -1.2325, 1.54391819686, -0.0186047247024, 0.0, -0.553304512648 , 0.17, 0.744188988094 );
-    drawBond( -3.88675, -3.023, -1.2575, 1.54391819686, -0.0186047247024, 0.0, -0.553304512648 , 0.17, 0.744188988094 );
-    drawBond( -4.8805, -7.83125, 0.335, 2.07478453951, -0.0812036398507, 0.0, 0.470242896227 , 0.17, 0.738214907734 );
-    drawBond( -5.5175, -8.18775, 0.225, 2.07478453951, -0.0812036398507, 0.0, 0.470242896227 , 0.17, 0.738214907734 );
-    drawBond( -4.27225, -7.77375, 0.1925, 1.9024308881, -0.292984443593, 0.0, -0.429834139398 , 0.17, 0.74173276859 );
-    drawBond( -3.69275, -8.01525, -0.2025, 1.9024308881, -0.292984443593, 0.0, -0.429834139398 , 0.17, 0.74173276859 );
-    drawBond( -3.36175, -2.7025, -1.3075, 0.470122828671, -0.0522426684449, 0.0, -0.213498371712 , 0.17, 0.696568912599 );
-    drawBond( -3.05525, -2.0815, -1.3825, 0.470122828671, -0.0522426684449, 0.0, -0.213498371712 , 0.17, 0.696568912599 );
-    drawBond( -3.07698038605, -1.51046346504, -1.36796636016, 0.615817313884, -0.0278389745905, 0.0, 0.219309255385 , 0.075, 0.618643879789 );
-    drawBond( -3.08151961395, -1.52653653496, -1.51703363984, 0.615817313884, -0.0278389745905, 0.0, 0.219309255385 , 0.075, 0.618643879789 );
-    drawBond( -3.43148038605, -1.00546346504, -1.41296636016, 0.615817313884, -0.0278389745905, 0.0, 0.219309255385 , 0.075, 0.618643879789 );
-    drawBond( -3.43601961395, -1.02153653496, -1.56203363984, 0.615817313884, -0.0278389745905, 0.0, 0.219309255385 , 0.075, 0.618643879789 );
-    drawBond( -2.5635, -1.75675, -1.4325, 1.52875230292, -0.0169515163407, 0.0, -0.459047062507 , 0.17, 0.678060653629 );
-    drawBond( -1.8865, -1.72825, -1.4575, 1.52875230292, -0.0169515163407, 0.0, -0.459047062507 , 0.17, 0.678060653629 );
-    drawBond( -1.36136554893, -1.9844309623, -1.37043923832, 2.55188501414, 0.0334795926648, 0.0, -0.247079393866 , 0.075, 0.669591853296 );
-    drawBond( -1.36563445107, -2.0000690377, -1.51956076168, 2.55188501414, 0.0334795926648, 0.0, -0.247079393866 , 0.075, 0.669591853296 );
-    drawBond( -0.992365548934, -2.5409309623, -1.32043923832, 2.55188501414, 0.0334795926648, 0.0, -0.247079393866 , 0.075, 0.669591853296 );
-    drawBond( -0.996634451066, -2.5565690377, -1.46956076168, 2.55188501414, 0.0334795926648, 0.0, -0.247079393866 , 0.075, 0.669591853296 );
-    drawBond( -0.4805, -2.79825, -1.3825, 1.48382557584, -0.0165494004801, 0.0, -0.436242196655 , 0.17, 0.661976019203 );
-    drawBond( 0.1785, -2.74075, -1.4075, 1.48382557584, -0.0165494004801, 0.0, -0.436242196655 , 0.17, 0.661976019203 );
-    drawBond( -1.113, -3.47, -1.295, 2.68965284303, 0.214428239745, 0.0, 0.86629008857 , 0.17, 1.4295215983 );
-    drawBond( -2.09300060253, -4.12215478586, -1.12045333307, 1.59579259967, 0.068017222084, 0.0, 1.84870809624 , 0.075, 1.36034444168 );
-    drawBond( -2.09799939747, -4.13784521414, -1.26954666693, 1.59579259967, 0.068017222084, 0.0, 1.84870809624 , 0.075, 1.36034444168 );
-    drawBond( -2.96, -3.8635, -1.195, 0.582319546287, -0.0339444030732, 0.0, 0.251188582742 , 0.17, 0.678888061465 );
-    drawBond( -3.33, -3.2965, -1.245, 0.582319546287, -0.0339444030732, 0.0, 0.251188582742 , 0.17, 0.678888061465 );
-    drawBond( -5.28775, -2.354, -1.5335, 2.59615194417, 0.113924604047, 0.0, -0.103840368761 , 0.17, 0.545093799268 );
-    drawBond( -5.09725, -2.82, -1.3245, 2.59615194417, 0.113924604047, 0.0, -0.103840368761 , 0.17, 0.545093799268 );
-    drawBond( -5.83825, -4.08225, -2.695, 1.78614301513, 0.278048005657, 0.0, -0.0836869977811 , 0.17, 0.545192167955 );
-    drawBond( -5.68475, -4.19875, -2.185, 1.78614301513, 0.278048005657, 0.0, -0.0836869977811 , 0.17, 0.545192167955 );
-    drawBond( -7.02425, -5.36, -1.10175, 0.277982028772, 0.0187996986445, 0.0, -0.0792856855878 , 0.17, 0.544918801291 );
-    drawBond( -6.87875, -4.836, -1.06725, 0.277982028772, 0.0187996986445, 0.0, -0.0792856855878 , 0.17, 0.544918801291 );
-    drawBond( -6.954, -4.0345, 0.79775, 1.8173809326, -0.162644772346, 0.0, -0.23756489361 , 0.17, 0.544873609198 );
-    drawBond( -6.518, -4.1675, 0.49925, 1.8173809326, -0.162644772346, 0.0, -0.23756489361 , 0.17, 0.544873609198 );
-    drawBond( -5.07275, -4.99375, 1.64625, 1.99328608763, -0.205767195678, 0.0, 0.17633294782 , 0.17, 0.545078664048 );
-    drawBond( -5.39625, -5.21725, 1.26875, 1.99328608763, -0.205767195678, 0.0, 0.17633294782 , 0.17, 0.545078664048 );
-    drawBond( 0.952, -3.34125, -1.3645, 0.618132234009, -0.0190456668891, 0.0, 0.152365335113 , 0.17, 0.514747753759 );
-    drawBond( 0.656, -2.92175, -1.4015, 0.618132234009, -0.0190456668891, 0.0, 0.152365335113 , 0.17, 0.514747753759 );
-    drawBond( 0.832, -2.01675, -1.50475, 2.69269321486, 0.0290676164507, 0.0, 0.111125754927 , 0.17, 0.514471087623 );
-    drawBond( 0.616, -2.48025, -1.44825, 2.69269321486, 0.0290676164507, 0.0, 0.111125754927 , 0.17, 0.514471087623 );
-    drawBond( -3.1545, -4.86475, -1.07775, 0.498327459678, -0.0335021779199, 0.0, -0.137821967703 , 0.17, 0.544750860486 );
-    drawBond( -2.9015, -4.38625, -1.13925, 0.498327459678, -0.0335021779199, 0.0, -0.137821967703 , 0.17, 0.544750860486 );
-    drawBond( -0.96825, -4.79475, -1.16675, 0.58434338673, -0.0193444952942, 0.0, 0.162657235079 , 0.17, 0.5449153604 );
-    drawBond( -1.26675, -4.34025, -1.20225, 0.58434338673, -0.0193444952942, 0.0, 0.162657235079 , 0.17, 0.5449153604 );
-    drawBond( -7.99925, -3.165, -3.0525, 0.524885460395, -0.0996670433556, 0.0, -0.302589143628 , 0.17, 0.797336346845 );
-    drawBond( -7.61975, -2.475, -3.1775, 0.524885460395, -0.0996670433556, 0.0, -0.302589143628 , 0.17, 0.797336346845 );
-    drawBond( -7.47975, -1.8585, -3.005, 0.724322927904, 0.340757860254, 0.0, 0.0721391640325 , 0.17, 0.725016723945 );
-    drawBond( -7.57925, -1.3155, -2.535, 0.724322927904, 0.340757860254, 0.0, 0.0721391640325 , 0.17, 0.725016723945 );
-    drawBond( -7.607, -0.383, -2.665, 0.505293475727, -1.10288481175, 0.0, -0.0664752489276 , 0.17, 1.51080111199 );
-    drawBond( -7.89, 0.289, -3.73, 1.55639113467, -2.13819190907, 0.0, 0.931640760381 , 0.17, 1.52727993505 );
-    drawBond( -8.49875, 1.2825, -4.7225, 2.73617127875, 0.138992226064, 0.0, -0.144338080913 , 0.17, 0.712780646482 );
-    drawBond( -8.29625, 0.6275, -4.5275, 2.73617127875, 0.138992226064, 0.0, -0.144338080913 , 0.17, 0.712780646482 );
-    drawBond( -7.617, 0.0765, -4.87, 1.86927838299, -1.33764197303, 0.0, -1.75717513729 , 0.17, 1.52004769662 );
-    drawBond( -5.92725, 0.515, -4.26, 1.44320379266, 0.480955808781, 0.0, 0.12200717208 , 0.17, 0.707287954089 );
-    drawBond( -6.09975, 0.605, -3.58, 1.44320379266, 0.480955808781, 0.0, 0.12200717208 , 0.17, 0.707287954089 );
-    drawBond( -6.44, 0.1615, -4.955, 1.98786370231, -1.08143814955, 0.0, 1.82473648333 , 0.17, 1.52315232331 );
-    drawBond( -6.53575, 0.557, -3.1875, 1.82793328019, 0.0767952262921, 0.0, 0.511602483727 , 0.17, 0.731383107544 );
-    drawBond( -7.23525, 0.371, -3.0825, 1.82793328019, 0.0767952262921, 0.0, 0.511602483727 , 0.17, 0.731383107544 );
-    drawBond( -5.5345, 0.25975, -4.6125, 2.17165687483, -0.0185945934683, 0.0, -0.455939431842 , 0.17, 0.743783738731 );
-    drawBond( -4.9215, -0.16075, -4.6375, 2.17165687483, -0.0185945934683, 0.0, -0.455939431842 , 0.17, 0.743783738731 );
-    drawBond( -8.55125, -3.467, -3.045, 1.45397310222, -0.0811615341464, 0.0, 0.534559377174 , 0.17, 0.737832128604 );
-    drawBond( -9.27575, -3.381, -3.155, 1.45397310222, -0.0811615341464, 0.0, 0.534559377174 , 0.17, 0.737832128604 );
-    drawBond( -8.02575, -3.778, -3.1875, 2.37863128564, -0.292919400316, 0.0, -0.242121985324 , 0.17, 0.741568102065 );
-    drawBond( -7.69925, -4.314, -3.5825, 2.37863128564, -0.292919400316, 0.0, -0.242121985324 , 0.17, 0.741568102065 );
-    drawBond( -4.31325, -0.20825, -4.6875, 1.07935851994, -0.0517330135166, 0.0, -0.41627831543 , 0.17, 0.689773513554 );
-    drawBond( -3.70975, 0.11725, -4.7625, 1.07935851994, -0.0517330135166, 0.0, -0.41627831543 , 0.17, 0.689773513554 );
-    drawBond( -3.37976725837, 0.588101397643, -4.74795505657, 0.102915533009, -0.0274150566523, 0.0, -0.0265012214306 , 0.075, 0.609223481163 );
-    drawBond( -3.39273274163, 0.577898602357, -4.89704494343, 0.102915533009, -0.0274150566523, 0.0, -0.0265012214306 , 0.075, 0.609223481163 );
-    drawBond( -3.33626725837, 1.19410139764, -4.79295505657, 0.102915533009, -0.0274150566523, 0.0, -0.0265012214306 , 0.075, 0.609223481163 );
-    drawBond( -3.34923274163, 1.18389860236, -4.94204494343, 0.102915533009, -0.0274150566523, 0.0, -0.0265012214306 , 0.075, 0.609223481163 );
-    drawBond( -3.1305, 0.07525, -4.81, 2.20615813395, -0.0138002210127, 0.0, -0.382956133103 , 0.17, 0.690011050636 );
-    drawBond( -2.5755, -0.33425, -4.83, 2.20615813395, -0.0138002210127, 0.0, -0.382956133103 , 0.17, 0.690011050636 );
-    drawBond( -2.295, -0.88225, -4.8175, 3.0755588112, 0.0309599754724, 0.0, -0.00412799672965 , 0.17, 0.687999454942 );
-    drawBond( -2.289, -1.56875, -4.7725, 3.0755588112, 0.0309599754724, 0.0, -0.00412799672965 , 0.17, 0.687999454942 );
-    drawBond( -2.01388599547, -2.06434153241, -4.68793186012, 2.10462232967, -0.0154520933048, 0.0, -0.32851150366 , 0.075, 0.618083732192 );
-    drawBond( -2.02661400453, -2.07415846759, -4.83706813988, 2.10462232967, -0.0154520933048, 0.0, -0.32851150366 , 0.075, 0.618083732192 );
-    drawBond( -1.48238599547, -2.37884153241, -4.71293186012, 2.10462232967, -0.0154520933048, 0.0, -0.32851150366 , 0.075, 0.618083732192 );
-    drawBond( -1.49511400453, -2.38865846759, -4.86206813988, 2.10462232967, -0.0154520933048, 0.0, -0.32851150366 , 0.075, 0.618083732192 );
-    drawBond( -2.9395, -2.209, -4.675, 1.99490701071, 0.216519427534, 0.0, 1.88660594525 , 0.17, 1.44346285023 );
-    drawBond( -4.15264842268, -2.12707524151, -4.64953214597, 0.964320722609, 0.0673713589, 0.0, 1.49025445887 , 0.075, 1.347427178 );
-    drawBond( -4.13935157732, -2.11692475849, -4.50046785403, 0.964320722609, 0.0673713589, 0.0, 1.49025445887 , 0.075, 1.347427178 );
-    drawBond( -4.678, -1.39625, -4.575, 0.0952475844807, -0.0343306076992, 0.0, -0.0288377104674 , 0.17, 0.686612153985 );
-    drawBond( -4.636, -0.71275, -4.625, 0.0952475844807, -0.0343306076992, 0.0, -0.0288377104674 , 0.17, 0.686612153985 );
-    drawBond( -3.61, -3.2535, -4.545, 3.06473119013, 0.164936957957, 0.0, 0.0509805142777 , 0.17, 1.49942689052 );
-    drawBond( -5.66175, 1.2035, -4.9135, 2.68409646285, 0.113915976765, 0.0, 0.0651337761884 , 0.17, 0.545052520405 );
-    drawBond( -5.78125, 0.7145, -4.7045, 2.68409646285, 0.113915976765, 0.0, 0.0651337761884 , 0.17, 0.545052520405 );
-    drawBond( -7.12225, 0.129, -6.075, 1.91517116354, 0.277955263712, 0.0, -0.0302480728157 , 0.17, 0.545010321003 );
-    drawBond( -7.06675, -0.055, -5.565, 1.91517116354, 0.277955263712, 0.0, -0.0302480728157 , 0.17, 0.545010321003 );
-    drawBond( -8.83325, -0.20775, -4.48175, 0.900379711505, 0.0187960974191, 0.0, -0.231818534835 , 0.17, 0.544814417944 );
-    drawBond( -8.40775, 0.13075, -4.44725, 0.900379711505, 0.0187960974191, 0.0, -0.231818534835 , 0.17, 0.544814417944 );
-    drawBond( -7.99675, 0.824, -2.58225, 2.30228193212, -0.16266154888, 0.0, -0.149583233392 , 0.17, 0.544929811994 );
-    drawBond( -7.72225, 0.46, -2.88075, 2.30228193212, -0.16266154888, 0.0, -0.149583233392 , 0.17, 0.544929811994 );
-    drawBond( -7.0395, -1.05825, -1.73375, 1.55336485287, -0.205744599648, 0.0, 0.214192391157 , 0.17, 0.545018807015 );
-    drawBond( -7.4325, -1.04875, -2.11125, 1.55336485287, -0.205744599648, 0.0, 0.214192391157 , 0.17, 0.545018807015 );
-    drawBond( -1.61325, -0.19175, -4.921, 2.03732630532, 0.0277929821718, 0.0, 0.234953636323 , 0.17, 0.514684855033 );
-    drawBond( -2.06975, -0.42325, -4.867, 2.03732630532, 0.0277929821718, 0.0, 0.234953636323 , 0.17, 0.514684855033 );
-    drawBond( -5.43025, -2.09125, -4.4585, 1.1238137332, -0.0332345052243, 0.0, -0.265603627817 , 0.17, 0.544827954496 );
-    drawBond( -4.94275, -1.85575, -4.5195, 1.1238137332, -0.0332345052243, 0.0, -0.265603627817 , 0.17, 0.544827954496 );
-    drawBond( -4.404, -4.256, -4.4795, 1.25371315898, -0.00381659232824, 0.0, -0.28242783229 , 0.17, 0.545227475463 );
-    drawBond( -3.886, -4.086, -4.4865, 1.25371315898, -0.00381659232824, 0.0, -0.28242783229 , 0.17, 0.545227475463 );
-    drawBond( -8.33175, 2.14075, -6.4325, 1.13653086931, -0.0996745877218, 0.0, -0.568145150014 , 0.17, 0.797396701774 );
-    drawBond( -7.61925, 2.47625, -6.5575, 1.13653086931, -0.0996745877218, 0.0, -0.568145150014 , 0.17, 0.797396701774 );
-    drawBond( -7.14375, 2.89275, -6.385, 0.81423259246, 0.340640910124, 0.0, -0.172857142691 , 0.17, 0.724767893881 );
-    drawBond( -6.90525, 3.39025, -5.915, 0.81423259246, 0.340640910124, 0.0, -0.172857142691 , 0.17, 0.724767893881 );
-    drawBond( -6.3795, 4.161, -6.045, 0.808160375672, -1.10319521595, 0.0, -1.22862700078 , 0.17, 1.51122632322 );
-    drawBond( -6.213, 4.8715, -7.11, 1.32137113112, -2.1381667007, 0.0, 0.733085725954 , 0.17, 1.52726192907 );
-    drawBond( -6.12225, 6.0335, -8.1025, 2.71578829441, 0.138963497568, 0.0, 0.15713564725 , 0.17, 0.71263332086 );
-    drawBond( -6.34275, 5.3845, -7.9075, 2.71578829441, 0.138963497568, 0.0, 0.15713564725 , 0.17, 0.71263332086 );
-    drawBond( -6.117, 4.539, -8.25, 2.32584816293, -1.33799015362, 0.0, -1.02173793549 , 0.17, 1.52044335639 );
-    drawBond( -4.49225, 3.901, -7.64, 1.32220975131, 0.480908696948, 0.0, 0.0611744151264 , 0.17, 0.707218671982 );
-    drawBond( -4.57875, 4.075, -6.96, 1.32220975131, 0.480908696948, 0.0, 0.0611744151264 , 0.17, 0.707218671982 );
-    drawBond( -5.115, 3.916, -8.335, 1.43645833834, -1.08142579681, 0.0, 2.02881572021 , 0.17, 1.52313492508 );
-    drawBond( -4.95975, 4.29225, -6.5675, 1.20671976101, 0.0768141922922, 0.0, 0.494171303746 , 0.17, 0.731563736116 );
-    drawBond( -5.63525, 4.55275, -6.4625, 1.20671976101, 0.0768141922922, 0.0, 0.494171303746 , 0.17, 0.731563736116 );
-    drawBond( -4.32475, 3.4635, -7.9925, 2.79933151364, -0.0186040696153, 0.0, -0.184924451976 , 0.17, 0.744162784611 );
-    drawBond( -4.07625, 2.7625, -8.0175, 2.79933151364, -0.0186040696153, 0.0, -0.184924451976 , 0.17, 0.744162784611 );
-    drawBond( -8.95575, 2.221, -6.425, 0.833966479396, -0.0811973067595, 0.0, 0.395283252452 , 0.17, 0.738157334177 );
-    drawBond( -9.49125, 2.717, -6.535, 0.833966479396, -0.0811973067595, 0.0, 0.395283252452 , 0.17, 0.738157334177 );
-    drawBond( -8.7135, 1.6605, -6.5675, 2.57423559847, -0.292740306885, 0.0, 0.0377968497497 , 0.17, 0.741114700974 );
-    drawBond( -8.7645, 1.0355, -6.9625, 2.57423559847, -0.292740306885, 0.0, 0.0377968497497 , 0.17, 0.741114700974 );
-    drawBond( -3.61225, 2.3665, -8.0675, 1.70313197182, -0.0517242463091, 0.0, -0.468621671561 , 0.17, 0.689656617455 );
-    drawBond( -2.93275, 2.2755, -8.1425, 1.70313197182, -0.0517242463091, 0.0, -0.468621671561 , 0.17, 0.689656617455 );
-    drawBond( -2.38876005294, 2.46256417208, -8.12795468214, 0.70418083841, -0.0274259864226, 0.0, -0.238910815059 , 0.075, 0.609466364946 );
-    drawBond( -2.40523994706, 2.46193582792, -8.27704531786, 0.70418083841, -0.0274259864226, 0.0, -0.238910815059 , 0.075, 0.609466364946 );
-    drawBond( -1.99676005294, 2.92706417208, -8.17295468214, 0.70418083841, -0.0274259864226, 0.0, -0.238910815059 , 0.075, 0.609466364946 );
-    drawBond( -2.01323994706, 2.92643582792, -8.32204531786, 0.70418083841, -0.0274259864226, 0.0, -0.238910815059 , 0.075, 0.609466364946 );
-    drawBond( -2.48875, 1.901, -8.19, 2.83341098221, -0.0138106661679, 0.0, -0.1439761948 , 0.17, 0.690533308393 );
-    drawBond( -2.28025, 1.243, -8.21, 2.83341098221, -0.0138106661679, 0.0, -0.1439761948 , 0.17, 0.690533308393 );
-    drawBond( -2.37525, 0.63475, -8.1975, 2.51885290344, 0.0309405516677, 0.0, 0.273995774213 , 0.17, 0.687567814837 );
-    drawBond( -2.77375, 0.07625, -8.1525, 2.51885290344, 0.0309405516677, 0.0, 0.273995774213 , 0.17, 0.687567814837 );
-    drawBond( -2.84246313772, -0.486269825272, -8.06793220213, 2.73183549744, -0.0154543480937, 0.0, -0.151452611318 , 0.075, 0.618173923746 );
-    drawBond( -2.85853686228, -0.486730174728, -8.21706779787, 2.73183549744, -0.0154543480937, 0.0, -0.151452611318 , 0.075, 0.618173923746 );
-    drawBond( -2.59746313772, -1.05326982527, -8.09293220213, 2.73183549744, -0.0154543480936, 0.0, -0.151452611318 , 0.075, 0.618173923746 );
-    drawBond( -2.61353686228, -1.05373017473, -8.24206779787, 2.73183549744, -0.0154543480936, 0.0, -0.151452611318 , 0.075, 0.618173923746 );
-    drawBond( -3.676, -0.0595, -8.055, 1.3705434253, 0.216421723725, 0.0, 2.02859295705 , 0.17, 1.4428114915 );
-    drawBond( -4.60936110011, 0.719800565337, -8.02953222807, 0.337799479894, 0.0674095690535, 0.0, 0.598596973195 , 0.075, 1.34819138107 );
-    drawBond( -4.59263889989, 0.720199434663, -7.88046777193, 0.337799479894, 0.0674095690535, 0.0, 0.598596973195 , 0.075, 1.34819138107 );
-    drawBond( -4.60525, 1.62, -7.955, 0.692903361262, -0.0343126889794, 0.0, -0.298863521011 , 0.17, 0.686253779589 );
-    drawBond( -4.16975, 2.148, -8.005, 0.692903361262, -0.0343126889795, 0.0, -0.298863521011 , 0.17, 0.686253779589 );
-    drawBond( -4.8325, -0.5105, -7.925, 2.48640944381, 0.16494389046, 0.0, 1.36003735134 , 0.17, 1.49948991327 );
-    drawBond( -3.873, 4.3015, -8.2935, 2.21004727201, 0.113854560392, 0.0, 0.20918732627 , 0.17, 0.544758662162 );
-    drawBond( -4.257, 3.9765, -8.0845, 2.21004727201, 0.113854560392, 0.0, 0.20918732627 , 0.17, 0.544758662162 );
-    drawBond( -5.6865, 4.291, -9.455, 1.91118188384, 0.278028594393, 0.0, 0.0343447087191 , 0.17, 0.545154106652 );
-    drawBond( -5.7495, 4.109, -8.945, 1.91118188384, 0.278028594393, 0.0, 0.0343447087191 , 0.17, 0.545154106652 );
-    drawBond( -7.26825, 5.02475, -7.86175, 1.52767165925, 0.0188059734177, 0.0, -0.296262218914 , 0.17, 0.545100678774 );
-    drawBond( -6.72475, 5.04825, -7.82725, 1.52767165925, 0.0188059734177, 0.0, -0.296262218914 , 0.17, 0.545100678774 );
-    drawBond( -5.98575, 5.367, -5.96225, 2.56180107221, -0.162705912765, 0.0, -0.00463316669515 , 0.17, 0.545078434723 );
-    drawBond( -5.97725, 4.911, -6.26075, 2.56180107221, -0.162705912765, 0.0, -0.00463316669515 , 0.17, 0.545078434723 );
-    drawBond( -6.3165, 3.282, -5.11375, 1.11894925764, -0.20577013904, 0.0, 0.170612062303 , 0.17, 0.545086461032 );
-    drawBond( -6.6295, 3.52, -5.49125, 1.11894925764, -0.20577013904, 0.0, 0.170612062303 , 0.17, 0.545086461032 );
-    drawBond( -1.41775, 0.79325, -8.301, 1.41375289009, 0.0277943460798, 0.0, 0.260185961913 , 0.17, 0.514710112588 );
-    drawBond( -1.92325, 0.87375, -8.247, 1.41375289009, 0.0277943460798, 0.0, 0.260185961913 , 0.17, 0.514710112588 );
-    drawBond( -5.6225, 1.5, -7.8385, 1.7478666777, -0.0332450559632, 0.0, -0.29048548899 , 0.17, 0.54500091743 );
-    drawBond( -5.0895, 1.404, -7.8995, 1.7478666777, -0.0332450559632, 0.0, -0.29048548899 , 0.17, 0.54500091743 );
-    drawBond( -6.0645, -0.8545, -7.8595, 1.88207990747, -0.00381675922741, 0.0, -0.282985434146 , 0.17, 0.545251318201 );
-    drawBond( -5.5455, -1.0215, -7.8665, 1.88207990747, -0.00381675922741, 0.0, -0.282985434146 , 0.17, 0.545251318201 );
-    drawBond( -5.48225, 6.62925, -9.8125, 1.75686811217, -0.0996622029031, 0.0, -0.616709711565 , 0.17, 0.797297623225 );
-    drawBond( -4.70875, 6.48175, -9.9375, 1.75686811217, -0.0996622029031, 0.0, -0.616709711565 , 0.17, 0.797297623225 );
-    drawBond( -4.07925, 6.539, -9.765, 1.20091281176, 0.340629804663, 0.0, -0.351863340775 , 0.17, 0.724744265241 );
-    drawBond( -3.59375, 6.801, -9.295, 1.20091281176, 0.340629804663, 0.0, -0.351863340775 , 0.17, 0.724744265241 );
-    drawBond( -2.7155, 7.116, -9.425, 1.324810104, -1.10318555488, 0.0, -1.92075183597 , 0.17, 1.51121308888 );
-    drawBond( -2.1635, 7.5935, -10.49, 1.17628856801, -2.13813415857, 0.0, 0.255048860343 , 0.17, 1.52723868469 );
-    drawBond( -1.40625, 8.4795, -11.4825, 2.15805819428, 0.139013289855, 0.0, 0.399574097249 , 0.17, 0.712888665922 );
-    drawBond( -1.96675, 8.0845, -11.2875, 2.15805819428, 0.139013289855, 0.0, 0.399574097249 , 0.17, 0.712888665922 );
-    drawBond( -2.281, 7.268, -11.63, 2.52223286526, -1.33796700228, 0.0, 0.103388359267 , 0.17, 1.52041704805 );
-    drawBond( -1.34175, 5.796, -11.02, 1.29590526698, 0.480986573201, 0.0, -0.0229883288662 , 0.17, 0.707333195884 );
-    drawBond( -1.30925, 5.988, -10.34, 1.29590526698, 0.480986573201, 0.0, -0.0229883288662 , 0.17, 0.707333195884 );
-    drawBond( -1.8365, 6.1745, -11.715, 0.898255949031, -1.08156796134, 0.0, 1.45783174508 , 0.17, 1.52333515682 );
-    drawBond( -1.46325, 5.34375, -11.3725, 2.85241732909, -0.0185841246095, 0.0, 0.156478329212 , 0.17, 0.743364984378 );
-    drawBond( -1.67375, 4.63125, -11.3975, 2.85241732909, -0.0185841246094, 0.0, 0.156478329212 , 0.17, 0.743364984378 );
-    drawBond( -1.48975, 6.388, -9.9475, 0.590202341169, 0.0768390007174, 0.0, 0.287963302688 , 0.17, 0.731800006832 );
-    drawBond( -1.88325, 6.996, -9.8425, 0.590202341169, 0.0768390007174, 0.0, 0.287963302688 , 0.17, 0.731800006832 );
-    drawBond( -5.94, 7.061, -9.805, 0.24579588005, -0.0812005665005, 0.0, 0.104822549482 , 0.17, 0.738186968186 );
-    drawBond( -6.082, 7.777, -9.915, 0.24579588005, -0.0812005665005, 0.0, 0.104822549482 , 0.17, 0.738186968186 );
-    drawBond( -6.07325, 6.465, -9.9475, 2.26809055486, -0.2927995284, 0.0, 0.30280660089 , 0.17, 0.741264628861 );
-    drawBond( -6.48175, 5.989, -10.3425, 2.26809055486, -0.2927995284, 0.0, 0.30280660089 , 0.17, 0.741264628861 );
-    drawBond( -1.56775, 4.00525, -11.445, 2.47063857899, -0.0482170701101, 0.0, -0.291024458879 , 0.17, 0.688815287287 );
-    drawBond( -1.14525, 3.46575, -11.515, 2.47063857899, -0.0482170701101, 0.0, -0.291024458879 , 0.17, 0.688815287287 );
-    drawBond( -0.596, 3.21275, -11.58, 1.52147420063, -0.040769028686, 0.0, -0.459331056529 , 0.17, 0.679483811433 );
-    drawBond( 0.08, 3.24625, -11.64, 1.52147420063, -0.040769028686, 0.0, -0.459331056529 , 0.17, 0.679483811433 );
-    drawBond( 0.564034353967, 2.95797971275, -11.6279675599, 2.69811334989, -0.0432486965121, 0.0, -0.18497134816 , 0.075, 0.665364561725 );
-    drawBond( 0.549965646033, 2.96702028725, -11.7770324401, 2.69811334989, -0.0432486965121, 0.0, -0.18497134816 , 0.075, 0.665364561725 );
-    drawBond( 0.842034353967, 2.35697971275, -11.6929675599, 2.69811334989, -0.0432486965121, 0.0, -0.18497134816 , 0.075, 0.665364561725 );
-    drawBond( 0.827965646033, 2.36602028725, -11.8420324401, 2.69811334989, -0.0432486965121, 0.0, -0.18497134816 , 0.075, 0.665364561725 );
-    drawBond( 1.30525, 2.0315, -11.8325, 1.65919637072, -0.0434388853016, 0.0, -0.442742484805 , 0.17, 0.668290543102 );
-    drawBond( 1.96775, 1.9725, -11.8975, 1.65919637072, -0.0434388853016, 0.0, -0.442742484805 , 0.17, 0.668290543102 );
-    drawBond( 0.79425, 1.76675, -11.8, 2.59321510197, 0.0, 0.0, 0.247917544343 , 0.17, 0.689617647686 );
-    drawBond( 0.43475, 1.17825, -11.8, 2.59321510197, 0.0, 0.0, 0.247917544343 , 0.17, 0.689617647686 );
-    drawBond( -0.0945, 0.861, -11.77, 1.63626980154, 0.0421846085676, 0.0, 0.491450689813 , 0.17, 0.70307680946 );
-    drawBond( -0.7935, 0.815, -11.71, 1.63626980154, 0.0421846085676, 0.0, 0.491450689813 , 0.17, 0.70307680946 );
-    drawBond( -1.28416604975, 0.519791401099, -11.759565008, 2.68893758039, -0.00615486189934, 0.0, 0.165565785092 , 0.075, 0.615486189934 );
-    drawBond( -1.27083395025, 0.510708598901, -11.610434992, 2.68893758039, -0.00615486189934, 0.0, 0.165565785092 , 0.075, 0.615486189934 );
-    drawBond( -1.55316604975, -0.0337085989007, -11.769565008, 2.68893758039, -0.00615486189934, 0.0, 0.165565785092 , 0.075, 0.615486189934 );
-    drawBond( -1.53983395025, -0.0427914010993, -11.620434992, 2.68893758039, -0.00615486189934, 0.0, 0.165565785092 , 0.075, 0.615486189934 );
-    drawBond( -1.439, 1.43, -11.615, 2.69814073551, -0.183642658443, 0.0, -0.836280413835 , 0.17, 1.41263583418 );
-    drawBond( -1.3411289474, 2.636571309, -11.6245664799, 2.52411603673, 0.0, 0.0, 1.10815824231 , 0.075, 1.3834684673 );
-    drawBond( -1.3278710526, 2.627428691, -11.4754335201, 2.52411603673, 0.0, 0.0, 1.10815824231 , 0.075, 1.3834684673 );
-    drawBond( -2.0705, 2.1585, -11.515, 1.3086783488, 0.0488949874732, 0.0, 0.468693379921 , 0.17, 0.698499821045 );
-    drawBond( -2.7415, 2.3395, -11.445, 1.3086783488, 0.0488949874732, 0.0, 0.468693379921 , 0.17, 0.698499821045 );
-    drawBond( -3.0759094182, 2.76090645059, -11.4645585018, 0.0656497909924, 0.0261563453104, 0.0, -0.0101355838078 , 0.075, 0.653908632761 );
-    drawBond( -3.0625905818, 2.75159354941, -11.3154414982, 0.0656497909924, 0.0261563453104, 0.0, -0.0101355838078 , 0.075, 0.653908632761 );
-    drawBond( -3.0604094182, 3.41340645059, -11.4245585018, 0.0656497909924, 0.0261563453104, 0.0, -0.0101355838078 , 0.075, 0.653908632761 );
-    drawBond( -3.0470905818, 3.40409354941, -11.2754414982, 0.0656497909924, 0.0261563453104, 0.0, -0.0101355838078 , 0.075, 0.653908632761 );
-    drawBond( -2.72925, 3.87, -11.35, 1.16862370537, -0.0275919481008, 0.0, -0.436987478047 , 0.17, 0.689798702521 );
-    drawBond( -2.09575, 4.14, -11.39, 1.16862370537, -0.0275919481008, 0.0, -0.436987478047 , 0.17, 0.689798702521 );
-    drawBond( -0.605, 5.75625, -11.6735, 1.63965038588, 0.113917702273, 0.0, 0.273620509767 , 0.17, 0.545060776428 );
-    drawBond( -1.107, 5.71875, -11.4645, 1.63965038588, 0.113917702273, 0.0, 0.273620509767 , 0.17, 0.545060776428 );
-    drawBond( -2.078, 6.814, -12.835, 1.77397910337, 0.27801502909, 0.0, 0.0861301462672 , 0.17, 0.54512750802 );
-    drawBond( -2.236, 6.704, -12.325, 1.77397910337, 0.27801502909, 0.0, 0.0861301462672 , 0.17, 0.54512750802 );
-    drawBond( -2.92725, 8.337, -11.24175, 2.15390147036, 0.0187970393447, 0.0, -0.247085720081 , 0.17, 0.544841720135 );
-    drawBond( -2.47375, 8.037, -11.20725, 2.15390147036, 0.0187970393447, 0.0, -0.247085720081 , 0.17, 0.544841720135 );
-    drawBond( -1.68775, 7.86025, -9.34225, 2.3259014622, -0.162672024777, 0.0, 0.142508323214 , 0.17, 0.544964907127 );
-    drawBond( -1.94925, 7.48675, -9.64075, 2.3259014622, -0.162672024777, 0.0, 0.142508323214 , 0.17, 0.544964907127 );
-    drawBond( -3.1815, 6.368, -8.49375, 0.808833662984, -0.205608018315, 0.0, 0.0615462412439 , 0.17, 0.544657002158 );
-    drawBond( -3.2945, 6.744, -8.87125, 0.808833662984, -0.205608018315, 0.0, 0.0615462412439 , 0.17, 0.544657002158 );
-    drawBond( 2.74525, 2.57375, -11.93525, 2.52582416358, 0.00180288648769, 0.0, 0.153245351454 , 0.17, 0.515110425055 );
-    drawBond( 2.44775, 2.15325, -11.93175, 2.52582416358, 0.00180288648769, 0.0, 0.153245351454 , 0.17, 0.515110425055 );
-    drawBond( 2.61925, 1.24325, -11.99975, 0.438043504494, 0.0239538985384, 0.0, 0.109981878235 , 0.17, 0.515137602976 );
-    drawBond( 2.40575, 1.70975, -11.95325, 0.438043504494, 0.0239538985384, 0.0, 0.109981878235 , 0.17, 0.515137602976 );
-    drawBond( -3.71875, 4.191, -11.24075, 2.16243242382, -0.0324320577072, 0.0, -0.244466855154 , 0.17, 0.545076600121 );
-    drawBond( -3.27025, 3.887, -11.30025, 2.16243242382, -0.0324320577072, 0.0, -0.244466855154 , 0.17, 0.545076600121 );
-    drawBond( 0.651, 0.22475, -11.87125, 0.547979044523, 0.0244573113429, 0.0, 0.13593116199 , 0.17, 0.514890765114 );
-    drawBond( 0.387, 0.66425, -11.82375, 0.547979044523, 0.0244573113429, 0.0, 0.13593116199 , 0.17, 0.514890765114 );
-    drawBond( -0.5385, 8.586, -13.1925, 2.3745507157, -0.0996573818139, 0.0, -0.429722630381 , 0.17, 0.797259054511 );
-    drawBond( 0.0005, 8.012, -13.3175, 2.3745507157, -0.0996573818139, 0.0, -0.429722630381 , 0.17, 0.797259054511 );
-    drawBond( 0.5435, 7.68825, -13.145, 1.67236113235, 0.340713127315, 0.0, -0.396532086471 , 0.17, 0.724921547479 );
-    drawBond( 1.0905, 7.61475, -12.675, 1.67236113235, 0.340713127315, 0.0, -0.396532086471 , 0.17, 0.724921547479 );
-    drawBond( 1.986, 7.353, -12.805, 1.87321300524, -1.10298531014, 0.0, -1.87960784359 , 0.17, 1.51093878102 );
-    drawBond( 2.713, 7.4145, -13.87, 1.18619537815, -2.13812086656, 0.0, -0.320718129984 , 0.17, 1.5272291904 );
-    drawBond( 3.84625, 7.68675, -14.8625, 1.55746744524, 0.138988019762, 0.0, 0.488596346396 , 0.17, 0.712759075705 );
-    drawBond( 3.16075, 7.69625, -14.6675, 1.55746744524, 0.138988019762, 0.0, 0.488596346396 , 0.17, 0.712759075705 );
-    drawBond( 2.4265, 7.2205, -15.01, 2.25512553584, -1.33777656729, 0.0, 1.19031710476 , 0.17, 1.52020064465 );
-    drawBond( 2.3215, 5.478, -14.4, 1.37729981615, 0.480936940565, 0.0, -0.0983091687331 , 0.17, 0.707260206713 );
-    drawBond( 2.4605, 5.614, -13.72, 1.37729981615, 0.480936940565, 0.0, -0.0983091687331 , 0.17, 0.707260206713 );
-    drawBond( 2.1435, 6.075, -15.095, 0.509125611864, -1.08146052396, 0.0, 0.330530892536 , 0.17, 1.52318383657 );
-    drawBond( 2.5495, 6.0435, -13.3275, 0.153700564424, 0.076820614909, 0.0, -0.0285333712519 , 0.17, 0.731624903895 );
-    drawBond( 2.5885, 6.7665, -13.2225, 0.153700564424, 0.076820614909, 0.0, -0.0285333712519 , 0.17, 0.731624903895 );
-    drawBond( 1.95725, 5.1835, -14.7525, 2.22556585809, -0.0185967781148, 0.0, 0.438512027946 , 0.17, 0.743871124591 );
-    drawBond( 1.36775, 4.7305, -14.7775, 2.22556585809, -0.0185967781148, 0.0, 0.438512027946 , 0.17, 0.743871124591 );
-    drawBond( -0.655, 9.20425, -13.185, 0.456279685775, -0.0811798695798, 0.0, -0.225827637195 , 0.17, 0.737998814362 );
-    drawBond( -0.349, 9.86675, -13.295, 0.456279685775, -0.0811798695798, 0.0, -0.225827637195 , 0.17, 0.737998814362 );
-    drawBond( -1.11325, 8.8005, -13.3275, 1.76762536965, -0.292875985711, 0.0, 0.452660226017 , 0.17, 0.741458191674 );
-    drawBond( -1.72375, 8.6555, -13.7225, 1.76762536965, -0.292875985711, 0.0, 0.452660226017 , 0.17, 0.741458191674 );
-    drawBond( 1.13475, 4.16675, -14.8275, 2.93056466092, -0.0517351880977, 0.0, -0.0851906097342 , 0.17, 0.689802507969 );
-    drawBond( 1.25825, 3.49225, -14.9025, 2.93056466092, -0.0517351880977, 0.0, -0.0851906097342 , 0.17, 0.689802507969 );
-    drawBond( 1.59840320204, 3.04824037779, -15.0370451688, 1.95630519715, -0.0274046767222, 0.0, -0.342558459028 , 0.075, 0.60899281605 );
-    drawBond( 1.60409679796, 3.03275962221, -14.8879548312, 1.95630519715, -0.0274046767222, 0.0, -0.342558459028 , 0.075, 0.60899281605 );
-    drawBond( 2.16090320204, 2.81924037779, -15.0820451688, 1.95630519715, -0.0274046767222, 0.0, -0.342558459028 , 0.075, 0.60899281605 );
-    drawBond( 2.16659679796, 2.80375962221, -14.9329548312, 1.95630519715, -0.0274046767222, 0.0, -0.342558459028 , 0.075, 0.60899281605 );
-    drawBond( 1.03925, 2.95425, -14.95, 2.19125111909, -0.0138113648855, 0.0, 0.38775406916 , 0.17, 0.690568244274 );
-    drawBond( 0.47775, 2.55275, -14.97, 2.19125111909, -0.0138113648855, 0.0, 0.38775406916 , 0.17, 0.690568244274 );
-    drawBond( -0.13025, 2.45525, -14.9575, 1.26584937889, 0.0309499747577, 0.0, 0.45015018842 , 0.17, 0.687777216837 );
-    drawBond( -0.78475, 2.66175, -14.9125, 1.26584937889, 0.0309499747577, 0.0, 0.45015018842 , 0.17, 0.687777216837 );
-    drawBond( -1.34645301807, 2.56832088542, -14.9770679212, 2.29248410307, -0.015458199685, 0.0, 0.286595022159 , 0.075, 0.618327987398 );
-    drawBond( -1.34104698193, 2.55317911458, -14.8279320788, 2.29248410307, -0.015458199685, 0.0, 0.286595022159 , 0.075, 0.618327987398 );
-    drawBond( -1.80995301807, 2.15982088542, -15.0020679212, 2.29248410307, -0.015458199685, 0.0, 0.286595022159 , 0.075, 0.618327987398 );
-    drawBond( -1.80454698193, 2.14467911458, -14.8529320788, 2.29248410307, -0.015458199685, 0.0, 0.286595022159 , 0.075, 0.618327987398 );
-    drawBond( -1.1925, 3.478, -14.815, 0.153103556623, 0.216431704008, 0.0, 0.232303362302 , 0.17, 1.44287802672 );
-    drawBond( -0.734226815731, 4.59060834529, -14.6404679206, 0.921283743941, 0.067377833892, 0.0, -1.44458075864 , 0.075, 1.34755667784 );
-    drawBond( -0.739773184269, 4.60639165471, -14.7895320794, 0.921283743941, 0.067377833892, 0.0, -1.44458075864 , 0.075, 1.34755667784 );
-    drawBond( 0.1175, 4.8805, -14.715, 1.94510319405, -0.0343245538937, 0.0, -0.437294816606 , 0.17, 0.686491077874 );
-    drawBond( 0.7545, 4.6295, -14.765, 1.94510319405, -0.0343245538937, 0.0, -0.437294816606 , 0.17, 0.686491077874 );
-    drawBond( -1.9785, 4.4385, -14.685, 1.23434085181, 0.164928337771, 0.0, 2.11558076904 , 0.17, 1.49934852519 );
-    drawBond( 2.894, 5.0125, -15.0535, 1.06307722495, 0.113917462621, 0.0, 0.233285521539 , 0.17, 0.545059629765 );
-    drawBond( 2.466, 5.2775, -14.8445, 1.06307722495, 0.113917462621, 0.0, 0.233285521539 , 0.17, 0.545059629765 );
-    drawBond( 2.32375, 6.734, -16.215, 1.56345863, 0.278018888252, 0.0, 0.104938501938 , 0.17, 0.545135075004 );
-    drawBond( 2.13125, 6.738, -15.705, 1.56345863, 0.278018888252, 0.0, 0.104938501938 , 0.17, 0.545135075004 );
-    drawBond( 2.53225, 8.46525, -14.62175, 2.77846483185, 0.0188039479947, 0.0, -0.103830495449 , 0.17, 0.545041970861 );
-    drawBond( 2.72275, 7.95575, -14.58725, 2.77846483185, 0.0188039479947, 0.0, -0.103830495449 , 0.17, 0.545041970861 );
-    drawBond( 3.2545, 7.3515, -12.72225, 1.84769776137, -0.162693248384, 0.0, 0.234910519442 , 0.17, 0.545036007985 );
-    drawBond( 2.8235, 7.2025, -13.02075, 1.84769776137, -0.162693248384, 0.0, 0.234910519442 , 0.17, 0.545036007985 );
-    drawBond( 1.169, 7.0215, -11.87375, 0.822067031237, -0.205745205704, 0.0, -0.0708526536201 , 0.17, 0.545020412462 );
-    drawBond( 1.299, 7.3925, -12.25125, 0.822067031237, -0.205745205704, 0.0, -0.0708526536201 , 0.17, 0.545020412462 );
-    drawBond( 0.31625, 1.593, -15.061, 0.187695969479, 0.0278124770741, 0.0, 0.0409461468036 , 0.17, 0.515045871743 );
-    drawBond( 0.23675, 2.099, -15.007, 0.187695969479, 0.0278124770741, 0.0, 0.0409461468036 , 0.17, 0.515045871743 );
-    drawBond( -0.3105, 5.81075, -14.5985, 2.96609806672, -0.0332370102784, 0.0, -0.0397754385299 , 0.17, 0.544869020958 );
-    drawBond( -0.2375, 5.27425, -14.6595, 2.96609806672, -0.0332370102784, 0.0, -0.0397754385299 , 0.17, 0.544869020958 );
-    drawBond( -2.68625, 5.5035, -14.6195, 3.12845779335, -0.00381532911425, 0.0, -0.000817570524481 , 0.17, 0.545047016321 );
-    drawBond( -2.68475, 4.9585, -14.6265, 3.12845779335, -0.00381532911425, 0.0, -0.000817570524482 , 0.17, 0.545047016321 );
-    drawBond( 7.97525, 3.69225, 15.0725, 1.72378094797, -0.617910518148, 0.0, -0.11361580495 , 0.17, 0.797303894384 );
-    drawBond( 8.11775, 3.57075, 14.2975, 1.72378094797, -0.617910518148, 0.0, -0.11361580495 , 0.17, 0.797303894384 );
-    drawBond( 8.622, -1.70075, 11.6925, 1.80048692262, -0.617818047269, 0.0, -0.0350761213933 , 0.17, 0.797184577121 );
-    drawBond( 8.666, -1.88225, 10.9175, 1.80048692262, -0.617818047269, 0.0, -0.0350761213933 , 0.17, 0.797184577121 );
-    drawBond( 5.97625, -6.44425, 8.3125, 1.78890980538, -0.617813307915, 0.0, 0.0569982600206 , 0.17, 0.797178461826 );
-    drawBond( 5.90475, -6.61675, 7.5375, 1.78890980538, -0.617813307915, 0.0, 0.0569982600206 , 0.17, 0.797178461826 );
-    drawBond( 1.0465, -8.726, 4.9325, 1.69404006317, -0.617821328338, 0.0, 0.126753020911 , 0.17, 0.797188810759 );
-    drawBond( 0.8875, -8.824, 4.1575, 1.69404006317, -0.617821328338, 0.0, 0.126753020911 , 0.17, 0.797188810759 );
-    drawBond( -4.28225, -7.67475, 1.5525, 1.55260794655, -0.617873580061, 0.0, 0.148688287331 , 0.17, 0.797256232337 );
-    drawBond( -4.46875, -7.66025, 0.7775, 1.55260794655, -0.617873580061, 0.0, 0.148688287331 , 0.17, 0.797256232337 );
-    drawBond( -7.97525, -3.69225, -1.8275, 1.41781170562, -0.617910518148, 0.0, 0.11361580495 , 0.17, 0.797303894384 );
-    drawBond( -8.11775, -3.57075, -2.6025, 1.41781170562, -0.617910518148, 0.0, 0.11361580495 , 0.17, 0.797303894384 );
-    drawBond( -8.622, 1.70075, -5.2075, 1.34110573097, -0.617818047269, 0.0, 0.0350761213933 , 0.17, 0.797184577121 );
-    drawBond( -8.666, 1.88225, -5.9825, 1.34110573097, -0.617818047269, 0.0, 0.0350761213933 , 0.17, 0.797184577121 );
-    drawBond( -5.97625, 6.44425, -8.5875, 1.35268284821, -0.617813307915, 0.0, -0.0569982600206 , 0.17, 0.797178461826 );
-    drawBond( -5.90475, 6.61675, -9.3625, 1.35268284821, -0.617813307915, 0.0, -0.0569982600206 , 0.17, 0.797178461826 );
-    drawBond( -1.0465, 8.726, -11.9675, 1.44755259042, -0.617821328338, 0.0, -0.126753020911 , 0.17, 0.797188810759 );
-    drawBond( -0.8875, 8.824, -12.7425, 1.44755259042, -0.617821328338, 0.0, -0.126753020911 , 0.17, 0.797188810759 );
+    glsDisable(GL_COLOR_MATERIAL);
 }
@@ -20,19 +20,45 @@
     #define MOLI_RES 8
     #define BOND_RES 8
 
+    // material palette, one entry per tenth step of red, green and blue
+    #define HELIX_PALETTE_SIZE 1000
+    #define HELIX_COLOR_SEED   779
+
+    // molecule data file, written by helixConvert
+    #define HELIX_DATA_FILE "helix.dat"
+    #define HELIX_MAGIC     0x584c4548      // "HELX" in a little-endian file
+    #define HELIX_VERSION   1
+
+    /* molecule file layout: a header, numAtoms atoms, then numBonds bonds,
+       all in host byte order so the file can be mapped and used in place */
+    typedef struct {
+        GLuint magic;
+        GLuint version;
+        GLuint numAtoms;
+        GLuint numBonds;
+    } helixheader;
+
+    /* sphere at x, y, z */
+    typedef struct {
+        GLfloat x, y, z;
+        GLfloat radius;
+    } helixatom;
+
+    /* cylinder centered at x, y, z, rotated angle radians about ax, ay, az */
+    typedef struct {
+        GLfloat x, y, z;
+        GLfloat angle, ax, ay, az;
+        GLfloat radius, length;
+    } helixbond;
+
     // initialize draw routines
     void initDoubleHelix();
 
-    // generate random material properties
-    void genRandColor();
-
-    // draw a sphere
-    void drawMolicule(GLdouble tx, GLdouble ty, GLdouble tz, GLdouble rad);
+    // release the baked buffers, while their context is current
+    void freeDoubleHelix();
 
-    // draw a cylinder
-    void drawBond(GLdouble tx, GLdouble ty, GLdouble tz,
-                  GLdouble rr, GLdouble rx, GLdouble ry, GLdouble rz,
-                  GLdouble rad, GLdouble h);
+    // pick a random palette entry
+    GLuint genRandColor();
 
     // draw the double helix
     void drawDoubleHelix();
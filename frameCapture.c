@@ -0,0 +1,297 @@
+// standard c headers
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+// OpenGL and GLUT headers
+#ifdef __APPLE__
+    #include <GLUT/glut.h>
+#else
+    #include <GL/gl.h>
+    #include <GL/glu.h>
+    #include <GL/glut.h>
+#endif
+
+// libpng header
+#include <png.h>
+
+// 3d navigation
+#include "navigator.h"
+
+// prototypes and definitions
+#include "frameCapture.h"
+
+// a pixel buffer being filled by the GL
+typedef struct {
+    GLuint buffer;
+    GLsync fence;       // signalled once the read back has landed
+    GLsizei width, height;
+    GLsizeiptr size;    // bytes allocated for the buffer
+    bool busy;
+} capturepbo;
+
+// a frame handed to the writer
+typedef struct {
+    unsigned char *pixels;
+    size_t size;        // bytes allocated for pixels
+    int width, height;
+    int number;
+} captureframe;
+
+static capturepbo pbos[CAPTURE_PBOS];
+static int oldestPBO = 0;   // next to be retired
+static int nextPBO   = 0;   // next to be read into
+
+// frames the writer owns are queue[head] to queue[head + count - 1]
+static captureframe queue[CAPTURE_QUEUE];
+static int queueHead  = 0;
+static int queueCount = 0;
+static bool closing   = false;
+
+static pthread_mutex_t queueLock  = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  queueReady = PTHREAD_COND_INITIALIZER;
+
+static pthread_t writer;
+static bool writerRunning = false;
+
+static bool capturing = false;
+static char filePrefix[256];
+static int  frameNumber  = 0;
+static int  framesDropped = 0;
+
+// write an RGB frame, GL rows bottom up, as a png
+static bool writePNG(const char *fileName, const captureframe *f)
+{
+    FILE *file = fopen(fileName, "wb");
+    png_structp png;
+    png_infop info;
+
+    if (file == NULL) {
+        fprintf(stderr, "Error: could not open %s for writing.\n", fileName);
+        return false;
+    }
+
+    png  = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+    info = png ? png_create_info_struct(png) : NULL;
+    if (info == NULL || setjmp(png_jmpbuf(png))) {
+        fprintf(stderr, "Error: could not encode %s.\n", fileName);
+        png_destroy_write_struct(&png, &info);
+        fclose(file);
+        return false;
+    }
+
+    png_init_io(png, file);
+
+    // favour keeping up with the frames over file size
+    png_set_compression_level(png, 1);
+    png_set_IHDR(png, info, f->width, f->height, 8, PNG_COLOR_TYPE_RGB,
+                 PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+    png_write_info(png, info);
+
+    for (int y = f->height - 1; y >= 0; --y)
+        png_write_row(png, f->pixels + (size_t)y * f->width * 3);
+
+    png_write_end(png, NULL);
+    png_destroy_write_struct(&png, &info);
+    fclose(file);
+    return true;
+}
+
+// encode and write queued frames until told to close
+static void *writerMain(void *unused)
+{
+    char fileName[300];
+
+    pthread_mutex_lock(&queueLock);
+    for (;;) {
+        while (queueCount == 0 && !closing)
+            pthread_cond_wait(&queueReady, &queueLock);
+        if (queueCount == 0)
+            break;
+
+        // the frame stays queued while it's written so its buffer isn't reused
+        captureframe *f = &queue[queueHead];
+        pthread_mutex_unlock(&queueLock);
+
+        snprintf(fileName, sizeof(fileName), "%s_%05d.png", filePrefix, f->number);
+        writePNG(fileName, f);
+
+        pthread_mutex_lock(&queueLock);
+        queueHead = (queueHead + 1) % CAPTURE_QUEUE;
+        --queueCount;
+    }
+    pthread_mutex_unlock(&queueLock);
+
+    return NULL;
+}
+
+// start capturing to numbered png files, false if the writer
+// thread can't be started
+bool captureStart(const char *prefix)
+{
+    if (capturing)
+        return true;
+
+    // a writer still draining the last capture finishes first
+    captureCleanUp();
+
+    snprintf(filePrefix, sizeof(filePrefix), "%s", prefix);
+    frameNumber   = 0;
+    framesDropped = 0;
+    closing = false;
+
+    if (pthread_create(&writer, NULL, writerMain, NULL) != 0) {
+        fprintf(stderr, "Error: could not start the frame writer.\n");
+        return false;
+    }
+    writerRunning = true;
+
+    for (int i = 0; i < CAPTURE_PBOS; ++i)
+        if (pbos[i].buffer == 0)
+            glGenBuffers(1, &pbos[i].buffer);
+
+    capturing = true;
+    return true;
+}
+
+// copy a finished pixel buffer to the writer, dropping it if the
+// writer is too far behind
+static void retirePBO(capturepbo *p)
+{
+    captureframe *f = NULL;
+    size_t size = (size_t)p->width * p->height * 3;
+
+    pthread_mutex_lock(&queueLock);
+    if (queueCount < CAPTURE_QUEUE)
+        f = &queue[(queueHead + queueCount) % CAPTURE_QUEUE];
+    pthread_mutex_unlock(&queueLock);
+
+    if (f != NULL && f->size < size) {
+        free(f->pixels);
+        f->pixels = malloc(size);
+        f->size = (f->pixels != NULL) ? size : 0;
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, p->buffer);
+    const void *pixels = (f != NULL && f->pixels != NULL) ?
+                         glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY) : NULL;
+
+    if (pixels != NULL) {
+        memcpy(f->pixels, pixels, size);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+
+        f->width  = p->width;
+        f->height = p->height;
+        f->number = frameNumber++;
+
+        pthread_mutex_lock(&queueLock);
+        ++queueCount;
+        pthread_cond_signal(&queueReady);
+        pthread_mutex_unlock(&queueLock);
+    } else
+        ++framesDropped;
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    glDeleteSync(p->fence);
+    p->fence = NULL;
+    p->busy  = false;
+}
+
+// hand over every pixel buffer the GL has finished with, or all of
+// them when wait is set
+static void retireFinished(bool wait)
+{
+    while (pbos[oldestPBO].busy) {
+        capturepbo *p = &pbos[oldestPBO];
+        GLenum status = glClientWaitSync(p->fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+                                         wait ? GL_TIMEOUT_IGNORED : 0);
+
+        if (status == GL_TIMEOUT_EXPIRED)
+            break;
+
+        retirePBO(p);
+        oldestPBO = (oldestPBO + 1) % CAPTURE_PBOS;
+    }
+}
+
+// read back the frame just drawn, call before the buffers swap
+void captureFrame()
+{
+    GLint viewport[4];
+
+    if (!capturing)
+        return;
+
+    retireFinished(false);
+
+    // every buffer still in flight, skip this frame
+    capturepbo *p = &pbos[nextPBO];
+    if (p->busy) {
+        ++framesDropped;
+        return;
+    }
+
+    navGetViewport(viewport);
+    p->width  = viewport[2];
+    p->height = viewport[3];
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, p->buffer);
+    GLsizeiptr size = (GLsizeiptr)p->width * p->height * 3;
+    if (p->size != size) {
+        glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+        p->size = size;
+    }
+
+    // into the buffer, so this returns without waiting on the GL
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, p->width, p->height, GL_RGB, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    p->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    p->busy  = true;
+    nextPBO = (nextPBO + 1) % CAPTURE_PBOS;
+}
+
+// stop capturing; frames already read back are still written
+void captureStop()
+{
+    if (!capturing)
+        return;
+
+    retireFinished(true);
+    capturing = false;
+
+    // the writer exits once the queue is empty
+    pthread_mutex_lock(&queueLock);
+    closing = true;
+    pthread_cond_signal(&queueReady);
+    pthread_mutex_unlock(&queueLock);
+
+    printf("Captured %d frames to %s_*.png, dropped %d\n", frameNumber, filePrefix, framesDropped);
+}
+
+// wait for the writer and release the buffers
+void captureCleanUp()
+{
+    captureStop();
+
+    if (writerRunning) {
+        pthread_join(writer, NULL);
+        writerRunning = false;
+    }
+
+    for (int i = 0; i < CAPTURE_QUEUE; ++i) {
+        free(queue[i].pixels);
+        queue[i].pixels = NULL;
+        queue[i].size = 0;
+    }
+
+    for (int i = 0; i < CAPTURE_PBOS; ++i) {
+        glDeleteBuffers(1, &pbos[i].buffer);
+        pbos[i].buffer = 0;
+        pbos[i].size = 0;
+    }
+    oldestPBO = nextPBO = 0;
+}
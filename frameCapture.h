@@ -0,0 +1,48 @@
+#ifndef FRAMECAPTURE_H
+    #define FRAMECAPTURE_H
+
+    // make c++ friendly
+    #ifdef __cplusplus
+        extern "C" {
+    #endif
+
+    // OpenGL and GLUT headers
+    #ifdef __APPLE__
+        #include <GLUT/glut.h>
+    #else
+        #include <GL/gl.h>
+        #include <GL/glu.h>
+        #include <GL/glut.h>
+    #endif
+
+    #include <stdbool.h>
+
+    // pixel buffers read back into, a frame is mapped once the GL
+    // has finished filling its buffer, normally a frame or two later
+    #define CAPTURE_PBOS 3
+
+    // frames waiting on the writer thread; more than this and new
+    // frames are dropped rather than holding up the render loop
+    #define CAPTURE_QUEUE 8
+
+    // file names are prefix_NNNNN.png
+    #define CAPTURE_PREFIX "capture"
+
+    // start capturing to numbered png files, false if the writer
+    // thread can't be started
+    bool captureStart(const char *prefix);
+
+    // read back the frame just drawn, call before the buffers swap
+    void captureFrame();
+
+    // stop capturing; frames already read back are still written
+    void captureStop();
+
+    // wait for the writer and release the buffers
+    void captureCleanUp();
+
+    #ifdef __cplusplus
+        }
+    #endif
+
+#endif
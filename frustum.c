@@ -0,0 +1,132 @@
+
+// OpenGL and GLUT headers
+#ifdef __APPLE__
+    #include <GLUT/glut.h>
+#else
+    #include <GL/gl.h>
+    #include <GL/glu.h>
+    #include <GL/glut.h>
+#endif
+
+// standard c headers
+#include <stdbool.h>
+#include <math.h>
+
+// prototypes and definitions
+#include "frustum.h"
+
+// extract the planes from column-major projection and view matrices
+// rows of proj * view combine into left, right, bottom, top, near, far
+void frustumFromMatrices(viewfrustum *f, const GLdouble proj[16], const GLdouble view[16])
+{
+    GLdouble *clip = f->clip;
+
+    for (int c = 0; c < 4; ++c)
+        for (int r = 0; r < 4; ++r)
+            clip[c * 4 + r] = proj[r]      * view[c * 4]     + proj[4 + r]  * view[c * 4 + 1] +
+                              proj[8 + r]  * view[c * 4 + 2] + proj[12 + r] * view[c * 4 + 3];
+
+    for (int i = 0; i < 3; ++i) {
+        for (int k = 0; k < 4; ++k) {
+            GLdouble w   = clip[k * 4 + 3];
+            GLdouble row = clip[k * 4 + i];
+
+            f->planes[i * 2][k]     = w + row;
+            f->planes[i * 2 + 1][k] = w - row;
+        }
+    }
+}
+
+// true when the world-space box min, max lies outside the frustum
+// only the corner furthest along each plane normal is tested
+bool frustumCullsBox(const viewfrustum *f, const GLdouble min[3], const GLdouble max[3])
+{
+    for (int i = 0; i < 6; ++i) {
+        const GLdouble *p = f->planes[i];
+
+        GLdouble x = (p[0] >= 0.0) ? max[0] : min[0];
+        GLdouble y = (p[1] >= 0.0) ? max[1] : min[1];
+        GLdouble z = (p[2] >= 0.0) ? max[2] : min[2];
+
+        if (p[0] * x + p[1] * y + p[2] * z + p[3] < 0.0)
+            return true;
+    }
+
+    return false;
+}
+
+// distance of a world-space point in front of the eye
+// for a perspective projection clip w is the eye-space depth
+GLdouble frustumDepth(const viewfrustum *f, const GLdouble p[3])
+{
+    return f->clip[3] * p[0] + f->clip[7] * p[1] + f->clip[11] * p[2] + f->clip[15];
+}
+
+// screen rectangle x, y, width, height covered by the convex polygon
+// corners are taken to clip space and cut at the near plane, so a
+// polygon that passes behind the camera still gives the right bounds
+bool frustumScreenRect(const viewfrustum *f, const GLdouble corners[][3], int n,
+                       const GLint viewport[4], GLint rect[4])
+{
+    GLdouble in[MAX_POLY_CORNERS][4];
+    GLdouble out[MAX_POLY_CORNERS + 1][4];
+    int      numOut = 0;
+
+    if (n > MAX_POLY_CORNERS)
+        n = MAX_POLY_CORNERS;
+
+    for (int i = 0; i < n; ++i)
+        for (int r = 0; r < 4; ++r)
+            in[i][r] = f->clip[r]     * corners[i][0] + f->clip[4 + r]  * corners[i][1] +
+                       f->clip[8 + r] * corners[i][2] + f->clip[12 + r];
+
+    // keep the part in front of the near plane, z >= -w
+    for (int i = 0; i < n; ++i) {
+        const GLdouble *a = in[i];
+        const GLdouble *b = in[(i + 1) % n];
+        GLdouble da = a[2] + a[3];
+        GLdouble db = b[2] + b[3];
+
+        if (da >= 0.0) {
+            for (int r = 0; r < 4; ++r)
+                out[numOut][r] = a[r];
+            ++numOut;
+        }
+
+        if ((da >= 0.0) != (db >= 0.0)) {
+            GLdouble t = da / (da - db);
+            for (int r = 0; r < 4; ++r)
+                out[numOut][r] = a[r] + (b[r] - a[r]) * t;
+            ++numOut;
+        }
+    }
+
+    if (numOut == 0)
+        return false;
+
+    // bounds in normalized device coordinates
+    GLdouble minX = 1.0, maxX = -1.0, minY = 1.0, maxY = -1.0;
+    for (int i = 0; i < numOut; ++i) {
+        GLdouble x = out[i][0] / out[i][3];
+        GLdouble y = out[i][1] / out[i][3];
+
+        minX = fmin(minX, x);  maxX = fmax(maxX, x);
+        minY = fmin(minY, y);  maxY = fmax(maxY, y);
+    }
+
+    minX = fmax(minX, -1.0);  maxX = fmin(maxX, 1.0);
+    minY = fmax(minY, -1.0);  maxY = fmin(maxY, 1.0);
+    if (minX >= maxX || minY >= maxY)
+        return false;
+
+    GLint x0 = (GLint)floor(viewport[0] + (minX + 1.0) * 0.5 * viewport[2]);
+    GLint x1 = (GLint)ceil (viewport[0] + (maxX + 1.0) * 0.5 * viewport[2]);
+    GLint y0 = (GLint)floor(viewport[1] + (minY + 1.0) * 0.5 * viewport[3]);
+    GLint y1 = (GLint)ceil (viewport[1] + (maxY + 1.0) * 0.5 * viewport[3]);
+
+    rect[0] = x0;
+    rect[1] = y0;
+    rect[2] = x1 - x0;
+    rect[3] = y1 - y0;
+    return true;
+}
@@ -0,0 +1,49 @@
+#ifndef FRUSTUM_H
+    #define FRUSTUM_H
+
+    // make c++ friendly
+    #ifdef __cplusplus
+        extern "C" {
+    #endif
+
+    // OpenGL and GLUT headers
+    #ifdef __APPLE__
+        #include <GLUT/glut.h>
+    #else
+        #include <GL/gl.h>
+        #include <GL/glu.h>
+        #include <GL/glut.h>
+    #endif
+
+    #include <stdbool.h>
+
+    // the six clip planes of a view, each a, b, c, d with
+    // a * x + b * y + c * z + d >= 0 on the inside
+    typedef struct {
+        GLdouble planes[6][4];
+        GLdouble clip[16];      // projection * view, column major
+    } viewfrustum;
+
+    // most corners a projected polygon may have
+    #define MAX_POLY_CORNERS 8
+
+    // extract the planes from column-major projection and view matrices
+    void frustumFromMatrices(viewfrustum *f, const GLdouble proj[16], const GLdouble view[16]);
+
+    // true when the world-space box min, max lies outside the frustum
+    bool frustumCullsBox(const viewfrustum *f, const GLdouble min[3], const GLdouble max[3]);
+
+    // distance of a world-space point in front of the eye
+    GLdouble frustumDepth(const viewfrustum *f, const GLdouble p[3]);
+
+    // screen rectangle x, y, width, height covered by the convex polygon
+    // corners, clipped to the near plane and the viewport
+    // false when none of it is on screen
+    bool frustumScreenRect(const viewfrustum *f, const GLdouble corners[][3], int n,
+                           const GLint viewport[4], GLint rect[4]);
+
+    #ifdef __cplusplus
+        }
+    #endif
+
+#endif
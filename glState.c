@@ -0,0 +1,345 @@
+
+// OpenGL and GLUT headers
+#ifdef __APPLE__
+    #include <GLUT/glut.h>
+#else
+    #include <GL/gl.h>
+    #include <GL/glu.h>
+    #include <GL/glut.h>
+#endif
+
+// standard c headers
+#include <stdbool.h>
+#include <string.h>
+
+// prototypes and definitions
+#include "glState.h"
+
+// shadowed material parameters of one face
+#define MAT_AMBIENT    0
+#define MAT_DIFFUSE    1
+#define MAT_SPECULAR   2
+#define MAT_EMISSION   3
+#define MAT_SHININESS  4
+#define NUM_MAT_PARAMS 5
+
+typedef struct {
+    GLfloat value[NUM_MAT_PARAMS][4];
+    bool    known[NUM_MAT_PARAMS];
+} facematerial;
+
+// a capability and whether it is on, off or unknown
+typedef struct {
+    GLenum cap;
+    int    state;       // 1 on, 0 off, -1 unknown
+} capstate;
+
+// everything the layer remembers
+static capstate     caps[GLS_MAX_CAPS];
+static int          numCaps = 0;
+static facematerial material[2];            // front, back
+static GLenum       colorMatFace = GL_FRONT_AND_BACK;
+static GLenum       colorMatMode = GL_AMBIENT_AND_DIFFUSE;
+static GLuint       boundTexture;
+static bool         boundTextureKnown = false;
+static GLenum       blendSrc, blendDst;
+static bool         blendKnown = false;
+static GLenum       cullMode;
+static bool         cullKnown = false;
+static GLboolean    depthMask;
+static bool         depthMaskKnown = false;
+static GLboolean    colorMask[4];
+static bool         colorMaskKnown = false;
+
+static glsstats     stats;
+
+// find the shadow of cap, adding it if there is room
+static capstate *findCap(GLenum cap)
+{
+    for (int i = 0; i < numCaps; ++i)
+        if (caps[i].cap == cap)
+            return &caps[i];
+
+    if (numCaps >= GLS_MAX_CAPS)
+        return NULL;
+
+    caps[numCaps].cap   = cap;
+    caps[numCaps].state = -1;
+    return &caps[numCaps++];
+}
+
+// forget the parameters that glColor drives while color material is on
+static void forgetColorMaterial()
+{
+    for (int f = 0; f < 2; ++f) {
+        if ((f == 0 && colorMatFace == GL_BACK) || (f == 1 && colorMatFace == GL_FRONT))
+            continue;
+
+        switch (colorMatMode) {
+            case GL_AMBIENT:  material[f].known[MAT_AMBIENT]  = false;  break;
+            case GL_DIFFUSE:  material[f].known[MAT_DIFFUSE]  = false;  break;
+            case GL_SPECULAR: material[f].known[MAT_SPECULAR] = false;  break;
+            case GL_EMISSION: material[f].known[MAT_EMISSION] = false;  break;
+            case GL_AMBIENT_AND_DIFFUSE:
+                material[f].known[MAT_AMBIENT] = false;
+                material[f].known[MAT_DIFFUSE] = false;
+                break;
+        }
+    }
+}
+
+// set cap to on or off unless it already is
+static void setCap(GLenum cap, int on)
+{
+    capstate *c = findCap(cap);
+
+    ++stats.calls;
+    if (c && c->state == on) {
+        ++stats.filtered;
+        return;
+    }
+
+    if (on)
+        glEnable(cap);
+    else
+        glDisable(cap);
+
+    if (c)
+        c->state = on;
+
+    // glColor may have changed the tracked material while it was on
+    if (cap == GL_COLOR_MATERIAL)
+        forgetColorMaterial();
+}
+
+void glsEnable(GLenum cap)
+{
+    setCap(cap, 1);
+}
+
+void glsDisable(GLenum cap)
+{
+    setCap(cap, 0);
+}
+
+// answered from the shadow when possible, without a round trip
+GLboolean glsIsEnabled(GLenum cap)
+{
+    capstate *c = findCap(cap);
+
+    if (c == NULL)
+        return glIsEnabled(cap);
+
+    if (c->state < 0)
+        c->state = glIsEnabled(cap) ? 1 : 0;
+
+    return c->state ? GL_TRUE : GL_FALSE;
+}
+
+// shadow slot and value count for a material parameter, -1 if not shadowed
+static int materialSlot(GLenum pname, int *count)
+{
+    *count = 4;
+
+    switch (pname) {
+        case GL_AMBIENT:   return MAT_AMBIENT;
+        case GL_DIFFUSE:   return MAT_DIFFUSE;
+        case GL_SPECULAR:  return MAT_SPECULAR;
+        case GL_EMISSION:  return MAT_EMISSION;
+        case GL_SHININESS: *count = 1;  return MAT_SHININESS;
+    }
+
+    return -1;
+}
+
+// true when every face in face already holds params for slot
+static bool materialMatches(GLenum face, int slot, const GLfloat *params, int count)
+{
+    for (int f = 0; f < 2; ++f) {
+        if ((f == 0 && face == GL_BACK) || (f == 1 && face == GL_FRONT))
+            continue;
+
+        if (!material[f].known[slot] ||
+            memcmp(material[f].value[slot], params, count * sizeof(GLfloat)) != 0)
+            return false;
+    }
+
+    return true;
+}
+
+// record params for slot on every face in face
+static void materialStore(GLenum face, int slot, const GLfloat *params, int count)
+{
+    for (int f = 0; f < 2; ++f) {
+        if ((f == 0 && face == GL_BACK) || (f == 1 && face == GL_FRONT))
+            continue;
+
+        memcpy(material[f].value[slot], params, count * sizeof(GLfloat));
+        material[f].known[slot] = true;
+    }
+}
+
+void glsMaterialfv(GLenum face, GLenum pname, const GLfloat *params)
+{
+    int count;
+
+    ++stats.calls;
+
+    if (pname == GL_AMBIENT_AND_DIFFUSE) {
+        if (materialMatches(face, MAT_AMBIENT, params, 4) &&
+            materialMatches(face, MAT_DIFFUSE, params, 4)) {
+            ++stats.filtered;
+            return;
+        }
+
+        glMaterialfv(face, pname, params);
+        materialStore(face, MAT_AMBIENT, params, 4);
+        materialStore(face, MAT_DIFFUSE, params, 4);
+    } else {
+        int slot = materialSlot(pname, &count);
+
+        if (slot >= 0 && materialMatches(face, slot, params, count)) {
+            ++stats.filtered;
+            return;
+        }
+
+        glMaterialfv(face, pname, params);
+        if (slot >= 0)
+            materialStore(face, slot, params, count);
+    }
+
+    // parameters driven by glColor can not be trusted
+    capstate *c = findCap(GL_COLOR_MATERIAL);
+    if (c == NULL || c->state != 0)
+        forgetColorMaterial();
+}
+
+void glsMaterialf(GLenum face, GLenum pname, GLfloat param)
+{
+    glsMaterialfv(face, pname, &param);
+}
+
+void glsColorMaterial(GLenum face, GLenum mode)
+{
+    ++stats.calls;
+    if (face == colorMatFace && mode == colorMatMode) {
+        ++stats.filtered;
+        return;
+    }
+
+    forgetColorMaterial();
+    glColorMaterial(face, mode);
+    colorMatFace = face;
+    colorMatMode = mode;
+    forgetColorMaterial();
+}
+
+// only the 2D binding of the active unit is shadowed
+void glsBindTexture(GLenum target, GLuint texture)
+{
+    ++stats.calls;
+
+    if (target != GL_TEXTURE_2D) {
+        glBindTexture(target, texture);
+        return;
+    }
+
+    if (boundTextureKnown && boundTexture == texture) {
+        ++stats.filtered;
+        return;
+    }
+
+    glBindTexture(target, texture);
+    boundTexture      = texture;
+    boundTextureKnown = true;
+}
+
+void glsBlendFunc(GLenum sfactor, GLenum dfactor)
+{
+    ++stats.calls;
+    if (blendKnown && blendSrc == sfactor && blendDst == dfactor) {
+        ++stats.filtered;
+        return;
+    }
+
+    glBlendFunc(sfactor, dfactor);
+    blendSrc   = sfactor;
+    blendDst   = dfactor;
+    blendKnown = true;
+}
+
+void glsCullFace(GLenum mode)
+{
+    ++stats.calls;
+    if (cullKnown && cullMode == mode) {
+        ++stats.filtered;
+        return;
+    }
+
+    glCullFace(mode);
+    cullMode  = mode;
+    cullKnown = true;
+}
+
+void glsDepthMask(GLboolean flag)
+{
+    ++stats.calls;
+    if (depthMaskKnown && depthMask == flag) {
+        ++stats.filtered;
+        return;
+    }
+
+    glDepthMask(flag);
+    depthMask      = flag;
+    depthMaskKnown = true;
+}
+
+void glsColorMask(GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+{
+    ++stats.calls;
+    if (colorMaskKnown && colorMask[0] == r && colorMask[1] == g &&
+        colorMask[2] == b && colorMask[3] == a) {
+        ++stats.filtered;
+        return;
+    }
+
+    glColorMask(r, g, b, a);
+    colorMask[0] = r;  colorMask[1] = g;
+    colorMask[2] = b;  colorMask[3] = a;
+    colorMaskKnown = true;
+}
+
+// forget every shadowed value
+void glsInvalidate()
+{
+    for (int i = 0; i < numCaps; ++i)
+        caps[i].state = -1;
+
+    memset(material, 0, sizeof(material));
+
+    // color material decides which material values can be trusted,
+    // so read it back once rather than leave it unknown
+    GLint face, mode;
+    glGetIntegerv(GL_COLOR_MATERIAL_FACE, &face);
+    glGetIntegerv(GL_COLOR_MATERIAL_PARAMETER, &mode);
+    colorMatFace = face;
+    colorMatMode = mode;
+    glsIsEnabled(GL_COLOR_MATERIAL);
+
+    boundTextureKnown = false;
+    blendKnown        = false;
+    cullKnown         = false;
+    depthMaskKnown    = false;
+    colorMaskKnown    = false;
+}
+
+void glsGetStats(glsstats *s)
+{
+    *s = stats;
+}
+
+void glsResetStats()
+{
+    stats.calls    = 0;
+    stats.filtered = 0;
+}
@@ -0,0 +1,52 @@
+#ifndef GLSTATE_H
+    #define GLSTATE_H
+
+    // make c++ friendly
+    #ifdef __cplusplus
+        extern "C" {
+    #endif
+
+    // OpenGL and GLUT headers
+    #ifdef __APPLE__
+        #include <GLUT/glut.h>
+    #else
+        #include <GL/gl.h>
+        #include <GL/glu.h>
+        #include <GL/glut.h>
+    #endif
+
+    // most capabilities that are shadowed, others go straight to the GL
+    #define GLS_MAX_CAPS 32
+
+    // calls made through the layer and how many were dropped as no-ops
+    typedef struct {
+        unsigned long calls;
+        unsigned long filtered;
+    } glsstats;
+
+    // drop-ins for the GL calls of the same name; each remembers the
+    // value it last set and skips the call when nothing would change
+    void      glsEnable(GLenum cap);
+    void      glsDisable(GLenum cap);
+    GLboolean glsIsEnabled(GLenum cap);
+    void      glsMaterialfv(GLenum face, GLenum pname, const GLfloat *params);
+    void      glsMaterialf(GLenum face, GLenum pname, GLfloat param);
+    void      glsColorMaterial(GLenum face, GLenum mode);
+    void      glsBindTexture(GLenum target, GLuint texture);
+    void      glsBlendFunc(GLenum sfactor, GLenum dfactor);
+    void      glsCullFace(GLenum mode);
+    void      glsDepthMask(GLboolean flag);
+    void      glsColorMask(GLboolean r, GLboolean g, GLboolean b, GLboolean a);
+
+    // forget every shadowed value, needed for a new context or after
+    // state was changed behind the layer's back
+    void      glsInvalidate();
+
+    void      glsGetStats(glsstats *stats);         // counts since the last reset
+    void      glsResetStats();                      // zero the counts
+
+    #ifdef __cplusplus
+        }
+    #endif
+
+#endif
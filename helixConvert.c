@@ -0,0 +1,89 @@
+
+/*
+ *  Write the molecule table in helixData.c to a HELIX_DATA_FILE
+ *
+ *  usage: helixConvert [output file]
+ */
+
+// standard c headers
+#include <stdio.h>
+#include <stdlib.h>
+
+// prototypes and file format
+#include "helixConvert.h"
+
+// records collected from the table
+static helixatom *atoms = NULL;
+static int        numAtoms, maxAtoms;
+static helixbond *bonds = NULL;
+static int        numBonds, maxBonds;
+
+// make room for one more record
+static void *grow(void *list, int count, int *max, size_t size)
+{
+    if (count < *max)
+        return list;
+
+    *max = (*max > 0) ? *max * 2 : 512;
+    list = realloc(list, *max * size);
+    if (!list) {
+        fprintf(stderr, "Error: Out of memory converting molecule\n");
+        exit(EXIT_FAILURE);
+    }
+    return list;
+}
+
+// record a sphere
+void addMolicule(GLdouble x, GLdouble y, GLdouble z, GLdouble radius)
+{
+    atoms = grow(atoms, numAtoms, &maxAtoms, sizeof(helixatom));
+
+    helixatom *a = &atoms[numAtoms++];
+    a->x = x;  a->y = y;  a->z = z;
+    a->radius = radius;
+}
+
+// record a cylinder
+void addBond(GLdouble tx, GLdouble ty, GLdouble tz,
+             GLdouble angleRad, GLdouble rx, GLdouble ry, GLdouble rz,
+             GLdouble radius, GLdouble height)
+{
+    bonds = grow(bonds, numBonds, &maxBonds, sizeof(helixbond));
+
+    helixbond *b = &bonds[numBonds++];
+    b->x = tx;  b->y = ty;  b->z = tz;
+    b->angle = angleRad;
+    b->ax = rx;  b->ay = ry;  b->az = rz;
+    b->radius = radius;
+    b->length = height;
+}
+
+int main(int nargs, char *args[])
+{
+    const char *filename = (nargs > 1) ? args[1] : HELIX_DATA_FILE;
+
+    genDoubleHelix();
+
+    helixheader header = { HELIX_MAGIC, HELIX_VERSION, numAtoms, numBonds };
+
+    FILE *fp = fopen(filename, "wb");
+    if (!fp) {
+        fprintf(stderr, "Error: Could not open \"%s\" for writing!\n", filename);
+        return EXIT_FAILURE;
+    }
+
+    if (fwrite(&header, sizeof(header), 1, fp) != 1 ||
+        fwrite(atoms, sizeof(helixatom), numAtoms, fp) != (size_t)numAtoms ||
+        fwrite(bonds, sizeof(helixbond), numBonds, fp) != (size_t)numBonds) {
+        fprintf(stderr, "Error: Could not write \"%s\"!\n", filename);
+        fclose(fp);
+        return EXIT_FAILURE;
+    }
+
+    fclose(fp);
+    printf("Wrote %s: %d atoms, %d bonds\n", filename, numAtoms, numBonds);
+
+    free(atoms);
+    free(bonds);
+    return EXIT_SUCCESS;
+}
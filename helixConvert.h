@@ -0,0 +1,28 @@
+#ifndef HELIXCONVERT_H
+    #define HELIXCONVERT_H
+
+    // make c++ friendly
+    #ifdef __cplusplus
+        extern "C" {
+    #endif
+
+    // molecule file format
+    #include "doubleHelix.h"
+
+    // add a sphere at tx, ty, tz with radius rad
+    void addMolicule(GLdouble tx, GLdouble ty, GLdouble tz, GLdouble rad);
+
+    // add a cylinder at tx, ty, tz rotated rr radians about rx, ry, rz
+    // with radius rad and height h
+    void addBond(GLdouble tx, GLdouble ty, GLdouble tz,
+                 GLdouble rr, GLdouble rx, GLdouble ry, GLdouble rz,
+                 GLdouble rad, GLdouble h);
+
+    // emit every atom and bond of the molecule
+    void genDoubleHelix();
+
+    #ifdef __cplusplus
+        }
+    #endif
+
+#endif
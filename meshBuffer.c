@@ -0,0 +1,246 @@
+
+// OpenGL and GLUT headers
+#ifdef __APPLE__
+    #include <GLUT/glut.h>
+#else
+    #include <GL/gl.h>
+    #include <GL/glu.h>
+    #include <GL/glut.h>
+#endif
+
+// standard c headers
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <math.h>
+
+// prototypes and definitions
+#include "meshBuffer.h"
+
+// grow a staging array so it can hold at least need elements
+static void *growArray(void *array, GLsizei *capacity, GLsizei need, size_t size)
+{
+    if (need <= *capacity)
+        return array;
+
+    GLsizei newCapacity = (*capacity > 0) ? *capacity : 256;
+    while (newCapacity < need)
+        newCapacity *= 2;
+
+    array = realloc(array, newCapacity * size);
+    if (!array) {
+        fprintf(stderr, "Error: Out of memory baking mesh (%d elements)\n", newCapacity);
+        exit(EXIT_FAILURE);
+    }
+
+    *capacity = newCapacity;
+    return array;
+}
+
+// create an empty mesh
+glmesh *genMesh()
+{
+    glmesh *m = calloc(1, sizeof(glmesh));
+    if (!m) {
+        fprintf(stderr, "Error: Out of memory creating mesh\n");
+        exit(EXIT_FAILURE);
+    }
+
+    m->color[0] = m->color[1] = m->color[2] = m->color[3] = 255;
+    return m;
+}
+
+// append a vertex and return its index
+GLuint meshAddVertex(glmesh *m,
+                     GLfloat px, GLfloat py, GLfloat pz,
+                     GLfloat nx, GLfloat ny, GLfloat nz,
+                     GLfloat s,  GLfloat t)
+{
+    m->verts = growArray(m->verts, &m->maxVerts, m->numVerts + 1, sizeof(meshvertex));
+
+    meshvertex *v = &m->verts[m->numVerts];
+    v->pos[0] = px;  v->pos[1] = py;  v->pos[2] = pz;
+    v->normal[0] = nx;  v->normal[1] = ny;  v->normal[2] = nz;
+    v->tex[0] = s;  v->tex[1] = t;
+    v->color[0] = m->color[0];  v->color[1] = m->color[1];
+    v->color[2] = m->color[2];  v->color[3] = m->color[3];
+
+    return (GLuint)m->numVerts++;
+}
+
+// append a counter-clockwise triangle to the current group
+void meshAddTriangle(glmesh *m, GLuint a, GLuint b, GLuint c)
+{
+    // meshes without explicit groups get a single implicit one
+    if (m->numGroups == 0)
+        meshBeginGroup(m);
+
+    m->indices = growArray(m->indices, &m->maxIndices, m->numIndices + 3, sizeof(GLuint));
+
+    m->indices[m->numIndices++] = a;
+    m->indices[m->numIndices++] = b;
+    m->indices[m->numIndices++] = c;
+    m->groups[m->numGroups - 1].count += 3;
+}
+
+// start a new draw group at the current end of the index list
+int meshBeginGroup(glmesh *m)
+{
+    if (m->numGroups >= MAX_MESH_GROUPS) {
+        fprintf(stderr, "Error: Mesh group limit is %d\n", MAX_MESH_GROUPS);
+        exit(EXIT_FAILURE);
+    }
+
+    m->groups[m->numGroups].first = m->numIndices;
+    m->groups[m->numGroups].count = 0;
+    return m->numGroups++;
+}
+
+// set the color given to vertices added from now on
+// a mesh with colors is drawn with a color array
+void meshSetColor(glmesh *m, const GLfloat color[4])
+{
+    for (int i = 0; i < 4; ++i)
+        m->color[i] = (GLubyte)(fmin(fmax(color[i], 0.0), 1.0) * 255.0 + 0.5);
+
+    m->hasColor = GL_TRUE;
+}
+
+// append a copy of the staged mesh src, scaled by scale and then
+// transformed by the column-major matrix xform
+// xform must be rigid; normals are corrected for the scale only
+void meshAppend(glmesh *m, const glmesh *src, const GLdouble xform[16], const GLdouble scale[3])
+{
+    GLuint base = m->numVerts;
+
+    for (GLsizei i = 0; i < src->numVerts; ++i) {
+        const meshvertex *v = &src->verts[i];
+
+        GLdouble p[3], n[3], len;
+        for (int k = 0; k < 3; ++k) {
+            p[k] = v->pos[k] * scale[k];
+            n[k] = v->normal[k] / scale[k];
+        }
+
+        len = sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        if (len > 0.0) {
+            n[0] /= len;  n[1] /= len;  n[2] /= len;
+        }
+
+        meshAddVertex(m,
+                      xform[0] * p[0] + xform[4] * p[1] + xform[8]  * p[2] + xform[12],
+                      xform[1] * p[0] + xform[5] * p[1] + xform[9]  * p[2] + xform[13],
+                      xform[2] * p[0] + xform[6] * p[1] + xform[10] * p[2] + xform[14],
+                      xform[0] * n[0] + xform[4] * n[1] + xform[8]  * n[2],
+                      xform[1] * n[0] + xform[5] * n[1] + xform[9]  * n[2],
+                      xform[2] * n[0] + xform[6] * n[1] + xform[10] * n[2],
+                      v->tex[0], v->tex[1]);
+    }
+
+    for (GLsizei i = 0; i < src->numIndices; i += 3)
+        meshAddTriangle(m, base + src->indices[i], base + src->indices[i + 1], base + src->indices[i + 2]);
+}
+
+// copy the staged geometry to buffer objects
+// the CPU copy is released since the geometry never changes
+void meshUpload(glmesh *m)
+{
+    glGenBuffers(1, &m->vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, m->vbo);
+    glBufferData(GL_ARRAY_BUFFER, m->numVerts * sizeof(meshvertex), m->verts, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glGenBuffers(1, &m->ibo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m->ibo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, m->numIndices * sizeof(GLuint), m->indices, GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+    free(m->verts);
+    free(m->indices);
+    m->verts      = NULL;
+    m->indices    = NULL;
+    m->maxVerts   = 0;
+    m->maxIndices = 0;
+}
+
+// bind buffers and set up the vertex arrays
+static void meshBind(glmesh *m)
+{
+    glBindBuffer(GL_ARRAY_BUFFER, m->vbo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m->ibo);
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_NORMAL_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+
+    glVertexPointer(3, GL_FLOAT, sizeof(meshvertex), (const GLvoid *)offsetof(meshvertex, pos));
+    glNormalPointer(GL_FLOAT, sizeof(meshvertex), (const GLvoid *)offsetof(meshvertex, normal));
+    glTexCoordPointer(2, GL_FLOAT, sizeof(meshvertex), (const GLvoid *)offsetof(meshvertex, tex));
+
+    if (m->hasColor) {
+        glEnableClientState(GL_COLOR_ARRAY);
+        glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(meshvertex), (const GLvoid *)offsetof(meshvertex, color));
+    }
+}
+
+// restore the default array state
+static void meshUnbind()
+{
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glDisableClientState(GL_NORMAL_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+// draw the whole mesh in one call
+void meshDraw(glmesh *m)
+{
+    if (m == NULL || m->numIndices == 0)
+        return;
+
+    meshBind(m);
+    glDrawElements(GL_TRIANGLES, m->numIndices, GL_UNSIGNED_INT, (const GLvoid *)0);
+    meshUnbind();
+}
+
+// draw one group of the mesh
+void meshDrawGroup(glmesh *m, int group)
+{
+    if (m == NULL || group < 0 || group >= m->numGroups || m->groups[group].count == 0)
+        return;
+
+    meshBind(m);
+    glDrawElements(GL_TRIANGLES, m->groups[group].count, GL_UNSIGNED_INT,
+                   (const GLvoid *)(m->groups[group].first * sizeof(GLuint)));
+    meshUnbind();
+}
+
+// draw count indices from first, a range inside a group
+void meshDrawRange(glmesh *m, GLsizei first, GLsizei count)
+{
+    if (m == NULL || count == 0)
+        return;
+
+    meshBind(m);
+    glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, (const GLvoid *)(first * sizeof(GLuint)));
+    meshUnbind();
+}
+
+// release buffers and memory
+void meshFree(glmesh *m)
+{
+    if (m == NULL)
+        return;
+
+    if (m->vbo)
+        glDeleteBuffers(1, &m->vbo);
+    if (m->ibo)
+        glDeleteBuffers(1, &m->ibo);
+
+    free(m->verts);
+    free(m->indices);
+    free(m);
+}
@@ -0,0 +1,76 @@
+#ifndef MESHBUFFER_H
+    #define MESHBUFFER_H
+
+    // make c++ friendly
+    #ifdef __cplusplus
+        extern "C" {
+    #endif
+
+    // OpenGL and GLUT headers
+    #ifdef __APPLE__
+        #include <GLUT/glut.h>
+    #else
+        #include <GL/gl.h>
+        #include <GL/glu.h>
+        #include <GL/glut.h>
+    #endif
+
+    // maximum number of draw groups in one mesh
+    #define MAX_MESH_GROUPS 16
+
+    // interleaved vertex layout shared by every baked mesh
+    typedef struct {
+        GLfloat pos[3];
+        GLfloat normal[3];
+        GLfloat tex[2];
+        GLubyte color[4];
+    } meshvertex;
+
+    // a range of indices drawn with the same material
+    typedef struct {
+        GLsizei first;
+        GLsizei count;
+    } meshgroup;
+
+    struct _glmesh {
+        GLuint      vbo;            // vertex buffer object
+        GLuint      ibo;            // index buffer object
+        GLsizei     numVerts;
+        GLsizei     numIndices;
+        GLsizei     maxVerts;       // staging capacity
+        GLsizei     maxIndices;
+        meshvertex *verts;          // staging copy, freed by meshUpload
+        GLuint     *indices;
+        int         numGroups;
+        meshgroup   groups[MAX_MESH_GROUPS];
+        GLubyte     color[4];       // color given to new vertices
+        GLboolean   hasColor;       // draw with the per-vertex colors
+    };
+    typedef struct _glmesh glmesh;
+
+
+    glmesh *genMesh();                                      // create an empty mesh
+    GLuint  meshAddVertex(glmesh *m,                        // append a vertex, returns its index
+                          GLfloat px, GLfloat py, GLfloat pz,
+                          GLfloat nx, GLfloat ny, GLfloat nz,
+                          GLfloat s,  GLfloat t);
+    void    meshAddTriangle(glmesh *m,                      // append a triangle
+                            GLuint a, GLuint b, GLuint c);
+    int     meshBeginGroup(glmesh *m);                      // start a new draw group, returns its id
+    void    meshSetColor(glmesh *m,                         // set the color of new vertices
+                         const GLfloat color[4]);
+    void    meshAppend(glmesh *m, const glmesh *src,        // append a transformed copy of src
+                       const GLdouble xform[16], const GLdouble scale[3]);
+    void    meshUpload(glmesh *m);                          // copy to GPU buffers and drop staging
+    void    meshDraw(glmesh *m);                            // draw every group
+    void    meshDrawGroup(glmesh *m, int group);            // draw a single group
+    void    meshDrawRange(glmesh *m,                        // draw count indices from first
+                          GLsizei first, GLsizei count);
+    void    meshFree(glmesh *m);                            // release buffers and memory
+
+
+    #ifdef __cplusplus
+        }
+    #endif
+
+#endif
@@ -0,0 +1,135 @@
+
+// OpenGL and GLUT headers
+#ifdef __APPLE__
+    #include <GLUT/glut.h>
+#else
+    #include <GL/gl.h>
+    #include <GL/glu.h>
+    #include <GL/glut.h>
+#endif
+
+// standard c headers
+#include <stdio.h>
+#include <stdlib.h>
+
+// prototypes and definitions
+#include "meshCache.h"
+
+// shape tessellation
+#include "primatives.h"
+
+// a shape and the parameters it was tessellated with
+typedef struct {
+    shapetype shape;
+    GLdouble  dims[3];      // radii, height or size
+    GLint     res[2];       // slices and stacks, sides and rings
+    glmesh   *mesh;
+} cachedmesh;
+
+static cachedmesh cache[MAX_CACHED_MESHES];
+static int        numCached = 0;
+
+// tessellate a new entry for the shape
+static glmesh *buildMesh(shapetype shape, const GLdouble dims[3], GLint res1, GLint res2)
+{
+    glmesh *m = genMesh();
+
+    switch (shape) {
+        case SHAPE_SPHERE:
+            tessSphere(m, dims[0], res1, res2);
+            break;
+        case SHAPE_CYLINDER:
+            tessCylinder(m, dims[0], dims[1], dims[2], res1, res2);
+            break;
+        case SHAPE_DISK:
+            tessDisk(m, dims[0], dims[1], res1, res2);
+            break;
+        case SHAPE_TORUS:
+            tessTorus(m, dims[0], dims[1], res1, res2);
+            break;
+        case SHAPE_TEAPOT:
+            tessTeapot(m, dims[0], res1);
+            break;
+    }
+
+    meshUpload(m);
+    return m;
+}
+
+// find or build the mesh for a shape
+// the sculptures use a handful of shapes, so a linear search is enough
+glmesh *getCachedMesh(shapetype shape, const GLdouble dims[3], GLint res1, GLint res2)
+{
+    for (int i = 0; i < numCached; ++i) {
+        cachedmesh *c = &cache[i];
+
+        if (c->shape == shape && c->res[0] == res1 && c->res[1] == res2 &&
+            c->dims[0] == dims[0] && c->dims[1] == dims[1] && c->dims[2] == dims[2])
+            return c->mesh;
+    }
+
+    if (numCached >= MAX_CACHED_MESHES) {
+        fprintf(stderr, "Error: Mesh cache limit is %d shapes\n", MAX_CACHED_MESHES);
+        exit(EXIT_FAILURE);
+    }
+
+    cachedmesh *c = &cache[numCached++];
+    c->shape   = shape;
+    c->dims[0] = dims[0];
+    c->dims[1] = dims[1];
+    c->dims[2] = dims[2];
+    c->res[0]  = res1;
+    c->res[1]  = res2;
+    c->mesh    = buildMesh(shape, dims, res1, res2);
+
+    return c->mesh;
+}
+
+// drop-in for gluSphere
+void cacheSphere(GLdouble radius, GLint slices, GLint stacks)
+{
+    const GLdouble dims[3] = {radius, 0.0, 0.0};
+
+    meshDraw(getCachedMesh(SHAPE_SPHERE, dims, slices, stacks));
+}
+
+// drop-in for gluCylinder
+void cacheCylinder(GLdouble base, GLdouble top, GLdouble height, GLint slices, GLint stacks)
+{
+    const GLdouble dims[3] = {base, top, height};
+
+    meshDraw(getCachedMesh(SHAPE_CYLINDER, dims, slices, stacks));
+}
+
+// drop-in for gluDisk
+void cacheDisk(GLdouble inner, GLdouble outer, GLint slices, GLint loops)
+{
+    const GLdouble dims[3] = {inner, outer, 0.0};
+
+    meshDraw(getCachedMesh(SHAPE_DISK, dims, slices, loops));
+}
+
+// drop-in for glutSolidTorus
+void cacheTorus(GLdouble inner, GLdouble outer, GLint sides, GLint rings)
+{
+    const GLdouble dims[3] = {inner, outer, 0.0};
+
+    meshDraw(getCachedMesh(SHAPE_TORUS, dims, sides, rings));
+}
+
+// drop-in for glutSolidTeapot
+void cacheTeapot(GLdouble size)
+{
+    const GLdouble dims[3] = {size, 0.0, 0.0};
+
+    meshDraw(getCachedMesh(SHAPE_TEAPOT, dims, TEAPOT_RES, TEAPOT_RES));
+}
+
+// drop every cached mesh
+void flushMeshCache()
+{
+    for (int i = 0; i < numCached; ++i)
+        meshFree(cache[i].mesh);
+
+    numCached = 0;
+}
@@ -0,0 +1,54 @@
+#ifndef MESHCACHE_H
+    #define MESHCACHE_H
+
+    // make c++ friendly
+    #ifdef __cplusplus
+        extern "C" {
+    #endif
+
+    // OpenGL and GLUT headers
+    #ifdef __APPLE__
+        #include <GLUT/glut.h>
+    #else
+        #include <GL/gl.h>
+        #include <GL/glu.h>
+        #include <GL/glut.h>
+    #endif
+
+    // static vertex buffers
+    #include "meshBuffer.h"
+
+    // most distinct shapes the cache holds
+    #define MAX_CACHED_MESHES 64
+
+    // tessellation level of the teapot patches
+    #define TEAPOT_RES 14
+
+    // kinds of cached shape
+    typedef enum {
+        SHAPE_SPHERE,
+        SHAPE_CYLINDER,
+        SHAPE_DISK,
+        SHAPE_TORUS,
+        SHAPE_TEAPOT
+    } shapetype;
+
+    // shapes are tessellated once, on first use, and drawn from
+    // buffers with the current modelview matrix after that
+    void cacheSphere(GLdouble radius, GLint slices, GLint stacks);
+    void cacheCylinder(GLdouble base, GLdouble top, GLdouble height, GLint slices, GLint stacks);
+    void cacheDisk(GLdouble inner, GLdouble outer, GLint slices, GLint loops);
+    void cacheTorus(GLdouble inner, GLdouble outer, GLint sides, GLint rings);
+    void cacheTeapot(GLdouble size);
+
+    // find or build the mesh for a shape
+    glmesh *getCachedMesh(shapetype shape, const GLdouble dims[3], GLint res1, GLint res2);
+
+    // drop every cached mesh, required when the GL context changes
+    void flushMeshCache();
+
+    #ifdef __cplusplus
+        }
+    #endif
+
+#endif
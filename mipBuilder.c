@@ -0,0 +1,264 @@
+
+// OpenGL and GLUT headers
+#ifdef __APPLE__
+    #include <GLUT/glut.h>
+#else
+    #include <GL/gl.h>
+    #include <GL/glu.h>
+    #include <GL/glut.h>
+#endif
+
+// standard c headers
+#include <stdlib.h>
+#include <math.h>
+#include <pthread.h>
+
+// SSE2 is always there on x86-64, anything else takes the plain loops
+#ifdef __SSE2__
+    #include <emmintrin.h>
+#endif
+
+// prototypes and definitions
+#include "mipBuilder.h"
+
+// bands run on the shared workers
+#include "workerPool.h"
+
+// light is carried between levels as 12 bit linear values, four of them
+// and the rounding still fit in 16 bits
+#define LINEAR_MAX 4095
+
+static GLushort toLinear[256];              // sRGB byte to linear
+static GLubyte  toSRGB[LINEAR_MAX + 1];     // linear back to sRGB byte
+static pthread_once_t tablesBuilt = PTHREAD_ONCE_INIT;
+
+// one band of rows of the next level
+typedef struct {
+    const GLubyte  *src;            // the level above, bytes
+    const GLushort *srcLinear;      // or its linear values, for MIP_GAMMA
+    GLubyte        *dst;
+    GLushort       *dstLinear;
+    int sw, sh, dw, n;
+    int y0, y1;                     // rows of dst
+} mipband;
+
+// fill the sRGB conversion tables
+static void buildTables()
+{
+    for (int i = 0; i < 256; ++i) {
+        double c = i / 255.0;
+        double l = c <= 0.04045 ? c / 12.92 : pow((c + 0.055) / 1.055, 2.4);
+        toLinear[i] = (GLushort)(l * LINEAR_MAX + 0.5);
+    }
+    for (int i = 0; i <= LINEAR_MAX; ++i) {
+        double l = (double)i / LINEAR_MAX;
+        double c = l <= 0.0031308 ? l * 12.92 : 1.055 * pow(l, 1.0 / 2.4) - 0.055;
+        toSRGB[i] = (GLubyte)(c * 255.0 + 0.5);
+    }
+}
+
+// true for the channel of n that holds alpha
+static bool isAlpha(int c, int n)
+{
+    return (n == 2 && c == 1) || (n == 4 && c == 3);
+}
+
+#ifdef __SSE2__
+// pair sums of neighbouring pixels: a and b hold 16 consecutive 16 bit
+// values, 16 / n pixels, and the result the 8 / n sums of the pairs
+static __m128i pairSums(__m128i a, __m128i b, int n)
+{
+    __m128i sa, sb;
+
+    switch (n) {
+        case 1: {
+            // pixels are the halves of each 32 bit lane
+            __m128i low = _mm_set1_epi32(0xffff);
+            sa = _mm_add_epi32(_mm_and_si128(a, low), _mm_srli_epi32(a, 16));
+            sb = _mm_add_epi32(_mm_and_si128(b, low), _mm_srli_epi32(b, 16));
+            return _mm_packs_epi32(sa, sb);
+        }
+        case 2:
+            // pixels are the halves of each 64 bit lane
+            sa = _mm_add_epi16(a, _mm_srli_epi64(a, 32));
+            sb = _mm_add_epi16(b, _mm_srli_epi64(b, 32));
+            sa = _mm_shuffle_epi32(sa, _MM_SHUFFLE(3, 1, 2, 0));
+            sb = _mm_shuffle_epi32(sb, _MM_SHUFFLE(3, 1, 2, 0));
+            return _mm_unpacklo_epi64(sa, sb);
+        default:
+            // pixels are the halves of the register
+            sa = _mm_add_epi16(a, _mm_srli_si128(a, 8));
+            sb = _mm_add_epi16(b, _mm_srli_si128(b, 8));
+            return _mm_unpacklo_epi64(sa, sb);
+    }
+}
+#endif
+
+// halve a row of a byte level eight bytes at a time, returns the first
+// pixel left for HALVE_TAIL
+static int halveBytesSIMD(const GLubyte *r0, const GLubyte *r1, GLubyte *out,
+                          int sw, int dw, int n)
+{
+    int x = 0;
+
+#ifdef __SSE2__
+    int step = n == 3 ? 0 : 8 / n;      // pixels out per pass
+    __m128i zero = _mm_setzero_si128();
+    __m128i two  = _mm_set1_epi16(2);
+
+    if (step == 0 || sw < 2)
+        return 0;
+
+    for (; x + step <= dw && 2 * (x + step) <= sw; x += step) {
+        __m128i a  = _mm_loadu_si128((const __m128i *)(r0 + 2 * x * n));
+        __m128i b  = _mm_loadu_si128((const __m128i *)(r1 + 2 * x * n));
+        __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+        __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+        __m128i s  = _mm_srli_epi16(_mm_add_epi16(pairSums(lo, hi, n), two), 2);
+
+        _mm_storel_epi64((__m128i *)(out + x * n), _mm_packus_epi16(s, s));
+    }
+#endif
+
+    return x;
+}
+
+// as halveBytesSIMD, on linear values
+static int halveLinearSIMD(const GLushort *r0, const GLushort *r1, GLushort *out,
+                           int sw, int dw, int n)
+{
+    int x = 0;
+
+#ifdef __SSE2__
+    int step = n == 3 ? 0 : 8 / n;
+    __m128i two = _mm_set1_epi16(2);
+
+    if (step == 0 || sw < 2)
+        return 0;
+
+    for (; x + step <= dw && 2 * (x + step) <= sw; x += step) {
+        const GLushort *a = r0 + 2 * x * n, *b = r1 + 2 * x * n;
+        __m128i lo = _mm_add_epi16(_mm_loadu_si128((const __m128i *)a),
+                                   _mm_loadu_si128((const __m128i *)b));
+        __m128i hi = _mm_add_epi16(_mm_loadu_si128((const __m128i *)(a + 8)),
+                                   _mm_loadu_si128((const __m128i *)(b + 8)));
+        __m128i s  = _mm_srli_epi16(_mm_add_epi16(pairSums(lo, hi, n), two), 2);
+
+        _mm_storeu_si128((__m128i *)(out + x * n), s);
+    }
+#endif
+
+    return x;
+}
+
+// the pixels from x on, and everything the vector loop cannot take;
+// columns past the edge repeat the last one
+#define HALVE_TAIL(r0, r1, out, x, sw, dw, n)                                \
+    for (; x < dw; ++x) {                                                   \
+        int x0 = (2 * x     < sw ? 2 * x     : sw - 1) * n;                 \
+        int x1 = (2 * x + 1 < sw ? 2 * x + 1 : sw - 1) * n;                 \
+        for (int c = 0; c < n; ++c)                                         \
+            out[x * n + c] = (r0[x0 + c] + r0[x1 + c] +                     \
+                              r1[x0 + c] + r1[x1 + c] + 2) / 4;             \
+    }
+
+// halve one band, run on a worker
+static void halveBand(void *arg)
+{
+    mipband *b = arg;
+    int n = b->n;
+
+    for (int y = b->y0; y < b->y1; ++y) {
+        int sy0 = 2 * y     < b->sh ? 2 * y     : b->sh - 1;
+        int sy1 = 2 * y + 1 < b->sh ? 2 * y + 1 : b->sh - 1;
+
+        if (b->srcLinear == NULL) {
+            const GLubyte *r0  = b->src + (size_t)sy0 * b->sw * n;
+            const GLubyte *r1  = b->src + (size_t)sy1 * b->sw * n;
+            GLubyte       *out = b->dst + (size_t)y * b->dw * n;
+            int x = halveBytesSIMD(r0, r1, out, b->sw, b->dw, n);
+
+            HALVE_TAIL(r0, r1, out, x, b->sw, b->dw, n);
+        }
+        else {
+            const GLushort *r0  = b->srcLinear + (size_t)sy0 * b->sw * n;
+            const GLushort *r1  = b->srcLinear + (size_t)sy1 * b->sw * n;
+            GLushort       *out = b->dstLinear + (size_t)y * b->dw * n;
+            GLubyte        *px  = b->dst + (size_t)y * b->dw * n;
+            int x = halveLinearSIMD(r0, r1, out, b->sw, b->dw, n);
+
+            HALVE_TAIL(r0, r1, out, x, b->sw, b->dw, n);
+
+            // back to bytes, alpha was never curved
+            for (x = 0; x < b->dw * n; ++x)
+                px[x] = isAlpha(x % n, n) ? (out[x] * 255 + LINEAR_MAX / 2) / LINEAR_MAX
+                                          : toSRGB[out[x]];
+        }
+    }
+}
+
+// fill the levels below levels[0]
+bool mipBuild(GLubyte *levels[], int numLevels, int w, int h, int n, int filter)
+{
+    GLushort *linear[2] = {NULL, NULL};
+    mipband   bands[POOL_MAX_THREADS];
+
+    if (filter == MIP_GAMMA && numLevels > 1) {
+        pthread_once(&tablesBuilt, buildTables);
+
+        linear[0] = malloc(sizeof(GLushort) * w * h * n);
+        linear[1] = malloc(sizeof(GLushort) * (w > 1 ? w / 2 : 1) * (h > 1 ? h / 2 : 1) * n);
+        if (linear[0] == NULL || linear[1] == NULL) {
+            free(linear[0]);
+            free(linear[1]);
+            return false;
+        }
+
+        for (size_t i = 0; i < (size_t)w * h * n; ++i)
+            linear[0][i] = isAlpha(i % n, n) ? (levels[0][i] * LINEAR_MAX + 127) / 255
+                                             : toLinear[levels[0][i]];
+    }
+
+    for (int i = 1; i < numLevels; ++i) {
+        int dw = w > 1 ? w / 2 : 1;
+        int dh = h > 1 ? h / 2 : 1;
+        int numBands = dh / MIP_BAND_ROWS;
+        poolgroup group = {0};
+
+        // a band per worker on the big levels, the small ones run here
+        if (numBands > poolThreads())
+            numBands = poolThreads();
+        if (numBands < 1)
+            numBands = 1;
+
+        for (int b = 0; b < numBands; ++b) {
+            bands[b].src       = levels[i - 1];
+            bands[b].srcLinear = linear[0];
+            bands[b].dst       = levels[i];
+            bands[b].dstLinear = linear[1];
+            bands[b].sw = w;
+            bands[b].sh = h;
+            bands[b].dw = dw;
+            bands[b].n  = n;
+            bands[b].y0 = dh * b / numBands;
+            bands[b].y1 = dh * (b + 1) / numBands;
+
+            if (numBands == 1)
+                halveBand(&bands[b]);
+            else
+                poolSubmitGroup(&group, halveBand, &bands[b]);
+        }
+        poolWaitGroup(&group);
+
+        // this level's light feeds the next, the buffer above is reused
+        GLushort *t = linear[0];
+        linear[0] = linear[1];
+        linear[1] = t;
+        w = dw;
+        h = dh;
+    }
+
+    free(linear[0]);
+    free(linear[1]);
+    return true;
+}
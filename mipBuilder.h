@@ -0,0 +1,37 @@
+#ifndef MIPBUILDER_H
+    #define MIPBUILDER_H
+
+    // make c++ friendly
+    #ifdef __cplusplus
+        extern "C" {
+    #endif
+
+    // OpenGL and GLUT headers
+    #ifdef __APPLE__
+        #include <GLUT/glut.h>
+    #else
+        #include <GL/gl.h>
+        #include <GL/glu.h>
+        #include <GL/glut.h>
+    #endif
+
+    #include <stdbool.h>
+
+    // how each level is averaged from the one above
+    #define MIP_BOX    0        // 2x2 mean of the stored values
+    #define MIP_GAMMA  1        // 2x2 mean of the light, color taken as sRGB
+
+    // a level is split between workers in bands of at least this many rows
+    #define MIP_BAND_ROWS 32
+
+    // fill levels[1] to levels[numLevels - 1] from the w x h levels[0],
+    // n channels of bytes, each level half the size of the one above with
+    // a side of 1 staying 1; alpha is averaged straight in either filter
+    // safe to call from a worker, false if out of memory
+    bool mipBuild(GLubyte *levels[], int numLevels, int w, int h, int n, int filter);
+
+    #ifdef __cplusplus
+        }
+    #endif
+
+#endif
@@ -5,6 +5,8 @@
 #include <stdlib.h>
 #include <math.h>
 #include <stdbool.h>
+#include <time.h>
+#include <string.h>
 
 // OpenGL and GLUT headers
 #ifdef __APPLE__
@@ -18,6 +20,15 @@
 // type defs and prototypes
 #include "navigator.h"
 
+// shadowed GL state
+#include "glState.h"
+
+// window-less rendering
+#include "offscreen.h"
+
+// per-stage frame timing
+#include "profiler.h"
+
 // debug level
 short navDebug = NAV_DEBUG;
 
@@ -26,9 +37,30 @@ int windowID;
 int winWidth  = DEFAULT_WIN_WIDTH;
 int winHeight = DEFAULT_WIN_HEIGHT;
 
+// drawing offscreen without glut
+bool navHeadless = false;
+
+// frames are drawn by the caller, as the benchmark does, so no redraws
+// are posted to glut
+bool navDrivenFrames = false;
+
+// time between the last two frames in ms
+static double frameMs = 0.0;
+
+// why the next frame is wanted, and why the current one is drawn
+static unsigned int dirty = 0;
+static unsigned int drawReasons = 0;
+
+// camera as last drawn: x, y, z, rotationH, rotationV, zoomLevel
+static GLdouble drawnCamera[6];
+
 // current zoom
 GLdouble zoomLevel = DEFAULT_ZOOM_LEVEL;
 
+// CPU copies of the projection and view matrices, column major
+GLdouble navProjection[16];
+GLdouble navView[16];
+
 // camera variables
 GLdouble cameraLocX = DEFAULT_CAMERA_X;
 GLdouble cameraLocY = DEFAULT_CAMERA_Y;
@@ -54,16 +86,9 @@ bool warpFlag = false;
 int mouseMode = IDLE;
 
 // keyboard variables
-bool smoothMotionLeft  = false;
-bool smoothMotionRight = false;
-bool smoothMotionUp    = false;
-bool smoothMotionDown  = false;
-bool smoothMotionZoom  = false;
-bool smoothMotionDuck  = false;
-bool ducking           = false;
-bool smoothMotionJump  = false;
+// motions whose keys are held, indexed by MOVE_FORWARD through OPEN
+bool motionHeld[NUM_MOTIONS + 1];
 bool jumping           = false;
-bool smoothMotionOpen  = false;
 GLdouble turnUnit      = DEFAULT_TURN_UNIT;
 GLdouble moveUnit      = DEFAULT_MOVE_UNIT;
 GLdouble jumpUnit      = DEFAULT_JUMP_UNIT;
@@ -86,6 +111,21 @@ void navInit(int argc, char **argv)
     navInitCallBacks();
 }
 
+// initialize navigator without a window, drawing into an offscreen
+// framebuffer of width x height; glut is never touched
+void navInitHeadless(int width, int height)
+{
+    navHeadless = true;
+
+    if (!offscreenInit(width, height))
+        exit(1);
+
+    winWidth  = width;
+    winHeight = height;
+
+    navInitDisplay();
+}
+
 // initialize our window
 void navInitWindow(int argc, char **argv)
 {
@@ -109,9 +149,14 @@ void navInitWindow(int argc, char **argv)
 // initialize our OpenGL display
 void navInitDisplay()
 {
-    // Get current window dimensions
-    winWidth  = glutGet(GLUT_WINDOW_WIDTH);
-    winHeight = glutGet(GLUT_WINDOW_HEIGHT);
+    // the context may be new, nothing shadowed can be trusted
+    glsInvalidate();
+
+    // Get current window dimensions, headless keeps the requested size
+    if (!navHeadless) {
+        winWidth  = glutGet(GLUT_WINDOW_WIDTH);
+        winHeight = glutGet(GLUT_WINDOW_HEIGHT);
+    }
 
     // Configure perspective projection
     navWindowResize(winWidth, winHeight);
@@ -120,31 +165,31 @@ void navInitDisplay()
     navUpdateCamera();
 
     // Enable depth testing for correct z-buffer rendering
-    glEnable(GL_DEPTH_TEST);
+    glsEnable(GL_DEPTH_TEST);
 
     // Enable smoothing for geometric primitives
-    glEnable(GL_LINE_SMOOTH);
-    glEnable(GL_POLYGON_SMOOTH);
-    glEnable(GL_POINT_SMOOTH);
+    glsEnable(GL_LINE_SMOOTH);
+    glsEnable(GL_POLYGON_SMOOTH);
+    glsEnable(GL_POINT_SMOOTH);
     glHint(GL_POLYGON_SMOOTH_HINT, GL_NICEST);
 
     // Enable multisample anti-aliasing (if supported)
     if (MULTISAMPLE_AA)
-        glEnable(GL_MULTISAMPLE_ARB);
+        glsEnable(GL_MULTISAMPLE_ARB);
 
     // Set background color (black with full alpha)
     glClearColor(0.0, 0.0, 0.0, 1.0);
 
     // Configure alpha blending for transparent rendering
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glsEnable(GL_BLEND);
+    glsBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
     // Set polygon rendering mode (front faces filled)
     glPolygonMode(GL_FRONT, GL_FILL);
 
     // Enable back-face culling
-    glCullFace(GL_BACK);
-    glEnable(GL_CULL_FACE);
+    glsCullFace(GL_BACK);
+    glsEnable(GL_CULL_FACE);
 }
 
 // initialize mouse and keyboard
@@ -183,22 +228,129 @@ void navDefaultDrawFunc()
     // insert super-kewl draw function here
 }
 
+// measure the time since the last frame started
+// headless frames all stand for the same time
+static void navStartFrame()
+{
+    static double lastStart = -1.0;
+    struct timespec t;
+    double now;
+
+    if (navHeadless) {
+        frameMs = NAV_HEADLESS_FRAME_MS;
+        return;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    now = t.tv_sec * 1000.0 + t.tv_nsec / 1000000.0;
+
+    frameMs = (lastStart < 0.0) ? 0.0 : fmin(now - lastStart, NAV_MAX_FRAME_MS);
+    lastStart = now;
+}
+
+// time since the previous frame in ms
+double navFrameMs()
+{
+    return frameMs;
+}
+
 // draw to the display
 void navDisplay()
 {
+    profFrame();
+    navStartFrame();
+
+    // anything marked from here on is for the next frame
+    drawReasons = dirty ? dirty : DIRTY_WINDOW;
+    dirty = 0;
+
     // clear the display
+    profBegin("navClear");
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     
-    // Update the camera view matrix based on current camera parameters
+    // Move for held keys, then update the camera view matrix
+    profBegin("navUpdateCamera");
+    navIntegrateMotion(frameMs);
     navUpdateCamera();
+
+    drawnCamera[0] = cameraLocX;
+    drawnCamera[1] = cameraLocY;
+    drawnCamera[2] = cameraLocZ;
+    drawnCamera[3] = rotationH;
+    drawnCamera[4] = rotationV;
+    drawnCamera[5] = zoomLevel;
     // Optionally draw the coordinate origin for debugging
     if (showO)
         navDrawOrigin();
+    profEnd();
+
     // Call the registered scene drawing function
     navDraw();
 
-    // swap doubble buffers
-    glutSwapBuffers();
+    // swap doubble buffers, offscreen there is only one
+    profBegin("navSwapBuffers");
+    if (navHeadless)
+        glFinish();
+    else
+        glutSwapBuffers();
+    profEnd();
+}
+
+// ask glut for the display to be redrawn
+// headless and driven frames are drawn every step anyway
+static void navPostRedisplay()
+{
+    if (!navHeadless && !navDrivenFrames)
+        glutPostRedisplay();
+}
+
+// ask for a redraw because of the DIRTY_ reasons given
+// nothing is drawn unless some part of the picture may have changed
+void navMarkDirty(unsigned int reasons)
+{
+    if (reasons != 0 && dirty == 0)
+        navPostRedisplay();
+    dirty |= reasons;
+}
+
+// why the current frame is drawn, glut redraws uncovered windows itself
+unsigned int navDirtyReasons()
+{
+    return drawReasons;
+}
+
+// mark the camera dirty if it moved since it was last drawn
+static bool navCheckCamera()
+{
+    const GLdouble camera[6] = { cameraLocX, cameraLocY, cameraLocZ, rotationH, rotationV, zoomLevel };
+
+    if (memcmp(camera, drawnCamera, sizeof(camera)) == 0)
+        return false;
+
+    navMarkDirty(DIRTY_CAMERA);
+    return true;
+}
+
+// draw frames headless
+void navRunHeadless(int frames)
+{
+    for (int frame = 0; frame < frames; ++frame)
+        navDisplay();
+}
+
+// keep a CPU copy of the view: rotation rows r, then a move to the camera
+static void navSetView(const GLdouble r[3][3])
+{
+    const GLdouble eye[3] = { cameraLocX, cameraLocY, cameraLocZ };
+
+    for (int i = 0; i < 3; ++i) {
+        navView[i]      = r[i][0];
+        navView[4 + i]  = r[i][1];
+        navView[8 + i]  = r[i][2];
+        navView[12 + i] = -(r[i][0] * eye[0] + r[i][1] * eye[1] + r[i][2] * eye[2]);
+        navView[3 + i * 4] = 0.0;
+    }
+    navView[15] = 1.0;
 }
 
 // update our view of the world
@@ -226,16 +378,48 @@ void navUpdateCamera() {
             if (shakeFrame >= shakeDuration) {
                 cameraShaking = false;
             }
+
+            // settle back after the last shaken frame
+            navMarkDirty(DIRTY_CAMERA);
         }
 
         gluLookAt(cameraLocX, cameraLocY, cameraLocZ,
                   lookX, lookY, lookZ,
                   0.0, 1.0, 0.0);
+
+        // same basis as gluLookAt with the up vector fixed to +y
+        GLdouble f[3] = { lookX - cameraLocX, lookY - cameraLocY, lookZ - cameraLocZ };
+        GLdouble len  = sqrt(f[0] * f[0] + f[1] * f[1] + f[2] * f[2]);
+        f[0] /= len;  f[1] /= len;  f[2] /= len;
+
+        GLdouble sLen = sqrt(f[2] * f[2] + f[0] * f[0]);
+        GLdouble side[3] = { -f[2] / sLen, 0.0, f[0] / sLen };
+        GLdouble up[3]   = { side[1] * f[2] - side[2] * f[1],
+                             side[2] * f[0] - side[0] * f[2],
+                             side[0] * f[1] - side[1] * f[0] };
+
+        const GLdouble r[3][3] = {
+            { side[0], side[1], side[2] },
+            { up[0],   up[1],   up[2]   },
+            { -f[0],   -f[1],   -f[2]   }
+        };
+        navSetView(r);
     } else {
         // Scene-centric mode: rotate the world around camera
         glRotated(-rotationV, 1.0, 0.0, 0.0); // vertical rotation
         glRotated(-rotationH, 0.0, 1.0, 0.0); // horizontal rotation
         glTranslated(-cameraLocX, -cameraLocY, -cameraLocZ); // move scene
+
+        // the same rotations, Rx(-V) * Ry(-H)
+        GLdouble sh = sin(-rotationH * (M_PI / 180.0)), ch = cos(-rotationH * (M_PI / 180.0));
+        GLdouble sv = sin(-rotationV * (M_PI / 180.0)), cv = cos(-rotationV * (M_PI / 180.0));
+
+        const GLdouble r[3][3] = {
+            { ch,       0.0, sh       },
+            { sv * sh,  cv,  -sv * ch },
+            { -cv * sh, sv,  cv * ch  }
+        };
+        navSetView(r);
     }
 
     // Debug output for camera state
@@ -280,31 +464,48 @@ void navDrawOrigin()
     glPopMatrix();
 }
 
-// respond to window resize
-// reloads the perspective projection matrix
-void navWindowResize(int newWidth, int newHeight)
+// load the perspective projection for the current zoom level
+// and keep a CPU copy of it, as built by glFrustum
+static void navSetProjection()
 {
-    winWidth  = newWidth;
-    winHeight = newHeight;
-
-    double aspectRatio = (double)newWidth / (double)newHeight;
-
-    // Switch to projection matrix
-    glMatrixMode(GL_PROJECTION);
-    glLoadIdentity();
+    double aspectRatio = (double)winWidth / (double)winHeight;
 
     // Setup perspective view volume using current zoom level
     GLdouble left   = -zoomLevel * aspectRatio;
     GLdouble right  =  zoomLevel * aspectRatio;
     GLdouble bottom = -zoomLevel;
     GLdouble top    =  zoomLevel;
-    GLdouble near   = 512.0;
-    GLdouble far    = 24000.0;
+    GLdouble near   = NEAR_CLIP;
+    GLdouble far    = FAR_CLIP;
 
+    // Switch to projection matrix
+    glMatrixMode(GL_PROJECTION);
+    glLoadIdentity();
     glFrustum(left, right, bottom, top, near, far);
 
+    for (int i = 0; i < 16; ++i)
+        navProjection[i] = 0.0;
+    navProjection[0]  = 2.0 * near / (right - left);
+    navProjection[5]  = 2.0 * near / (top - bottom);
+    navProjection[8]  = (right + left) / (right - left);
+    navProjection[9]  = (top + bottom) / (top - bottom);
+    navProjection[10] = -(far + near) / (far - near);
+    navProjection[11] = -1.0;
+    navProjection[14] = -2.0 * far * near / (far - near);
+}
+
+// respond to window resize
+// reloads the perspective projection matrix
+void navWindowResize(int newWidth, int newHeight)
+{
+    winWidth  = newWidth;
+    winHeight = newHeight;
+
+    navSetProjection();
+
     // Define the viewport
     glViewport(0, 0, (GLsizei)newWidth, (GLsizei)newHeight);
+    navMarkDirty(DIRTY_WINDOW);
 }
 
 void navClipFunc(void (*func)(GLdouble *x, GLdouble *y, GLdouble *z))
@@ -386,8 +587,6 @@ void navMoveUp(GLdouble distance)
 // zoom camera in or out
 void navZoom(GLdouble deltaZoom)
 {
-    GLdouble aspectRatio = (GLdouble)winWidth / (GLdouble)winHeight;
-
     if ((zoomLevel - deltaZoom) <= 0.0) {
         zoomLevel = 0.1;
     } else if ((zoomLevel - deltaZoom) >= DEFAULT_ZOOM_LEVEL) {
@@ -397,13 +596,39 @@ void navZoom(GLdouble deltaZoom)
     }
 
     // Update the perspective projection matrix
-    glMatrixMode(GL_PROJECTION);
-    glLoadIdentity();
-    glFrustum(
-        -zoomLevel * aspectRatio, zoomLevel * aspectRatio,
-        -zoomLevel, zoomLevel,
-        512.0, 24000.0
-    );
+    navSetProjection();
+}
+
+// frustum of the current projection and camera
+void navGetFrustum(viewfrustum *f)
+{
+    frustumFromMatrices(f, navProjection, navView);
+}
+
+// place the camera directly, as a scripted path does
+void navSetCamera(GLdouble x, GLdouble y, GLdouble z, GLdouble h, GLdouble v, GLdouble zoom)
+{
+    cameraLocX = x;
+    cameraLocY = y;
+    cameraLocZ = z;
+    rotationH  = h;
+    rotationV  = v;
+
+    if (zoom != zoomLevel) {
+        zoomLevel = zoom;
+        navSetProjection();
+    }
+
+    navCheckCamera();
+}
+
+// viewport set by navWindowResize
+void navGetViewport(GLint viewport[4])
+{
+    viewport[0] = 0;
+    viewport[1] = 0;
+    viewport[2] = winWidth;
+    viewport[3] = winHeight;
 }
 
 // register and external keyboard function
@@ -425,14 +650,14 @@ void navKeyboard(unsigned char key, int x, int y)
     switch (key) {
         case '+':
         case '=':
-            smoothMotionZoom = true;
-            navSmoothMotion(ZOOM_IN);
+            motionHeld[ZOOM_IN] = true;
+            navMarkDirty(DIRTY_CAMERA);
             break;
 
         case '-':
         case '_':
-            smoothMotionZoom = true;
-            navSmoothMotion(ZOOM_OUT);
+            motionHeld[ZOOM_OUT] = true;
+            navMarkDirty(DIRTY_CAMERA);
             break;
 
         case 'c':
@@ -443,20 +668,20 @@ void navKeyboard(unsigned char key, int x, int y)
         case 'J':
             if (!jumping) {
                 jumping = true;
-                smoothMotionJump = true;
-                navSmoothMotion(JUMP);
+                jumpUnit = DEFAULT_JUMP_UNIT;
+                navMarkDirty(DIRTY_CAMERA);
             }
             break;
 
         case 'd':
         case 'D':
-            smoothMotionDuck = true;
-            navSmoothMotion(DUCK);
+            motionHeld[DUCK] = true;
+            navMarkDirty(DIRTY_CAMERA);
             break;
 
         case 'o':
             showO = !showO;
-            glutPostRedisplay();
+            navMarkDirty(DIRTY_SCENE);
             break;
         
 
@@ -465,7 +690,7 @@ void navKeyboard(unsigned char key, int x, int y)
             rotationV = DEFAULT_ROTATION_V;
             zoomLevel = DEFAULT_ZOOM_LEVEL;
             navZoom(0);
-            glutPostRedisplay();
+            navCheckCamera();
             break;
 
         default:
@@ -494,19 +719,19 @@ void navKeyboardUp(unsigned char key, int x, int y)
     switch (key) {
         case '+':
         case '=':
-        case '-':
-        case '_':
-            smoothMotionZoom = false;
+            motionHeld[ZOOM_IN] = false;
             break;
 
-        case 'u':
-        case 'U':
-            smoothMotionJump = false;
+        case '-':
+        case '_':
+            motionHeld[ZOOM_OUT] = false;
             break;
 
         case 'd':
         case 'D':
-            smoothMotionDuck = false;
+            // stand back up
+            motionHeld[DUCK] = false;
+            navMarkDirty(DIRTY_CAMERA);
             break;
 
         default:
@@ -528,150 +753,104 @@ void navKeyboardArrow(int key, int x, int y)
 
     switch (key) {
         case GLUT_KEY_LEFT:
-            if (!smoothMotionLeft) {
-                smoothMotionLeft = true;
-                navSmoothMotion((mod & GLUT_ACTIVE_ALT) ? MOVE_LEFT : TURN_LEFT);
-            }
+            motionHeld[(mod & GLUT_ACTIVE_ALT) ? MOVE_LEFT : TURN_LEFT] = true;
             break;
 
         case GLUT_KEY_RIGHT:
-            if (!smoothMotionRight) {
-                smoothMotionRight = true;
-                navSmoothMotion((mod & GLUT_ACTIVE_ALT) ? MOVE_RIGHT : TURN_RIGHT);
-            }
+            motionHeld[(mod & GLUT_ACTIVE_ALT) ? MOVE_RIGHT : TURN_RIGHT] = true;
             break;
 
         case GLUT_KEY_UP:
-            if (!smoothMotionUp) {
-                smoothMotionUp = true;
-                navSmoothMotion((mod & GLUT_ACTIVE_ALT) ? TURN_UP : MOVE_FORWARD);
-            }
+            motionHeld[(mod & GLUT_ACTIVE_ALT) ? TURN_UP : MOVE_FORWARD] = true;
             break;
 
         case GLUT_KEY_DOWN:
-            if (!smoothMotionDown) {
-                smoothMotionDown = true;
-                navSmoothMotion((mod & GLUT_ACTIVE_ALT) ? TURN_DOWN : MOVE_BACKWARD);
-            }
+            motionHeld[(mod & GLUT_ACTIVE_ALT) ? TURN_DOWN : MOVE_BACKWARD] = true;
             break;
 
         default:
-            break;
+            return;
     }
+
+    navMarkDirty(DIRTY_CAMERA);
 }
 
 // respond to arrow key release
+// either motion of the key stops, whichever the modifiers chose
 void navKeyboardArrowUp(int key, int x, int y)
 {
     switch (key) {
         case GLUT_KEY_LEFT:
-            smoothMotionLeft = false;
+            motionHeld[MOVE_LEFT] = motionHeld[TURN_LEFT] = false;
             break;
         case GLUT_KEY_RIGHT:
-            smoothMotionRight = false;
+            motionHeld[MOVE_RIGHT] = motionHeld[TURN_RIGHT] = false;
             break;
         case GLUT_KEY_UP:
-            smoothMotionUp = false;
+            motionHeld[MOVE_FORWARD] = motionHeld[TURN_UP] = false;
             break;
         case GLUT_KEY_DOWN:
-            smoothMotionDown = false;
+            motionHeld[MOVE_BACKWARD] = motionHeld[TURN_DOWN] = false;
             break;
         default:
             break;
     }
 }
 
-// animate keyboard motion
-void navSmoothMotion(int m)
+// move the camera for every held key, ms after the last frame
+// rates are per KEY_MOTION_DELAY, the old repeat interval, so keys
+// move as far in a second as they did before at any frame rate
+void navIntegrateMotion(double ms)
 {
-    switch (m) {
-        case MOVE_FORWARD:
-            navMoveForward(moveUnit);
-            if (smoothMotionUp)
-                glutTimerFunc(KEY_MOTION_DELAY, navSmoothMotion, m);
-            break;
-
-        case MOVE_BACKWARD:
-            navMoveForward(-moveUnit);
-            if (smoothMotionDown)
-                glutTimerFunc(KEY_MOTION_DELAY, navSmoothMotion, m);
-            break;
-
-        case MOVE_LEFT:
-            navMoveSideways(moveUnit);
-            if (smoothMotionLeft)
-                glutTimerFunc(KEY_MOTION_DELAY, navSmoothMotion, m);
-            break;
-
-        case MOVE_RIGHT:
-            navMoveSideways(-moveUnit);
-            if (smoothMotionRight)
-                glutTimerFunc(KEY_MOTION_DELAY, navSmoothMotion, m);
-            break;
-
-        case TURN_LEFT:
-            navTurnHorizontal(turnUnit);
-            if (smoothMotionLeft)
-                glutTimerFunc(KEY_MOTION_DELAY, navSmoothMotion, m);
-            break;
-
-        case TURN_RIGHT:
-            navTurnHorizontal(-turnUnit);
-            if (smoothMotionRight)
-                glutTimerFunc(KEY_MOTION_DELAY, navSmoothMotion, m);
-            break;
-
-        case TURN_UP:
-            navTurnVertical(turnUnit);
-            if (smoothMotionUp)
-                glutTimerFunc(KEY_MOTION_DELAY, navSmoothMotion, m);
-            break;
-
-        case TURN_DOWN:
-            navTurnVertical(-turnUnit);
-            if (smoothMotionDown)
-                glutTimerFunc(KEY_MOTION_DELAY, navSmoothMotion, m);
-            break;
-
-        case ZOOM_IN:
-            navZoom(5.0);
-            if (smoothMotionZoom)
-                glutTimerFunc(KEY_MOTION_DELAY, navSmoothMotion, m);
-            break;
-
-        case ZOOM_OUT:
-            navZoom(-5.0);
-            if (smoothMotionZoom)
-                glutTimerFunc(KEY_MOTION_DELAY, navSmoothMotion, m);
-            break;
-
-        case DUCK:
-            if (smoothMotionDuck)
-                navMoveUp(-70.0);
-            else
-                navMoveUp(70.0);
-
-            if (smoothMotionDuck || (cameraLocY < 0.0))
-                glutTimerFunc(KEY_MOTION_DELAY, navSmoothMotion, m);
-            else
-                cameraLocY = 0.0;
-            break;
-
-        case JUMP:
-            jumpUnit -= JUMP_DELTA;
-            navMoveUp(jumpUnit);
+    static bool wasMoving = false;
+    bool moving = false;
+
+    // a key pressed after an idle spell takes one step at once, as it
+    // always has, rather than catching up on the time nothing moved
+    if (!wasMoving)
+        ms = KEY_MOTION_DELAY;
+
+    GLdouble ticks = ms / KEY_MOTION_DELAY;
+
+    if (motionHeld[MOVE_FORWARD])  navMoveForward(moveUnit * ticks);
+    if (motionHeld[MOVE_BACKWARD]) navMoveForward(-moveUnit * ticks);
+    if (motionHeld[MOVE_LEFT])     navMoveSideways(moveUnit * ticks);
+    if (motionHeld[MOVE_RIGHT])    navMoveSideways(-moveUnit * ticks);
+    if (motionHeld[TURN_LEFT])     navTurnHorizontal(turnUnit * ticks);
+    if (motionHeld[TURN_RIGHT])    navTurnHorizontal(-turnUnit * ticks);
+    if (motionHeld[TURN_UP])       navTurnVertical(turnUnit * ticks);
+    if (motionHeld[TURN_DOWN])     navTurnVertical(-turnUnit * ticks);
+    if (motionHeld[ZOOM_IN])       navZoom(5.0 * ticks);
+    if (motionHeld[ZOOM_OUT])      navZoom(-5.0 * ticks);
+
+    for (int m = MOVE_FORWARD; m <= NUM_MOTIONS; ++m)
+        moving = moving || motionHeld[m];
+
+    // duck while held, then come back up to standing
+    if (motionHeld[DUCK])
+        navMoveUp(-70.0 * ticks);
+    else if (!jumping && cameraLocY < 0.0) {
+        navMoveUp(fmin(70.0 * ticks, -cameraLocY));
+        moving = true;
+    }
 
-            if (cameraLocY > 0.0) {
-                glutTimerFunc(KEY_MOTION_DELAY, navSmoothMotion, m);
-            } else {
-                cameraLocY = 0.0;
-                jumpUnit = DEFAULT_JUMP_UNIT;
-                jumping = false;
-            }
-            break;
+    // fall under JUMP_DELTA per tick squared until back on the floor
+    if (jumping) {
+        jumpUnit -= JUMP_DELTA * ticks;
+        navMoveUp(jumpUnit * ticks);
+
+        if (cameraLocY > 0.0)
+            moving = true;
+        else {
+            cameraLocY = 0.0;
+            jumpUnit = DEFAULT_JUMP_UNIT;
+            jumping = false;
+        }
     }
 
-    glutPostRedisplay();
+    // one redraw per frame for as long as the camera moves; a key
+    // held against a limit moves nothing and draws nothing
+    wasMoving = moving && navCheckCamera();
 }
 // respond to mouse clicks
 void navMouse(int button, int state, int x, int y)
@@ -731,7 +910,7 @@ void navActiveMouse(int x, int y)
             return;
     }
 
-    glutPostRedisplay();
+    navCheckCamera();
 
     warpFlag = true;
     glutWarpPointer(centerX, centerY);
@@ -17,6 +17,9 @@
         #include <GL/glut.h>
     #endif
 
+    // view frustum planes
+    #include "frustum.h"
+
     // default debug level
     #define NAV_DEBUG 0
 
@@ -25,6 +28,20 @@
     #define DEFAULT_WIN_HEIGHT  800
     #define GAME_MODE_STRING   "1920x1200:24"
 
+    // time a headless frame stands for, so runs don't depend on the machine
+    #define NAV_HEADLESS_FRAME_MS (1000.0 / 60.0)
+
+    // longest frame time reported, so a stall doesn't jump the scene
+    #define NAV_MAX_FRAME_MS 250.0
+
+    // reasons a frame needs drawing, frames are only drawn for one
+    #define DIRTY_CAMERA     0x01
+    #define DIRTY_ANIMATION  0x02
+    #define DIRTY_LIGHTS     0x04
+    #define DIRTY_TEXTURES   0x08
+    #define DIRTY_WINDOW     0x10   // resized or uncovered
+    #define DIRTY_SCENE      0x20   // anything else drawn differently
+
     // mouse modes
     #define MOVING        1
     #define TURNING       2
@@ -45,7 +62,9 @@
     #define DUCK          11
     #define JUMP          12
     #define OPEN          13
+    #define NUM_MOTIONS   13
 
+    // keyboard motion rates are given per this many ms
     #define KEY_MOTION_DELAY  40
     #define DEFAULT_TURN_UNIT 2.5
     #define DEFAULT_MOVE_UNIT 120.0
@@ -64,6 +83,10 @@
     // default zoom
     #define DEFAULT_ZOOM_LEVEL 256.0
 
+    // depth range of the view volume
+    #define NEAR_CLIP 512.0
+    #define FAR_CLIP  24000.0
+
     // move camera around scene 0
     // move scene around camera 1
     // 1 has more features
@@ -75,6 +98,8 @@
     // use multisample anti-aliasing
     #define MULTISAMPLE_AA true
         
+    extern bool navHeadless;
+    extern bool navDrivenFrames;
     extern bool cameraShaking;
     extern int shakeFrame;
     extern int shakeDuration;
@@ -82,6 +107,11 @@
 
     void navInit(int nargs, char *args[]);               // initialize navigator
     void navInitWindow(int nargs, char *args[]);         // initialize our window
+    void navInitHeadless(int width, int height);         // initialize offscreen, without glut
+    void navRunHeadless(int frames);                     // draw frames offscreen then return
+    void navMarkDirty(unsigned int reasons);             // ask for a redraw, for DIRTY_ reasons
+    unsigned int navDirtyReasons();                      // why the current frame is drawn
+    double navFrameMs();                                 // time since the previous frame
     void navInitDisplay();                               // initialize the OpenGL display
     void navInitCallBacks();                             // register glut call-backs
     void navDisplay();                                   // draw to the display
@@ -99,6 +129,10 @@
     void navDefaultClipFunc(GLdouble *x,                 // default clipping function
                             GLdouble *y, GLdouble *z);
     void navZoom(GLdouble amount);                       // zoom camera in or out
+    void navGetFrustum(viewfrustum *f);                  // frustum of the current view
+    void navGetViewport(GLint viewport[4]);              // x, y, width, height of the view
+    void navSetCamera(GLdouble x, GLdouble y,            // place the camera and zoom
+                      GLdouble z, GLdouble h, GLdouble v, GLdouble zoom);
 
     void navKeyboardFunc(void (*func)(unsigned char key, int x, int y));
     void navDefaultKeyFunc(unsigned char key, int x, int y);
@@ -110,7 +144,7 @@
 
     void navKeyboardArrow(int key, int x, int y);        // respond to arrow key press
     void navKeyboardArrowUp(int key, int x, int y);      // respond to arrow key release
-    void navSmoothMotion(int m);                         // animate keyboard motion
+    void navIntegrateMotion(double ms);                  // move for the keys held over ms
     void navMouse(int button, int state, int x, int y);  // respond to mouse clicks
     void navActiveMouse(int x, int y);                   // respond to mouse motion
 
@@ -0,0 +1,156 @@
+// OpenGL and GLUT headers
+#ifdef __APPLE__
+    #include <GLUT/glut.h>
+#else
+    #include <GL/gl.h>
+    #include <GL/glu.h>
+    #include <GL/glut.h>
+    #include <EGL/egl.h>
+    #include <EGL/eglext.h>
+#endif
+
+// standard c headers
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+// prototypes and definitions
+#include "offscreen.h"
+
+// size of the framebuffer
+static int fbWidth  = 0;
+static int fbHeight = 0;
+
+#ifndef __APPLE__
+
+static EGLDisplay display = EGL_NO_DISPLAY;
+static EGLContext context = EGL_NO_CONTEXT;
+
+// framebuffer and its color and depth storage
+static GLuint framebuffer = 0;
+static GLuint renderbuffers[2] = {0, 0};
+
+// create a window-less GL context drawing into a width x height
+// framebuffer object; Mesa's surfaceless platform needs no display
+// server, so this runs with llvmpipe on machines without a GPU
+bool offscreenInit(int width, int height)
+{
+    PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+        (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+
+    if (getPlatformDisplay != NULL)
+        display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+    if (display == EGL_NO_DISPLAY)
+        display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, NULL, NULL)) {
+        fprintf(stderr, "Error: no EGL display for offscreen rendering.\n");
+        return false;
+    }
+
+    // the fixed-function pipeline needs desktop GL, not GLES
+    if (!eglBindAPI(EGL_OPENGL_API)) {
+        fprintf(stderr, "Error: EGL has no desktop OpenGL.\n");
+        eglTerminate(display);
+        return false;
+    }
+
+    context = eglCreateContext(display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, NULL);
+    if (context == EGL_NO_CONTEXT ||
+        !eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context)) {
+        fprintf(stderr, "Error: could not create an offscreen GL context.\n");
+        eglTerminate(display);
+        return false;
+    }
+
+    fbWidth  = width;
+    fbHeight = height;
+
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glGenRenderbuffers(2, renderbuffers);
+
+    glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers[0]);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, renderbuffers[0]);
+
+    glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers[1]);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, renderbuffers[1]);
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        fprintf(stderr, "Error: offscreen framebuffer of %dx%d is incomplete.\n", width, height);
+        offscreenCleanUp();
+        return false;
+    }
+
+    return true;
+}
+
+// release the framebuffer and context
+void offscreenCleanUp()
+{
+    if (context != EGL_NO_CONTEXT) {
+        glDeleteRenderbuffers(2, renderbuffers);
+        glDeleteFramebuffers(1, &framebuffer);
+        framebuffer = renderbuffers[0] = renderbuffers[1] = 0;
+
+        eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        eglDestroyContext(display, context);
+        context = EGL_NO_CONTEXT;
+    }
+
+    if (display != EGL_NO_DISPLAY) {
+        eglTerminate(display);
+        display = EGL_NO_DISPLAY;
+    }
+}
+
+#else
+
+// no EGL here, headless runs need a Mesa build
+bool offscreenInit(int width, int height)
+{
+    fprintf(stderr, "Error: offscreen rendering is not supported on this platform.\n");
+    return false;
+}
+
+void offscreenCleanUp()
+{
+}
+
+#endif
+
+// write the current color buffer to a binary ppm file
+bool offscreenSavePPM(const char *fileName)
+{
+    int rowSize = fbWidth * 3;
+    unsigned char *pixels;
+    FILE *file;
+
+    if (fbWidth <= 0 || fbHeight <= 0)
+        return false;
+
+    pixels = malloc((size_t)rowSize * fbHeight);
+    if (pixels == NULL)
+        return false;
+
+    file = fopen(fileName, "wb");
+    if (file == NULL) {
+        fprintf(stderr, "Error: could not open %s for writing.\n", fileName);
+        free(pixels);
+        return false;
+    }
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, fbWidth, fbHeight, GL_RGB, GL_UNSIGNED_BYTE, pixels);
+
+    // GL rows run bottom up, ppm rows top down
+    fprintf(file, "P6\n%d %d\n255\n", fbWidth, fbHeight);
+    for (int y = fbHeight - 1; y >= 0; --y)
+        fwrite(pixels + (size_t)y * rowSize, 1, rowSize, file);
+
+    fclose(file);
+    free(pixels);
+    return true;
+}
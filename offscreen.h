@@ -0,0 +1,34 @@
+#ifndef OFFSCREEN_H
+    #define OFFSCREEN_H
+
+    // make c++ friendly
+    #ifdef __cplusplus
+        extern "C" {
+    #endif
+
+    // OpenGL and GLUT headers
+    #ifdef __APPLE__
+        #include <GLUT/glut.h>
+    #else
+        #include <GL/gl.h>
+        #include <GL/glu.h>
+        #include <GL/glut.h>
+    #endif
+
+    #include <stdbool.h>
+
+    // create a window-less GL context drawing into a width x height
+    // framebuffer object, false when the platform can't provide one
+    bool offscreenInit(int width, int height);
+
+    // write the current color buffer to a binary ppm file
+    bool offscreenSavePPM(const char *fileName);
+
+    // release the framebuffer and context
+    void offscreenCleanUp();
+
+    #ifdef __cplusplus
+        }
+    #endif
+
+#endif
@@ -0,0 +1,447 @@
+
+// OpenGL and GLUT headers
+#ifdef __APPLE__
+    #include <GLUT/glut.h>
+#else
+    #include <GL/gl.h>
+    #include <GL/glu.h>
+    #include <GL/glut.h>
+#endif
+
+// standard c headers
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// prototypes and definitions
+#include "paintings.h"
+
+// baked quads, page mips, loading on the workers and shadowed binds
+#include "meshBuffer.h"
+#include "mipBuilder.h"
+#include "workerPool.h"
+#include "glState.h"
+
+// finer levels of the paintings close up
+#include "texStream.h"
+
+// an atlas page and the quads drawn from it
+typedef struct {
+    GLuint  id;
+    int     height;         // rows uploaded, a power of 2
+    glmesh *mesh;           // one draw group per facing
+} atlaspage;
+
+static painting  paintings[MAX_PAINTINGS];
+static int       numPaintings = 0;
+static bool      paintingsPending = false;
+
+// the distinct pictures the paintings show
+static picture   pictures[MAX_PICTURES];
+static int       numPictures = 0;
+
+static atlaspage pages[MAX_ATLAS_PAGES];
+static int       numPages = 0;
+
+// every painting's quad over a whole texture, drawn one at a time with
+// its streamed levels
+static glmesh   *detailMesh = NULL;
+
+// load one picture, run on a worker; no mips of its own, the page has them
+static void loadPicture(void *arg)
+{
+    picture *p = arg;
+
+    p->ok = texCacheLoad(p->image, 0, PAINTING_TEXELS, &p->cooked, p->error, sizeof(p->error));
+}
+
+// the picture showing an image, added the first time it is hung
+// every picture is loaded with the same settings, so the name is enough
+static int findPicture(const char *image)
+{
+    for (int i = 0; i < numPictures; ++i)
+        if (strcmp(pictures[i].image, image) == 0)
+            return i;
+
+    picture *p = &pictures[numPictures];
+    snprintf(p->image, sizeof(p->image), "%s", image);
+    p->stream = texStreamAdd(p->image, TEXCACHE_MIPMAPS | TEXCACHE_GAMMA, PAINTING_DETAIL_TEXELS);
+    return numPictures++;
+}
+
+// the facing group of a rotation
+static int facingOf(GLdouble hrot)
+{
+    int q = (int)floor(hrot / 90.0 + 0.5) % NUM_FACINGS;
+
+    return q < 0 ? q + NUM_FACINGS : q;
+}
+
+// room a picture takes in the atlas with its gutter, kept on gutter
+// boundaries so no mip texel straddles two paintings
+static int cellSize(int texels)
+{
+    return (texels + 3 * ATLAS_GUTTER - 1) / ATLAS_GUTTER * ATLAS_GUTTER;
+}
+
+static int clampInt(int x, int lo, int hi)
+{
+    return x < lo ? lo : x > hi ? hi : x;
+}
+
+// taller pictures are packed first so the shelves stay full
+static int tallerFirst(const void *a, const void *b)
+{
+    const picture *pa = &pictures[*(const int *)a];
+    const picture *pb = &pictures[*(const int *)b];
+
+    return (int)pb->cooked.levels[0].height - (int)pa->cooked.levels[0].height;
+}
+
+// read placements and start loading their pictures
+bool loadPaintings(const char *fileName)
+{
+    FILE *file = fopen(fileName, "r");
+    char line[512];
+    char image[256];
+    int lineNum = 0;
+
+    numPaintings = numPictures = 0;
+    if (file == NULL)
+        return false;
+
+    while (fgets(line, sizeof(line), file) != NULL) {
+        char *text = line + strspn(line, " \t");
+        painting *p = &paintings[numPaintings];
+
+        ++lineNum;
+        if (*text == '#' || *text == '\n' || *text == '\r' || *text == '\0')
+            continue;
+
+        if (numPaintings == MAX_PAINTINGS) {
+            fprintf(stderr, "Error: %s has more than %d paintings\n", fileName, MAX_PAINTINGS);
+            fclose(file);
+            numPaintings = numPictures = 0;
+            return false;
+        }
+
+        if (sscanf(text, "%255s %lf %lf %lf %lf %lf", image, &p->xcenter, &p->ycenter,
+                   &p->zcenter, &p->hrot, &p->height) != 6 || p->height <= 0.0) {
+            fprintf(stderr, "Error: %s:%d: expected image x y z hrot height\n", fileName, lineNum);
+            fclose(file);
+            numPaintings = numPictures = 0;
+            return false;
+        }
+        p->picture = findPicture(image);
+        ++numPaintings;
+    }
+    fclose(file);
+
+    // map or cook every picture once on a worker, initPaintings collects them
+    poolStart(0);
+    for (int i = 0; i < numPictures; ++i) {
+        pictures[i].ok = false;
+        poolSubmit(loadPicture, &pictures[i]);
+    }
+    paintingsPending = numPictures > 0;
+    return true;
+}
+
+// copy a picture into its cell as RGBA, the edge texels repeated
+// out through the gutter
+static void blitPicture(GLubyte *atlas, const picture *p)
+{
+    const texlevel *l   = &p->cooked.levels[0];
+    const GLubyte  *src = (const GLubyte *)p->cooked.data + l->offset;
+    int w = l->width, h = l->height, n = p->cooked.header->components;
+
+    for (int y = -ATLAS_GUTTER; y < h + ATLAS_GUTTER; ++y) {
+        const GLubyte *row = src + (size_t)clampInt(y, 0, h - 1) * w * n;
+        GLubyte       *out = atlas + ((size_t)(p->y + ATLAS_GUTTER + y) * ATLAS_SIZE + p->x) * 4;
+
+        for (int x = -ATLAS_GUTTER; x < w + ATLAS_GUTTER; ++x, out += 4) {
+            const GLubyte *t = row + (size_t)clampInt(x, 0, w - 1) * n;
+
+            switch (n) {
+                case 1:  out[0] = out[1] = out[2] = t[0]; out[3] = 255;  break;
+                case 2:  out[0] = out[1] = out[2] = t[0]; out[3] = t[1]; break;
+                case 3:  memcpy(out, t, 3);               out[3] = 255;  break;
+                default: memcpy(out, t, 4);                              break;
+            }
+        }
+    }
+}
+
+// fill a page with its pictures, build its mips and upload them
+static bool buildPage(int page)
+{
+    GLubyte *levels[ATLAS_LEVELS];
+    int      w[ATLAS_LEVELS], h[ATLAS_LEVELS];
+    size_t   total = 0;
+
+    for (int l = 0; l < ATLAS_LEVELS; ++l) {
+        w[l] = ATLAS_SIZE >> l > 0 ? ATLAS_SIZE >> l : 1;
+        h[l] = pages[page].height >> l > 0 ? pages[page].height >> l : 1;
+        total += (size_t)w[l] * h[l] * 4;
+    }
+
+    // the space between cells stays clear
+    GLubyte *pixels = calloc(total, 1);
+    if (pixels == NULL)
+        return false;
+
+    levels[0] = pixels;
+    for (int l = 1; l < ATLAS_LEVELS; ++l)
+        levels[l] = levels[l - 1] + (size_t)w[l - 1] * h[l - 1] * 4;
+
+    for (int i = 0; i < numPictures; ++i)
+        if (pictures[i].page == page)
+            blitPicture(levels[0], &pictures[i]);
+
+    if (!mipBuild(levels, ATLAS_LEVELS, w[0], h[0], 4, MIP_GAMMA)) {
+        free(pixels);
+        return false;
+    }
+
+    glGenTextures(1, &pages[page].id);
+    glsBindTexture(GL_TEXTURE_2D, pages[page].id);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, ATLAS_LEVELS - 1);
+    for (int l = 0; l < ATLAS_LEVELS; ++l)
+        glTexImage2D(GL_TEXTURE_2D, l, GL_RGBA, w[l], h[l], 0, GL_RGBA, GL_UNSIGNED_BYTE, levels[l]);
+
+    free(pixels);
+    return true;
+}
+
+// the corners of a painting, hung PAINTING_OFFSET out from its wall,
+// counter-clockwise from the bottom left as seen from the front
+static void placeCorners(painting *p)
+{
+    const texlevel *l = &pictures[p->picture].cooked.levels[0];
+    GLdouble a  = p->hrot * M_PI / 180.0;
+    GLdouble nx = sin(a), nz = cos(a);      // out of the wall
+    GLdouble rx = nz,     rz = -nx;         // to the right, seen from the front
+    GLdouble halfH = p->height / 2.0;
+    GLdouble halfW = halfH * l->width / l->height;
+    GLdouble cx = p->xcenter + nx * PAINTING_OFFSET;
+    GLdouble cz = p->zcenter + nz * PAINTING_OFFSET;
+
+    for (int c = 0; c < 4; ++c) {
+        GLdouble side = c == 0 || c == 3 ? -halfW : halfW;
+
+        p->corners[c][0] = cx + rx * side;
+        p->corners[c][1] = p->ycenter + (c < 2 ? -halfH : halfH);
+        p->corners[c][2] = cz + rz * side;
+    }
+}
+
+// a painting's quad showing s0, t0 to s1, t1 of a texture
+static void addQuad(glmesh *m, const painting *p, GLfloat s0, GLfloat t0, GLfloat s1, GLfloat t1)
+{
+    GLdouble a  = p->hrot * M_PI / 180.0;
+    GLfloat  nx = sin(a), nz = cos(a);
+    GLfloat  s[4] = { s0, s1, s1, s0 };
+    GLfloat  t[4] = { t0, t0, t1, t1 };
+    GLuint   v[4];
+
+    for (int c = 0; c < 4; ++c)
+        v[c] = meshAddVertex(m, p->corners[c][0], p->corners[c][1], p->corners[c][2],
+                             nx, 0.0, nz, s[c], t[c]);
+    meshAddTriangle(m, v[0], v[1], v[2]);
+    meshAddTriangle(m, v[0], v[2], v[3]);
+}
+
+// a painting's quad in its atlas page
+static void addAtlasQuad(glmesh *m, const painting *p, int pageHeight)
+{
+    const picture  *pic = &pictures[p->picture];
+    const texlevel *l   = &pic->cooked.levels[0];
+
+    addQuad(m, p, (GLfloat)(pic->x + ATLAS_GUTTER) / ATLAS_SIZE,
+                  (GLfloat)(pic->y + ATLAS_GUTTER) / pageHeight,
+                  (GLfloat)(pic->x + ATLAS_GUTTER + l->width) / ATLAS_SIZE,
+                  (GLfloat)(pic->y + ATLAS_GUTTER + l->height) / pageHeight);
+}
+
+// pack the loaded pictures into atlas pages and bake their quads
+void initPaintings()
+{
+    int order[MAX_PICTURES];
+    int count = 0, hung = 0;
+
+    // drop pages built before
+    freePaintings();
+
+    if (paintingsPending) {
+        poolWait();
+        paintingsPending = false;
+    }
+
+    for (int i = 0; i < numPictures; ++i) {
+        picture *p = &pictures[i];
+
+        // a context made after the first upload maps the cooked copy again
+        if (p->ok && p->cooked.data == NULL)
+            loadPicture(p);
+
+        p->page = -1;
+        if (!p->ok)
+            fprintf(stderr, "Error: painting %s: %s\n", p->image, p->error);
+        else
+            order[count++] = i;
+    }
+
+    // shelves across each page, a new page when one is full
+    qsort(order, count, sizeof(int), tallerFirst);
+
+    int x = 0, y = 0, shelf = 0;
+    for (int k = 0; k < count; ++k) {
+        picture *p = &pictures[order[k]];
+        int cw = cellSize(p->cooked.levels[0].width);
+        int ch = cellSize(p->cooked.levels[0].height);
+
+        if (x + cw > ATLAS_SIZE) {
+            y += shelf;
+            x = shelf = 0;
+        }
+        if (numPages == 0 || y + ch > ATLAS_SIZE) {
+            if (numPages == MAX_ATLAS_PAGES) {
+                fprintf(stderr, "Error: paintings fill %d atlas pages, %d pictures are left off\n",
+                        MAX_ATLAS_PAGES, count - k);
+                break;
+            }
+            ++numPages;
+            x = y = shelf = 0;
+        }
+
+        p->page   = numPages - 1;
+        p->x      = x;
+        p->y      = y;
+        p->texels = p->cooked.levels[0].width > p->cooked.levels[0].height ?
+                    p->cooked.levels[0].width : p->cooked.levels[0].height;
+        x += cw;
+        if (ch > shelf)
+            shelf = ch;
+
+        // rows in use so far, the page is cut to them
+        int rows = 1;
+        while (rows < y + shelf)
+            rows *= 2;
+        pages[numPages - 1].height = rows;
+    }
+
+    for (int page = 0; page < numPages; ++page) {
+        if (!buildPage(page)) {
+            fprintf(stderr, "Fatal Error:  Out of memory building painting atlas.\n");
+            exit(EXIT_FAILURE);
+        }
+
+        // one group per facing, whatever hangs on a wall is one draw
+        pages[page].mesh = genMesh();
+        for (int f = 0; f < NUM_FACINGS; ++f) {
+            meshBeginGroup(pages[page].mesh);
+            for (int i = 0; i < numPaintings; ++i)
+                if (pictures[paintings[i].picture].page == page &&
+                    facingOf(paintings[i].hrot) == f) {
+                    placeCorners(&paintings[i]);
+                    addAtlasQuad(pages[page].mesh, &paintings[i], pages[page].height);
+                    ++hung;
+                }
+        }
+        meshUpload(pages[page].mesh);
+    }
+
+    // every painting again over the whole of a texture, for the streamed levels
+    detailMesh = genMesh();
+    for (int i = 0; i < numPaintings; ++i)
+        if (pictures[paintings[i].picture].page >= 0) {
+            paintings[i].quad = detailMesh->numIndices;
+            addQuad(detailMesh, &paintings[i], 0.0, 0.0, 1.0, 1.0);
+        }
+    meshUpload(detailMesh);
+
+    // the pixels are on the GL now
+    for (int i = 0; i < numPictures; ++i)
+        texCacheRelease(&pictures[i].cooked);
+
+    if (numPaintings > 0)
+        printf("Hung %d of %d paintings showing %d pictures on %d atlas pages\n",
+               hung, numPaintings, numPictures, numPages);
+}
+
+// ask for the finer levels of the paintings on screen
+bool updatePaintings(const viewfrustum *view, const GLint viewport[4])
+{
+    for (int i = 0; i < numPaintings; ++i) {
+        const painting *p   = &paintings[i];
+        const picture  *pic = &pictures[p->picture];
+        GLint rect[4];
+
+        if (pic->page < 0 || !frustumScreenRect(view, p->corners, 4, viewport, rect))
+            continue;
+
+        // the atlas is enough until a painting is larger on screen
+        int pixels = rect[2] > rect[3] ? rect[2] : rect[3];
+        if (pixels > pic->texels)
+            texStreamRequest(pic->stream, pixels);
+    }
+    return texStreamUpdate();
+}
+
+// draw every painting facing one way
+void drawPaintings(int facing)
+{
+    for (int page = 0; page < numPages; ++page) {
+        if (pages[page].mesh->groups[facing].count == 0)
+            continue;
+        glsBindTexture(GL_TEXTURE_2D, pages[page].id);
+        meshDrawGroup(pages[page].mesh, facing);
+    }
+
+    // paintings streamed in finer than the atlas, over their atlas quads
+    glsEnable(GL_POLYGON_OFFSET_FILL);
+    glPolygonOffset(-1.0, -1.0);
+    for (int i = 0; i < numPaintings; ++i) {
+        const painting *p   = &paintings[i];
+        const picture  *pic = &pictures[p->picture];
+        int    texels;
+        GLuint id;
+
+        if (pic->page < 0 || facingOf(p->hrot) != facing)
+            continue;
+
+        id = texStreamTexture(pic->stream, &texels);
+        if (id == 0 || texels <= pic->texels)
+            continue;
+
+        glsBindTexture(GL_TEXTURE_2D, id);
+        meshDrawRange(detailMesh, p->quad, 6);
+    }
+    glsDisable(GL_POLYGON_OFFSET_FILL);
+}
+
+// release the pages, their meshes and the streamed levels
+void freePaintings()
+{
+    texStreamFlush();
+    meshFree(detailMesh);
+    detailMesh = NULL;
+
+    // the GL unbinds a deleted texture, the shadow has to hear of it
+    if (numPages > 0)
+        glsBindTexture(GL_TEXTURE_2D, 0);
+
+    for (int page = 0; page < numPages; ++page) {
+        if (pages[page].id)
+            glDeleteTextures(1, &pages[page].id);
+        meshFree(pages[page].mesh);
+        pages[page].id   = 0;
+        pages[page].mesh = NULL;
+    }
+    numPages = 0;
+}
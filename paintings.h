@@ -0,0 +1,114 @@
+#ifndef PAINTINGS_H
+    #define PAINTINGS_H
+
+    // make c++ friendly
+    #ifdef __cplusplus
+        extern "C" {
+    #endif
+
+    // OpenGL and GLUT headers
+    #ifdef __APPLE__
+        #include <GLUT/glut.h>
+    #else
+        #include <GL/gl.h>
+        #include <GL/glu.h>
+        #include <GL/glut.h>
+    #endif
+
+    #include <stdbool.h>
+
+    // cooked pictures
+    #include "texCache.h"
+
+    // on-screen size of a painting
+    #include "frustum.h"
+
+    // most paintings a gallery file holds, and distinct pictures they show
+    #define MAX_PAINTINGS  512
+    #define MAX_PICTURES   MAX_PAINTINGS
+
+    // longest side a painting has in the atlas, and streamed in closer up
+    #define PAINTING_TEXELS         256
+    #define PAINTING_DETAIL_TEXELS  2048
+
+    // paintings share square atlas pages of this size, the last page is
+    // cut to the rows it uses
+    #define ATLAS_SIZE       2048
+    #define MAX_ATLAS_PAGES  16
+
+    // mip levels of a page; each painting is surrounded by this many
+    // copies of its edge texels, one at the smallest level, so its
+    // neighbours never bleed into it
+    #define ATLAS_LEVELS  4
+    #define ATLAS_GUTTER  (1 << (ATLAS_LEVELS - 1))
+
+    // distance a painting hangs in front of its wall
+    #define PAINTING_OFFSET  4.0
+
+    // which way a painting faces, hrot in quarter turns; each is one draw
+    // group, so everything on a wall is drawn together
+    #define FACING_POS_Z  0
+    #define FACING_POS_X  1
+    #define FACING_NEG_Z  2
+    #define FACING_NEG_X  3
+    #define NUM_FACINGS   4
+
+    /* a png shown by one or more paintings, loaded, packed and streamed once */
+    typedef struct {
+        char image[256];
+        /* where it sits in the atlas, page -1 if it isn't there */
+        int page;
+        int x, y;
+        int texels;             // longer side there
+        /* its finer levels, streamed in as it is approached */
+        int stream;
+        /* the picture while it loads */
+        cookedtexture cooked;
+        bool ok;
+        char error[256];
+    } picture;
+
+    /* wall paintings */
+    typedef struct {
+        /* center of painting */
+        GLdouble xcenter, ycenter, zcenter;
+        /* horizontal rotation, 0 faces +z and 90 faces +x */
+        GLdouble hrot;
+        /* height in the room, the width follows the picture */
+        GLdouble height;
+        /* the picture it shows */
+        int picture;
+        GLsizei quad;           // first index of its quad in the detail mesh
+        GLdouble corners[4][3];
+    } painting;
+
+    // read placements, one "image x y z hrot height" per line, and start
+    // loading their pictures on the workers, each distinct image once;
+    // false with the reason printed if the file is damaged, quietly if it
+    // is missing
+    bool loadPaintings(const char *fileName);
+
+    // pack the loaded pictures into atlas pages and bake their quads; a
+    // picture that failed to load is reported and left off the walls
+    // call again with a new GL context, once freePaintings has run in the old
+    void initPaintings();
+
+    // ask for the finer levels of the paintings on screen larger than the
+    // atlas holds them, and move the streamed levels along
+    // true while levels are still on the way, so another frame is wanted
+    bool updatePaintings(const viewfrustum *view, const GLint viewport[4]);
+
+    // draw every painting facing one way, one call per atlas page, then
+    // the ones with finer streamed levels over them one by one
+    // the caller enables texturing and sets the material
+    void drawPaintings(int facing);
+
+    // release the pages, their meshes and the streamed levels, while
+    // their context is current
+    void freePaintings();
+
+    #ifdef __cplusplus
+        }
+    #endif
+
+#endif
@@ -1,90 +1,214 @@
-
-
 #include "pngLoader.h"
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdarg.h>
 
-// Loads a PNG file and returns a populated glpngtexture struct
-glpngtexture *genPNGTexture(char *filename)
+// note why a read failed
+static void readError(char *error, size_t errorSize, const char *format, ...)
 {
-    FILE *fp = fopen(filename, "rb");
-    if (!fp) {
-        fprintf(stderr, "Error: Could not open \"%s\"!\n", filename);
-        exit(EXIT_FAILURE);
-    }
+    va_list args;
 
-    png_byte magic[8];
-    fread(magic, 1, sizeof(magic), fp);
-    if (!png_check_sig(magic, sizeof(magic))) {
-        fprintf(stderr, "Error: \"%s\" is not a valid PNG file!\n", filename);
-        fclose(fp);
-        exit(EXIT_FAILURE);
+    if (error == NULL || errorSize == 0)
+        return;
+
+    va_start(args, format);
+    vsnprintf(error, errorSize, format, args);
+    va_end(args);
+}
+
+// libpng read callback for a PNG inside the archive
+static void readStream(png_structp png_ptr, png_bytep data, png_size_t length)
+{
+    if (archiveRead(png_get_io_ptr(png_ptr), data, length) != (long)length)
+        png_error(png_ptr, "Read Error");
+}
+
+// Opens a PNG file and reads its header, so the caller can place the
+// pixels; a file that is not on disk is looked for in the open archive
+// false with the reason in error, nothing to close then
+bool openPNG(const char *filename, pngreader *reader, char *error, size_t errorSize)
+{
+    reader->name   = filename;
+    reader->png    = NULL;
+    reader->info   = NULL;
+    reader->stream = NULL;
+    reader->fp     = fopen(filename, "rb");
+    if (!reader->fp)
+        reader->stream = archiveOpenEntry(filename);
+    if (!reader->fp && !reader->stream) {
+        readError(error, errorSize, "Could not open \"%s\"", filename);
+        return false;
     }
 
-    png_structp png_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
-    if (!png_ptr) {
-        fclose(fp);
-        exit(EXIT_FAILURE);
+    png_byte magic[8];
+    size_t got = reader->fp ? fread(magic, 1, sizeof(magic), reader->fp)
+                            : (size_t)archiveRead(reader->stream, magic, sizeof(magic));
+    if (got != sizeof(magic) || !png_check_sig(magic, sizeof(magic))) {
+        readError(error, errorSize, "\"%s\" is not a valid PNG file", filename);
+        closePNG(reader);
+        return false;
     }
 
-    png_infop info_ptr = png_create_info_struct(png_ptr);
-    if (!info_ptr) {
-        fclose(fp);
-        png_destroy_read_struct(&png_ptr, NULL, NULL);
-        exit(EXIT_FAILURE);
+    reader->png = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+    if (reader->png)
+        reader->info = png_create_info_struct(reader->png);
+    if (!reader->info) {
+        readError(error, errorSize, "Could not start reading \"%s\"", filename);
+        closePNG(reader);
+        return false;
     }
 
-    if (setjmp(png_jmpbuf(png_ptr))) {
-        fclose(fp);
-        png_destroy_read_struct(&png_ptr, &info_ptr, NULL);
-        exit(EXIT_FAILURE);
+    if (setjmp(png_jmpbuf(reader->png))) {
+        readError(error, errorSize, "\"%s\" is damaged", filename);
+        closePNG(reader);
+        return false;
     }
 
-    png_init_io(png_ptr, fp);
-    png_set_sig_bytes(png_ptr, sizeof(magic));
-    png_read_info(png_ptr, info_ptr);
+    if (reader->fp)
+        png_init_io(reader->png, reader->fp);
+    else
+        png_set_read_fn(reader->png, reader->stream, readStream);
+    png_set_sig_bytes(reader->png, sizeof(magic));
+    png_read_info(reader->png, reader->info);
 
     int bit_depth, color_type;
     png_uint_32 width, height;
-    png_get_IHDR(png_ptr, info_ptr, &width, &height, &bit_depth, &color_type, NULL, NULL, NULL);
+    png_get_IHDR(reader->png, reader->info, &width, &height, &bit_depth, &color_type, NULL, NULL, NULL);
 
     // Color conversions
     if (color_type == PNG_COLOR_TYPE_PALETTE)
-        png_set_palette_to_rgb(png_ptr);
+        png_set_palette_to_rgb(reader->png);
     if (color_type == PNG_COLOR_TYPE_GRAY && bit_depth < 8)
-        png_set_expand_gray_1_2_4_to_8(png_ptr);
-    if (png_get_valid(png_ptr, info_ptr, PNG_INFO_tRNS))
-        png_set_tRNS_to_alpha(png_ptr);
+        png_set_expand_gray_1_2_4_to_8(reader->png);
+    if (png_get_valid(reader->png, reader->info, PNG_INFO_tRNS))
+        png_set_tRNS_to_alpha(reader->png);
     if (bit_depth == 16)
-        png_set_strip_16(png_ptr);
+        png_set_strip_16(reader->png);
     else if (bit_depth < 8)
-        png_set_packing(png_ptr);
+        png_set_packing(reader->png);
 
-    png_read_update_info(png_ptr, info_ptr);
+    png_read_update_info(reader->png, reader->info);
 
-    glpngtexture *tex = malloc(sizeof(glpngtexture));
-    GetPNGtextureInfo(color_type, tex);
+    glpngtexture info;
+    if (!GetPNGtextureInfo(png_get_color_type(reader->png, reader->info), &info)) {
+        readError(error, errorSize, "\"%s\" has an unsupported color type", filename);
+        closePNG(reader);
+        return false;
+    }
+
+    reader->width          = (GLsizei)width;
+    reader->height         = (GLsizei)height;
+    reader->format         = info.format;
+    reader->internalFormat = info.internalFormat;
+    return true;
+}
 
-    tex->texels = malloc(width * height * tex->internalFormat);
-    png_bytep *row_pointers = malloc(sizeof(png_bytep) * height);
-    for (int i = 0; i < height; ++i)
-        row_pointers[i] = tex->texels + (height - i - 1) * width * tex->internalFormat;
+// Decodes an opened PNG into texels, width * height * internalFormat
+// bytes packed tight, bottom row first as GL expects; closes the reader
+bool readPNGRows(pngreader *reader, GLubyte *texels, char *error, size_t errorSize)
+{
+    // set before the jump so the cleanup below sees it
+    png_bytep *volatile row_pointers = malloc(sizeof(png_bytep) * reader->height);
+    size_t rowBytes = (size_t)reader->width * reader->internalFormat;
+
+    if (row_pointers == NULL) {
+        readError(error, errorSize, "Out of memory reading \"%s\"", reader->name);
+        closePNG(reader);
+        return false;
+    }
 
-    png_read_image(png_ptr, row_pointers);
-    png_read_end(png_ptr, NULL);
-    png_destroy_read_struct(&png_ptr, &info_ptr, NULL);
+    if (setjmp(png_jmpbuf(reader->png))) {
+        readError(error, errorSize, "\"%s\" is damaged", reader->name);
+        free(row_pointers);
+        closePNG(reader);
+        return false;
+    }
+
+    // flip while decoding, the rows land where GL wants them
+    for (int i = 0; i < reader->height; ++i)
+        row_pointers[i] = texels + (size_t)(reader->height - i - 1) * rowBytes;
+
+    png_read_image(reader->png, row_pointers);
+    png_read_end(reader->png, NULL);
 
     free(row_pointers);
-    fclose(fp);
+    closePNG(reader);
+    return true;
+}
+
+// Releases an opened PNG, safe to call twice
+void closePNG(pngreader *reader)
+{
+    if (reader->png != NULL)
+        png_destroy_read_struct(&reader->png, reader->info != NULL ? &reader->info : NULL, NULL);
+    if (reader->fp != NULL)
+        fclose(reader->fp);
+    archiveCloseEntry(reader->stream);
+
+    reader->png    = NULL;
+    reader->info   = NULL;
+    reader->fp     = NULL;
+    reader->stream = NULL;
+}
 
-    tex->width = (GLsizei)width;
-    tex->height = (GLsizei)height;
+// Loads a PNG file and returns a populated glpngtexture struct, or NULL
+// with the reason in error; safe to call from several threads at once
+glpngtexture *readPNGTexture(const char *filename, char *error, size_t errorSize)
+{
+    pngreader reader;
+
+    if (!openPNG(filename, &reader, error, errorSize))
+        return NULL;
+
+    glpngtexture *tex = calloc(1, sizeof(glpngtexture));
+    if (tex != NULL)
+        tex->texels = malloc((size_t)reader.width * reader.height * reader.internalFormat);
+    if (tex == NULL || tex->texels == NULL) {
+        readError(error, errorSize, "Out of memory reading \"%s\"", filename);
+        freePNGTexture(tex);
+        closePNG(&reader);
+        return NULL;
+    }
+
+    tex->width          = reader.width;
+    tex->height         = reader.height;
+    tex->format         = reader.format;
+    tex->internalFormat = reader.internalFormat;
+
+    if (!readPNGRows(&reader, tex->texels, error, errorSize)) {
+        freePNGTexture(tex);
+        return NULL;
+    }
     return tex;
 }
 
+// Loads a PNG file and returns a populated glpngtexture struct, exits on failure
+glpngtexture *genPNGTexture(char *filename)
+{
+    char error[256];
+    glpngtexture *tex = readPNGTexture(filename, error, sizeof(error));
+
+    if (tex == NULL) {
+        fprintf(stderr, "Error: %s!\n", error);
+        exit(EXIT_FAILURE);
+    }
+    return tex;
+}
+
+// Release a texture and its pixels
+void freePNGTexture(glpngtexture *tex)
+{
+    if (tex == NULL)
+        return;
+
+    free(tex->texels);
+    free(tex);
+}
+
 // Determines OpenGL format and channel count based on PNG color type
-void GetPNGtextureInfo(int color_type, glpngtexture *tex)
+// false for color types without one
+bool GetPNGtextureInfo(int color_type, glpngtexture *tex)
 {
     switch (color_type) {
         case PNG_COLOR_TYPE_GRAY:
@@ -104,7 +228,7 @@ void GetPNGtextureInfo(int color_type, glpngtexture *tex)
             tex->internalFormat = 4;
             break;
         default:
-            fprintf(stderr, "Error: Unsupported PNG color type %d\n", color_type);
-            exit(EXIT_FAILURE);
+            return false;
     }
+    return true;
 }
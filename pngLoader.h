@@ -20,6 +20,13 @@
     // libpng header
     #include <png.h>
 
+    // pictures packed in a zip
+    #include "zipArchive.h"
+
+    #include <stdio.h>
+    #include <stdbool.h>
+    #include <stddef.h>
+
 
     struct _glpngtexture {
         GLsizei  width;
@@ -32,8 +39,27 @@
     typedef struct _glpngtexture glpngtexture;
 
 
+    // a png opened for decoding, its size and format known but no rows read
+    typedef struct {
+        const char  *name;              // for error messages
+        FILE        *fp;
+        zipstream   *stream;            // or the archive entry it is read from
+        png_structp  png;
+        png_infop    info;
+        GLsizei      width;
+        GLsizei      height;
+        GLenum       format;
+        GLint        internalFormat;    // channels per pixel
+    } pngreader;
+
+
+    bool openPNG(const char *filename, pngreader *reader, char *error, size_t errorSize);
+    bool readPNGRows(pngreader *reader, GLubyte *texels, char *error, size_t errorSize);
+    void closePNG(pngreader *reader);
     glpngtexture *genPNGTexture(char *filename);
-    void GetPNGtextureInfo (int color_type, glpngtexture *currentTexture);
+    glpngtexture *readPNGTexture(const char *filename, char *error, size_t errorSize);
+    void freePNGTexture(glpngtexture *tex);
+    bool GetPNGtextureInfo (int color_type, glpngtexture *currentTexture);
 
 
     #ifdef __cplusplus
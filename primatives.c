@@ -59,3 +59,292 @@ void drawFrustum(GLdouble baseWidth, GLdouble topWidth, GLdouble height)
         glVertex3d(-topWidth / 2.0, height, -topWidth / 2.0);
     glEnd();
 }
+
+// tessellate a sphere of radius r centered on the origin
+// poles lie on the z axis and the winding faces outward, as gluSphere
+void tessSphere(glmesh *m, GLdouble radius, GLint slices, GLint stacks)
+{
+    GLuint base = m->numVerts;
+
+    for (int j = 0; j <= stacks; ++j) {
+        GLdouble rho = j * M_PI / stacks;
+
+        for (int i = 0; i <= slices; ++i) {
+            GLdouble theta = (i == slices) ? 0.0 : i * 2.0 * M_PI / slices;
+            GLdouble nx = sin(rho) * sin(theta);
+            GLdouble ny = sin(rho) * cos(theta);
+            GLdouble nz = cos(rho);
+
+            meshAddVertex(m, radius * nx, radius * ny, radius * nz, nx, ny, nz, 0.0, 0.0);
+        }
+    }
+
+    for (int j = 0; j < stacks; ++j) {
+        for (int i = 0; i < slices; ++i) {
+            GLuint a = base + j * (slices + 1) + i;
+            GLuint c = a + slices + 1;
+
+            meshAddTriangle(m, a, a + 1, c);
+            meshAddTriangle(m, a + 1, c + 1, c);
+        }
+    }
+}
+
+// tessellate an open cylinder along the z axis from 0 to height
+// the winding faces outward, as gluCylinder
+void tessCylinder(glmesh *m, GLdouble baseRadius, GLdouble topRadius, GLdouble height,
+                  GLint slices, GLint stacks)
+{
+    GLuint   base  = m->numVerts;
+    GLdouble slope = sqrt(height * height + (baseRadius - topRadius) * (baseRadius - topRadius));
+    GLdouble nxy   = height / slope;
+    GLdouble nz    = (baseRadius - topRadius) / slope;
+
+    for (int j = 0; j <= stacks; ++j) {
+        GLdouble z = j * height / stacks;
+        GLdouble r = baseRadius + (topRadius - baseRadius) * j / stacks;
+
+        for (int i = 0; i <= slices; ++i) {
+            GLdouble theta = (i == slices) ? 0.0 : i * 2.0 * M_PI / slices;
+
+            meshAddVertex(m, r * sin(theta), r * cos(theta), z,
+                          nxy * sin(theta), nxy * cos(theta), nz, 0.0, 0.0);
+        }
+    }
+
+    for (int j = 0; j < stacks; ++j) {
+        for (int i = 0; i < slices; ++i) {
+            GLuint a = base + j * (slices + 1) + i;
+            GLuint c = a + slices + 1;
+
+            meshAddTriangle(m, a, c, a + 1);
+            meshAddTriangle(m, a + 1, c, c + 1);
+        }
+    }
+}
+
+// tessellate a flat disk with a hole of radius inner in the z = 0 plane
+// the winding faces +z, as gluDisk
+void tessDisk(glmesh *m, GLdouble inner, GLdouble outer, GLint slices, GLint loops)
+{
+    GLuint base = m->numVerts;
+
+    for (int j = 0; j <= loops; ++j) {
+        GLdouble r = inner + (outer - inner) * j / loops;
+
+        for (int i = 0; i <= slices; ++i) {
+            GLdouble theta = (i == slices) ? 0.0 : i * 2.0 * M_PI / slices;
+
+            meshAddVertex(m, r * sin(theta), r * cos(theta), 0.0, 0.0, 0.0, 1.0, 0.0, 0.0);
+        }
+    }
+
+    for (int j = 0; j < loops; ++j) {
+        for (int i = 0; i < slices; ++i) {
+            GLuint a = base + j * (slices + 1) + i;
+            GLuint c = a + slices + 1;
+
+            meshAddTriangle(m, a, a + 1, c);
+            meshAddTriangle(m, a + 1, c + 1, c);
+        }
+    }
+}
+
+// tessellate a torus around the z axis with tube radius inner
+// and center radius outer, as glutSolidTorus
+void tessTorus(glmesh *m, GLdouble inner, GLdouble outer, GLint sides, GLint rings)
+{
+    GLuint base = m->numVerts;
+
+    for (int j = 0; j <= rings; ++j) {
+        GLdouble phi = (j == rings) ? 0.0 : j * 2.0 * M_PI / rings;
+
+        for (int i = 0; i <= sides; ++i) {
+            GLdouble theta = (i == sides) ? 0.0 : i * 2.0 * M_PI / sides;
+            GLdouble nx = cos(phi) * cos(theta);
+            GLdouble ny = sin(phi) * cos(theta);
+            GLdouble nz = sin(theta);
+
+            meshAddVertex(m, cos(phi) * outer + nx * inner, sin(phi) * outer + ny * inner, nz * inner,
+                          nx, ny, nz, 0.0, 0.0);
+        }
+    }
+
+    for (int j = 0; j < rings; ++j) {
+        for (int i = 0; i < sides; ++i) {
+            GLuint a = base + j * (sides + 1) + i;
+            GLuint c = a + sides + 1;
+
+            meshAddTriangle(m, a, c, a + 1);
+            meshAddTriangle(m, a + 1, c, c + 1);
+        }
+    }
+}
+
+// Newell teapot control points, one quadrant (or one half
+// for the handle and spout) in the layout used by glut
+static const GLfloat teapotPoints[][3] = {
+    {1.4, 0.0, 2.4},        {1.4, -0.784, 2.4},       {0.784, -1.4, 2.4},       {0.0, -1.4, 2.4},
+    {1.3375, 0.0, 2.53125}, {1.3375, -0.749, 2.53125}, {0.749, -1.3375, 2.53125}, {0.0, -1.3375, 2.53125},
+    {1.4375, 0.0, 2.53125}, {1.4375, -0.805, 2.53125}, {0.805, -1.4375, 2.53125}, {0.0, -1.4375, 2.53125},
+    {1.5, 0.0, 2.4},        {1.5, -0.84, 2.4},        {0.84, -1.5, 2.4},        {0.0, -1.5, 2.4},
+    {1.75, 0.0, 1.875},     {1.75, -0.98, 1.875},     {0.98, -1.75, 1.875},     {0.0, -1.75, 1.875},
+    {2.0, 0.0, 1.35},       {2.0, -1.12, 1.35},       {1.12, -2.0, 1.35},       {0.0, -2.0, 1.35},
+    {2.0, 0.0, 0.9},        {2.0, -1.12, 0.9},        {1.12, -2.0, 0.9},        {0.0, -2.0, 0.9},
+    {2.0, 0.0, 0.45},       {2.0, -1.12, 0.45},       {1.12, -2.0, 0.45},       {0.0, -2.0, 0.45},
+    {1.5, 0.0, 0.225},      {1.5, -0.84, 0.225},      {0.84, -1.5, 0.225},      {0.0, -1.5, 0.225},
+    {1.5, 0.0, 0.15},       {1.5, -0.84, 0.15},       {0.84, -1.5, 0.15},       {0.0, -1.5, 0.15},
+    {0.0, 0.0, 3.15},       {0.0, -0.002, 3.15},      {0.002, 0.0, 3.15},       {0.8, 0.0, 3.15},
+    {0.8, -0.45, 3.15},     {0.45, -0.8, 3.15},       {0.0, -0.8, 3.15},        {0.0, 0.0, 2.85},
+    {0.2, 0.0, 2.7},        {0.2, -0.112, 2.7},       {0.112, -0.2, 2.7},       {0.0, -0.2, 2.7},
+    {0.4, 0.0, 2.55},       {0.4, -0.224, 2.55},      {0.224, -0.4, 2.55},      {0.0, -0.4, 2.55},
+    {1.3, 0.0, 2.55},       {1.3, -0.728, 2.55},      {0.728, -1.3, 2.55},      {0.0, -1.3, 2.55},
+    {1.3, 0.0, 2.4},        {1.3, -0.728, 2.4},       {0.728, -1.3, 2.4},       {0.0, -1.3, 2.4},
+    {0.0, 0.0, 0.0},        {0.0, -1.425, 0.0},       {0.798, -1.425, 0.0},     {1.425, -0.798, 0.0},
+    {1.425, 0.0, 0.0},      {0.0, -1.5, 0.075},       {0.84, -1.5, 0.075},      {1.5, -0.84, 0.075},
+    {1.5, 0.0, 0.075},      {-1.6, 0.0, 2.025},       {-1.6, -0.3, 2.025},      {-1.5, -0.3, 2.25},
+    {-1.5, 0.0, 2.25},      {-2.3, 0.0, 2.025},       {-2.3, -0.3, 2.025},      {-2.5, -0.3, 2.25},
+    {-2.5, 0.0, 2.25},      {-2.7, 0.0, 2.025},       {-2.7, -0.3, 2.025},      {-3.0, -0.3, 2.25},
+    {-3.0, 0.0, 2.25},      {-2.7, 0.0, 1.8},         {-2.7, -0.3, 1.8},        {-3.0, -0.3, 1.8},
+    {-3.0, 0.0, 1.8},       {-2.7, 0.0, 1.575},       {-2.7, -0.3, 1.575},      {-3.0, -0.3, 1.35},
+    {-3.0, 0.0, 1.35},      {-2.5, 0.0, 1.125},       {-2.5, -0.3, 1.125},      {-2.65, -0.3, 0.9375},
+    {-2.65, 0.0, 0.9375},   {-2.0, 0.0, 0.9},         {-2.0, -0.3, 0.9},        {-1.9, -0.3, 0.6},
+    {-1.9, 0.0, 0.6},       {1.7, 0.0, 1.425},        {1.7, -0.66, 1.425},      {1.7, -0.66, 0.6},
+    {1.7, 0.0, 0.6},        {2.6, 0.0, 1.425},        {2.6, -0.66, 1.425},      {3.1, -0.66, 0.825},
+    {3.1, 0.0, 0.825},      {2.3, 0.0, 2.1},          {2.3, -0.25, 2.1},        {2.4, -0.25, 2.025},
+    {2.4, 0.0, 2.025},      {2.7, 0.0, 2.4},          {2.7, -0.25, 2.4},        {3.3, -0.25, 2.4},
+    {3.3, 0.0, 2.4},        {2.8, 0.0, 2.475},        {2.8, -0.25, 2.475},      {3.525, -0.25, 2.49375},
+    {3.525, 0.0, 2.49375},  {2.9, 0.0, 2.475},        {2.9, -0.15, 2.475},      {3.45, -0.15, 2.5125},
+    {3.45, 0.0, 2.5125},    {2.8, 0.0, 2.4},          {2.8, -0.15, 2.4},        {3.2, -0.15, 2.4},
+    {3.2, 0.0, 2.4}
+};
+
+// bicubic patches as indices into teapotPoints
+// the first six are mirrored into four quadrants, the rest into two halves
+static const int teapotPatches[][16] = {
+    {  0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15},  // rim
+    { 12,  13,  14,  15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27},  // body
+    { 24,  25,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,  39},
+    { 40,  40,  40,  40,  43,  44,  45,  46,  47,  47,  47,  47,  48,  49,  50,  51},  // lid
+    { 48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63},
+    { 64,  64,  64,  64,  65,  66,  67,  68,  69,  70,  71,  72,  39,  38,  37,  36},  // bottom
+    { 73,  74,  75,  76,  77,  78,  79,  80,  81,  82,  83,  84,  85,  86,  87,  88},  // handle
+    { 85,  86,  87,  88,  89,  90,  91,  92,  93,  94,  95,  96,  97,  98,  99, 100},
+    {101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116},  // spout
+    {113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128}
+};
+
+// cubic Bernstein weights and their derivatives at t
+static void bernstein(GLdouble t, GLdouble b[4], GLdouble db[4])
+{
+    GLdouble s = 1.0 - t;
+
+    b[0] = s * s * s;
+    b[1] = 3.0 * t * s * s;
+    b[2] = 3.0 * t * t * s;
+    b[3] = t * t * t;
+
+    db[0] = -3.0 * s * s;
+    db[1] = 3.0 * s * s - 6.0 * t * s;
+    db[2] = 6.0 * t * s - 3.0 * t * t;
+    db[3] = 3.0 * t * t;
+}
+
+// point and unnormalized normal of patch cp at u, v
+static void evalPatch(GLdouble cp[4][4][3], GLdouble u, GLdouble v, GLdouble p[3], GLdouble n[3])
+{
+    GLdouble bu[4], dbu[4], bv[4], dbv[4];
+    GLdouble du[3] = {0.0, 0.0, 0.0};
+    GLdouble dv[3] = {0.0, 0.0, 0.0};
+
+    bernstein(u, bu, dbu);
+    bernstein(v, bv, dbv);
+    p[0] = p[1] = p[2] = 0.0;
+
+    for (int j = 0; j < 4; ++j) {
+        for (int k = 0; k < 4; ++k) {
+            for (int l = 0; l < 3; ++l) {
+                p[l]  += bv[j]  * bu[k]  * cp[j][k][l];
+                du[l] += bv[j]  * dbu[k] * cp[j][k][l];
+                dv[l] += dbv[j] * bu[k]  * cp[j][k][l];
+            }
+        }
+    }
+
+    n[0] = du[1] * dv[2] - du[2] * dv[1];
+    n[1] = du[2] * dv[0] - du[0] * dv[2];
+    n[2] = du[0] * dv[1] - du[1] * dv[0];
+}
+
+// tessellate one patch on a grid x grid lattice
+// points go through glut's teapot transform: z up becomes y up,
+// the teapot is scaled by size / 2 and rests 1.5 units lower
+static void tessPatch(glmesh *m, GLdouble cp[4][4][3], GLdouble size, GLint grid)
+{
+    GLuint   base  = m->numVerts;
+    GLdouble scale = 0.5 * size;
+
+    for (int j = 0; j <= grid; ++j) {
+        for (int i = 0; i <= grid; ++i) {
+            GLdouble u = (GLdouble)i / grid;
+            GLdouble v = (GLdouble)j / grid;
+            GLdouble p[3], n[3], len;
+
+            evalPatch(cp, u, v, p, n);
+
+            // the lid and bottom collapse to a point, take the normal just off it
+            len = sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+            if (len < 1.0e-6) {
+                GLdouble q[3];
+                evalPatch(cp, u, (v < 0.5) ? 1.0e-3 : 1.0 - 1.0e-3, q, n);
+                len = sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+            }
+            if (len > 0.0) {
+                n[0] /= len;  n[1] /= len;  n[2] /= len;
+            }
+
+            meshAddVertex(m, p[0] * scale, (p[2] - 1.5) * scale, -p[1] * scale,
+                          n[0], n[2], -n[1], u, v);
+        }
+    }
+
+    for (int j = 0; j < grid; ++j) {
+        for (int i = 0; i < grid; ++i) {
+            GLuint a = base + j * (grid + 1) + i;
+            GLuint c = a + grid + 1;
+
+            meshAddTriangle(m, a, a + 1, c);
+            meshAddTriangle(m, a + 1, c + 1, c);
+        }
+    }
+}
+
+// tessellate the teapot with the size and orientation of glutSolidTeapot
+void tessTeapot(glmesh *m, GLdouble size, GLint grid)
+{
+    int numPatches = sizeof(teapotPatches) / sizeof(teapotPatches[0]);
+
+    for (int i = 0; i < numPatches; ++i) {
+        int copies = (i < 6) ? 4 : 2;
+
+        // mirror in y, then in x, reversing u each time to keep the winding
+        for (int c = 0; c < copies; ++c) {
+            GLdouble cp[4][4][3];
+            GLdouble sx = (c >= 2) ? -1.0 : 1.0;
+            GLdouble sy = (c == 1 || c == 3) ? -1.0 : 1.0;
+            int      flip = (sx * sy < 0.0);
+
+            for (int j = 0; j < 4; ++j) {
+                for (int k = 0; k < 4; ++k) {
+                    const GLfloat *src = teapotPoints[teapotPatches[i][j * 4 + (flip ? 3 - k : k)]];
+
+                    cp[j][k][0] = src[0] * sx;
+                    cp[j][k][1] = src[1] * sy;
+                    cp[j][k][2] = src[2];
+                }
+            }
+
+            tessPatch(m, cp, size, grid);
+        }
+    }
+}
@@ -20,6 +20,9 @@
         #include <GL/glut.h>
     #endif
 
+    // static vertex buffers
+    #include "meshBuffer.h"
+
     // number of tessilations
     #define PRIMATIVE_RES 8
 
@@ -29,6 +32,22 @@
     // draw a frustum with base w1, top width w2, and height h
     void drawTrap(GLdouble w1, GLdouble w2, GLdouble h);
 
+    // tessellate a sphere into m, laid out like gluSphere
+    void tessSphere(glmesh *m, GLdouble radius, GLint slices, GLint stacks);
+
+    // tessellate an open cylinder into m, laid out like gluCylinder
+    void tessCylinder(glmesh *m, GLdouble base, GLdouble top, GLdouble height,
+                      GLint slices, GLint stacks);
+
+    // tessellate a flat disk into m, laid out like gluDisk
+    void tessDisk(glmesh *m, GLdouble inner, GLdouble outer, GLint slices, GLint loops);
+
+    // tessellate a torus into m, laid out like glutSolidTorus
+    void tessTorus(glmesh *m, GLdouble inner, GLdouble outer, GLint sides, GLint rings);
+
+    // tessellate the teapot into m, sized and placed like glutSolidTeapot
+    void tessTeapot(glmesh *m, GLdouble size, GLint grid);
+
     #ifdef __cplusplus
         }
     #endif
@@ -0,0 +1,295 @@
+// standard c headers
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+// OpenGL and GLUT headers
+#ifdef __APPLE__
+    #include <GLUT/glut.h>
+#else
+    #include <GL/gl.h>
+    #include <GL/glu.h>
+    #include <GL/glut.h>
+#endif
+
+// prototypes and definitions
+#include "profiler.h"
+
+// GPU times need timer queries, in the headers and in the context
+#ifdef GL_TIME_ELAPSED
+    #define PROF_GPU 1
+#else
+    #define PROF_GPU 0
+#endif
+
+// a named stage and its recent times, -1 where there is none
+typedef struct {
+    const char *name;
+    double cpu[PROF_HISTORY];
+    double gpu[PROF_HISTORY];
+    GLuint queries[PROF_LATENCY];   // one per frame in flight
+    bool   issued[PROF_LATENCY];    // query was ended and holds a result to collect
+    long   issuedFrame[PROF_LATENCY];
+    double issuedStart[PROF_LATENCY];
+    bool   timing;                  // a query is open for the open scope
+} profscope;
+
+bool profEnabled = false;
+
+static profscope scopes[PROF_MAX_SCOPES];
+static int numScopes = 0;
+
+// frames started since timing was enabled
+static long frameNum = -1;
+
+// the open scope and when it began
+static profscope *openScope = NULL;
+static double openStart;
+
+// milliseconds on the monotonic clock
+static double nowMs()
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000.0 + t.tv_nsec / 1000000.0;
+}
+
+#if PROF_GPU
+// true if the context can time on the GPU, checked once
+static bool hasTimerQuery()
+{
+    static int supported = -1;
+
+    if (supported < 0) {
+        const char *ext = (const char *)glGetString(GL_EXTENSIONS);
+        supported = ext != NULL && (strstr(ext, "GL_ARB_timer_query") != NULL ||
+                                    strstr(ext, "GL_EXT_timer_query") != NULL);
+    }
+    return supported;
+}
+#endif
+
+// forget every recorded time
+static void profClear()
+{
+    for (int i = 0; i < numScopes; ++i) {
+        for (int f = 0; f < PROF_HISTORY; ++f)
+            scopes[i].cpu[f] = scopes[i].gpu[f] = -1.0;
+        for (int s = 0; s < PROF_LATENCY; ++s)
+            scopes[i].issued[s] = false;
+        scopes[i].timing = false;
+    }
+    frameNum = -1;
+    openScope = NULL;
+}
+
+// start or stop timing, clearing the history on start
+void profEnable(bool on)
+{
+    if (on && !profEnabled)
+        profClear();
+    else if (!on && openScope != NULL)
+        profEnd();
+
+    profEnabled = on;
+}
+
+// read the GPU times from the oldest frame in flight; ones not
+// back yet are dropped rather than waited for
+static void profCollect(int slot)
+{
+#if PROF_GPU
+    if (!hasTimerQuery())
+        return;
+
+    for (int i = 0; i < numScopes; ++i) {
+        profscope *s = &scopes[i];
+        GLuint available = 0;
+        GLuint64 elapsed = 0;
+
+        if (!s->issued[slot])
+            continue;
+        s->issued[slot] = false;
+
+        glGetQueryObjectuiv(s->queries[slot], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available)
+            continue;
+
+        glGetQueryObjectui64v(s->queries[slot], GL_QUERY_RESULT, &elapsed);
+
+        // the GPU can't take longer than the wall time since the query
+        // began; some drivers (llvmpipe) time a context's first query
+        // from boot, so anything longer is dropped
+        double ms = elapsed / 1000000.0;
+        if (ms <= nowMs() - s->issuedStart[slot])
+            s->gpu[s->issuedFrame[slot] % PROF_HISTORY] = ms;
+    }
+#endif
+}
+
+// start a new frame, collecting finished GPU times
+void profFrame()
+{
+    if (!profEnabled)
+        return;
+
+    if (openScope != NULL)
+        profEnd();
+
+    ++frameNum;
+
+    // the slot this frame reuses was last filled PROF_LATENCY frames ago
+    profCollect(frameNum % PROF_LATENCY);
+
+    for (int i = 0; i < numScopes; ++i)
+        scopes[i].cpu[frameNum % PROF_HISTORY] = scopes[i].gpu[frameNum % PROF_HISTORY] = -1.0;
+}
+
+// find a scope by name, adding it the first time it's seen
+static profscope *profLookup(const char *name)
+{
+    for (int i = 0; i < numScopes; ++i)
+        if (scopes[i].name == name || strcmp(scopes[i].name, name) == 0)
+            return &scopes[i];
+
+    if (numScopes == PROF_MAX_SCOPES)
+        return NULL;
+
+    profscope *s = &scopes[numScopes++];
+    s->name = name;
+    for (int f = 0; f < PROF_HISTORY; ++f)
+        s->cpu[f] = s->gpu[f] = -1.0;
+    for (int slot = 0; slot < PROF_LATENCY; ++slot)
+        s->issued[slot] = false;
+    s->timing = false;
+#if PROF_GPU
+    if (hasTimerQuery())
+        glGenQueries(PROF_LATENCY, s->queries);
+#endif
+    return s;
+}
+
+// start a scope; scopes don't nest, this ends any open one
+void profBegin(const char *name)
+{
+    if (!profEnabled || frameNum < 0)
+        return;
+
+    if (openScope != NULL)
+        profEnd();
+
+    openScope = profLookup(name);
+    if (openScope == NULL)
+        return;
+
+#if PROF_GPU
+    int slot = frameNum % PROF_LATENCY;
+
+    // a scope seen twice in a frame is only timed on the GPU once
+    if (hasTimerQuery() && !openScope->issued[slot]) {
+        glBeginQuery(GL_TIME_ELAPSED, openScope->queries[slot]);
+        openScope->issuedStart[slot] = nowMs();
+        openScope->timing = true;
+    }
+#endif
+
+    openStart = nowMs();
+}
+
+// end the open scope
+void profEnd()
+{
+    if (openScope == NULL)
+        return;
+
+    double *cpu = &openScope->cpu[frameNum % PROF_HISTORY];
+    double elapsed = nowMs() - openStart;
+
+    *cpu = (*cpu < 0.0) ? elapsed : *cpu + elapsed;
+
+#if PROF_GPU
+    int slot = frameNum % PROF_LATENCY;
+
+    if (openScope->timing) {
+        glEndQuery(GL_TIME_ELAPSED);
+        openScope->issued[slot] = true;
+        openScope->issuedFrame[slot] = frameNum;
+        openScope->timing = false;
+    }
+#endif
+
+    openScope = NULL;
+}
+
+// averages and maxima over the history, one line per scope
+void profPrint(FILE *file)
+{
+    fprintf(file, "%-24s %10s %10s %10s %10s\n", "scope", "cpu avg", "cpu max", "gpu avg", "gpu max");
+
+    for (int i = 0; i < numScopes; ++i) {
+        const profscope *s = &scopes[i];
+        double cpuSum = 0.0, cpuMax = 0.0, gpuSum = 0.0, gpuMax = 0.0;
+        int cpuCount = 0, gpuCount = 0;
+
+        for (int f = 0; f < PROF_HISTORY; ++f) {
+            if (s->cpu[f] >= 0.0) {
+                cpuSum += s->cpu[f];
+                cpuMax = (s->cpu[f] > cpuMax) ? s->cpu[f] : cpuMax;
+                ++cpuCount;
+            }
+            if (s->gpu[f] >= 0.0) {
+                gpuSum += s->gpu[f];
+                gpuMax = (s->gpu[f] > gpuMax) ? s->gpu[f] : gpuMax;
+                ++gpuCount;
+            }
+        }
+
+        fprintf(file, "%-24s %10.3f %10.3f ", s->name,
+                cpuCount ? cpuSum / cpuCount : 0.0, cpuMax);
+        if (gpuCount)
+            fprintf(file, "%10.3f %10.3f\n", gpuSum / gpuCount, gpuMax);
+        else
+            fprintf(file, "%10s %10s\n", "-", "-");
+    }
+}
+
+// every frame of the history as csv: frame, scope, cpu ms, gpu ms
+// gpu ms is -1 where no result came back
+bool profDump(const char *fileName)
+{
+    FILE *file = fopen(fileName, "w");
+    long first = frameNum - PROF_HISTORY + 1;
+
+    if (file == NULL) {
+        fprintf(stderr, "Error: could not open %s for writing.\n", fileName);
+        return false;
+    }
+
+    // the newest frames may still have GPU times in flight
+    fprintf(file, "frame,scope,cpu_ms,gpu_ms\n");
+    for (long f = (first < 0) ? 0 : first; f <= frameNum; ++f)
+        for (int i = 0; i < numScopes; ++i)
+            if (scopes[i].cpu[f % PROF_HISTORY] >= 0.0)
+                fprintf(file, "%ld,%s,%.4f,%.4f\n", f, scopes[i].name,
+                        scopes[i].cpu[f % PROF_HISTORY], scopes[i].gpu[f % PROF_HISTORY]);
+
+    fclose(file);
+    return true;
+}
+
+// delete the GPU queries, before the context goes
+void profCleanUp()
+{
+    if (openScope != NULL)
+        profEnd();
+
+#if PROF_GPU
+    if (hasTimerQuery())
+        for (int i = 0; i < numScopes; ++i)
+            glDeleteQueries(PROF_LATENCY, scopes[i].queries);
+#endif
+    numScopes = 0;
+}
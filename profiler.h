@@ -0,0 +1,53 @@
+#ifndef PROFILER_H
+    #define PROFILER_H
+
+    // make c++ friendly
+    #ifdef __cplusplus
+        extern "C" {
+    #endif
+
+    // OpenGL and GLUT headers
+    #ifdef __APPLE__
+        #include <GLUT/glut.h>
+    #else
+        #include <GL/gl.h>
+        #include <GL/glu.h>
+        #include <GL/glut.h>
+    #endif
+
+    #include <stdio.h>
+    #include <stdbool.h>
+
+    // most distinct scope names
+    #define PROF_MAX_SCOPES 32
+
+    // frames of history kept per scope
+    #define PROF_HISTORY 128
+
+    // frames a GPU query is left before its result is read, enough
+    // that reading it normally doesn't wait on the GL
+    #define PROF_LATENCY 3
+
+    // is timing on
+    extern bool profEnabled;
+
+    void profEnable(bool on);           // start or stop timing, clearing the history on start
+    void profFrame();                   // start a new frame, collecting finished GPU times
+    void profBegin(const char *name);   // start a scope; scopes don't nest, this ends any open one
+    void profEnd();                     // end the open scope
+
+    // averages and maxima over the history, one line per scope
+    void profPrint(FILE *file);
+
+    // every frame of the history as csv: frame, scope, cpu ms, gpu ms
+    // gpu ms is -1 where no result came back
+    bool profDump(const char *fileName);
+
+    // delete the GPU queries, before the context goes
+    void profCleanUp();
+
+    #ifdef __cplusplus
+        }
+    #endif
+
+#endif
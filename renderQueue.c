@@ -0,0 +1,90 @@
+
+// OpenGL and GLUT headers
+#ifdef __APPLE__
+    #include <GLUT/glut.h>
+#else
+    #include <GL/gl.h>
+    #include <GL/glu.h>
+    #include <GL/glut.h>
+#endif
+
+// standard c headers
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+// prototypes and definitions
+#include "renderQueue.h"
+
+// shadowed GL state
+#include "glState.h"
+
+// per-stage frame timing
+#include "profiler.h"
+
+static renderitem queue[RQ_MAX_ITEMS];
+static int        numItems = 0;
+
+// empty the queue
+void rqClear()
+{
+    numItems = 0;
+}
+
+// order of non-negative floats matches the order of their bits
+static unsigned int depthBits(GLdouble depth)
+{
+    float        d = (depth > 0.0) ? (float)depth : 0.0f;
+    unsigned int bits;
+
+    memcpy(&bits, &d, sizeof(bits));
+    return bits;
+}
+
+// queue an item at eye depth
+void rqSubmit(int pass, int material, GLdouble depth, void (*draw)(void), const char *name)
+{
+    if (numItems >= RQ_MAX_ITEMS) {
+        fprintf(stderr, "Error: Render queue limit is %d items\n", RQ_MAX_ITEMS);
+        exit(EXIT_FAILURE);
+    }
+
+    unsigned int d = depthBits(depth);
+    if (pass == RQ_PASS_TRANSLUCENT)
+        d = ~d;
+
+    queue[numItems].key  = ((unsigned long long)(pass & 0x3) << 62) |
+                           ((unsigned long long)d << 30) |
+                           ((unsigned long long)material & 0x3fffffff);
+    queue[numItems].draw = draw;
+    queue[numItems].name = name;
+    ++numItems;
+}
+
+static int compareItems(const void *a, const void *b)
+{
+    unsigned long long ka = ((const renderitem *)a)->key;
+    unsigned long long kb = ((const renderitem *)b)->key;
+
+    return (ka > kb) - (ka < kb);
+}
+
+// sort, draw and empty the queue
+void rqFlush()
+{
+    qsort(queue, numItems, sizeof(renderitem), compareItems);
+
+    for (int i = 0; i < numItems; ++i) {
+        // translucent items blend over everything and leave depth alone
+        bool translucent = (queue[i].key >> 62) == RQ_PASS_TRANSLUCENT;
+        glsDepthMask(translucent ? GL_FALSE : GL_TRUE);
+
+        profBegin(queue[i].name);
+        queue[i].draw();
+    }
+    profEnd();
+
+    glsDepthMask(GL_TRUE);
+    numItems = 0;
+}
@@ -0,0 +1,44 @@
+#ifndef RENDERQUEUE_H
+    #define RENDERQUEUE_H
+
+    // make c++ friendly
+    #ifdef __cplusplus
+        extern "C" {
+    #endif
+
+    // OpenGL and GLUT headers
+    #ifdef __APPLE__
+        #include <GLUT/glut.h>
+    #else
+        #include <GL/gl.h>
+        #include <GL/glu.h>
+        #include <GL/glut.h>
+    #endif
+
+    // most items queued in one frame
+    #define RQ_MAX_ITEMS 64
+
+    // passes, drawn in this order
+    #define RQ_PASS_OPAQUE      0   // front to back, writes depth
+    #define RQ_PASS_BACKGROUND  1   // after every opaque item, e.g. the outside
+    #define RQ_PASS_TRANSLUCENT 2   // back to front, depth writes off
+
+    /* key bits, high to low: pass (2), depth (32), material (30)
+       translucent depths are inverted so a plain ascending sort
+       gives front to back for opaque and back to front otherwise */
+    typedef struct {
+        unsigned long long key;
+        void (*draw)(void);
+        const char *name;       // profiler scope
+    } renderitem;
+
+    void rqClear();                                     // empty the queue
+    void rqSubmit(int pass, int material,               // queue an item at eye depth
+                  GLdouble depth, void (*draw)(void), const char *name);
+    void rqFlush();                                     // sort, draw and empty the queue
+
+    #ifdef __cplusplus
+        }
+    #endif
+
+#endif
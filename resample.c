@@ -0,0 +1,293 @@
+
+// OpenGL and GLUT headers
+#ifdef __APPLE__
+    #include <GLUT/glut.h>
+#else
+    #include <GL/gl.h>
+    #include <GL/glu.h>
+    #include <GL/glut.h>
+#endif
+
+// standard c headers
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// SSE2 is always there on x86-64, anything else takes the plain loops
+#ifdef __SSE2__
+    #include <emmintrin.h>
+#endif
+
+// prototypes and definitions
+#include "resample.h"
+
+// bands run on the shared workers
+#include "workerPool.h"
+
+// filter weights are fixed point with this many fraction bits
+#define WEIGHT_BITS 14
+#define WEIGHT_ONE  (1 << WEIGHT_BITS)
+
+// the source rows one output row is made of
+typedef struct {
+    int    first;
+    int    count;
+    short *weights;         // count of them, summing to WEIGHT_ONE
+} contrib;
+
+// one band of output rows of a pass
+typedef struct {
+    const GLubyte *src;
+    GLubyte       *dst;
+    int            rowBytes;
+    const contrib *rows;
+    int            y0, y1;
+} resampleband;
+
+// nearest power of 2 to x
+static int nearestPower2(int x)
+{
+    int p = 1;
+
+    while (p * 2 <= x)
+        p *= 2;
+    return x - p < 2 * p - x ? p : 2 * p;
+}
+
+// the size an image is loaded at
+void resampleSize(int w, int h, int maxSize, bool power2, int *dw, int *dh)
+{
+    double f = 1.0;
+
+    if (maxSize > 0 && (w > maxSize || h > maxSize))
+        f = (double)maxSize / (w > h ? w : h);
+
+    *dw = (int)(w * f + 0.5);
+    *dh = (int)(h * f + 0.5);
+    if (*dw < 1) *dw = 1;
+    if (*dh < 1) *dh = 1;
+
+    if (power2) {
+        *dw = nearestPower2(*dw);
+        *dh = nearestPower2(*dh);
+        while (maxSize > 0 && *dw > maxSize && *dw > 1) *dw /= 2;
+        while (maxSize > 0 && *dh > maxSize && *dh > 1) *dh /= 2;
+    }
+}
+
+// weights of the source rows under each of dstLen output rows, the
+// triangle widened to the output pixel when shrinking; NULL if out of memory
+static contrib *buildContribs(int srcLen, int dstLen)
+{
+    double scale   = (double)srcLen / dstLen;
+    double support = scale > 1.0 ? scale : 1.0;
+    int    most    = (int)ceil(2.0 * support) + 2;
+
+    contrib *c   = malloc(sizeof(contrib) * dstLen + sizeof(short) * dstLen * most);
+    double  *w   = malloc(sizeof(double) * most);
+    short   *all = (short *)(c + dstLen);
+
+    if (c == NULL || w == NULL) {
+        free(c);
+        free(w);
+        return NULL;
+    }
+
+    for (int i = 0; i < dstLen; ++i) {
+        double center = (i + 0.5) * scale;
+        int    lo     = (int)floor(center - support);
+        int    hi     = (int)ceil(center + support);
+        double sum    = 0.0;
+
+        // rows past the edges are left out and the rest renormalized
+        if (lo < 0)
+            lo = 0;
+        if (hi > srcLen - 1)
+            hi = srcLen - 1;
+        if (hi - lo + 1 > most)
+            hi = lo + most - 1;
+
+        for (int j = lo; j <= hi; ++j) {
+            double d = fabs(j + 0.5 - center) / support;
+            w[j - lo] = d < 1.0 ? 1.0 - d : 0.0;
+            sum += w[j - lo];
+        }
+
+        // a pixel between two rows that both miss keeps the nearer one
+        if (sum <= 0.0) {
+            int j = (int)center < srcLen ? (int)center : srcLen - 1;
+            lo = hi = j;
+            w[0] = sum = 1.0;
+        }
+
+        // trim the zero weights at the ends
+        while (w[0] <= 0.0) {
+            memmove(w, w + 1, sizeof(double) * (hi - lo));
+            ++lo;
+        }
+        while (w[hi - lo] <= 0.0)
+            --hi;
+
+        // fixed point, the rounding left over goes to the heaviest row
+        c[i].first   = lo;
+        c[i].count   = hi - lo + 1;
+        c[i].weights = all + (size_t)i * most;
+
+        int total = 0, heaviest = 0;
+        for (int k = 0; k < c[i].count; ++k) {
+            c[i].weights[k] = (short)(w[k] / sum * WEIGHT_ONE + 0.5);
+            total += c[i].weights[k];
+            if (c[i].weights[k] > c[i].weights[heaviest])
+                heaviest = k;
+        }
+        c[i].weights[heaviest] += WEIGHT_ONE - total;
+    }
+
+    free(w);
+    return c;
+}
+
+// filter one output row sixteen bytes at a time, returns the first byte
+// left for the plain loop
+static int filterRowSIMD(const GLubyte *src, int rowBytes, const contrib *c, GLubyte *out)
+{
+    int x = 0;
+
+#ifdef __SSE2__
+    __m128i zero  = _mm_setzero_si128();
+    __m128i round = _mm_set1_epi32(WEIGHT_ONE / 2);
+
+    for (; x + 16 <= rowBytes; x += 16) {
+        __m128i acc0 = round, acc1 = round, acc2 = round, acc3 = round;
+
+        // two source rows per multiply-add, their bytes interleaved
+        for (int k = 0; k < c->count; k += 2) {
+            const GLubyte *r = src + (size_t)(c->first + k) * rowBytes + x;
+            int w1 = k + 1 < c->count ? c->weights[k + 1] : 0;
+            __m128i a = _mm_loadu_si128((const __m128i *)r);
+            __m128i b = w1 != 0 ? _mm_loadu_si128((const __m128i *)(r + rowBytes)) : zero;
+            __m128i w = _mm_set1_epi32((w1 << 16) | (c->weights[k] & 0xffff));
+
+            __m128i alo = _mm_unpacklo_epi8(a, zero), ahi = _mm_unpackhi_epi8(a, zero);
+            __m128i blo = _mm_unpacklo_epi8(b, zero), bhi = _mm_unpackhi_epi8(b, zero);
+
+            acc0 = _mm_add_epi32(acc0, _mm_madd_epi16(_mm_unpacklo_epi16(alo, blo), w));
+            acc1 = _mm_add_epi32(acc1, _mm_madd_epi16(_mm_unpackhi_epi16(alo, blo), w));
+            acc2 = _mm_add_epi32(acc2, _mm_madd_epi16(_mm_unpacklo_epi16(ahi, bhi), w));
+            acc3 = _mm_add_epi32(acc3, _mm_madd_epi16(_mm_unpackhi_epi16(ahi, bhi), w));
+        }
+
+        __m128i lo = _mm_packs_epi32(_mm_srai_epi32(acc0, WEIGHT_BITS), _mm_srai_epi32(acc1, WEIGHT_BITS));
+        __m128i hi = _mm_packs_epi32(_mm_srai_epi32(acc2, WEIGHT_BITS), _mm_srai_epi32(acc3, WEIGHT_BITS));
+        _mm_storeu_si128((__m128i *)(out + x), _mm_packus_epi16(lo, hi));
+    }
+#endif
+
+    return x;
+}
+
+// filter a band of output rows down the columns, run on a worker
+static void filterBand(void *arg)
+{
+    resampleband *b = arg;
+
+    for (int y = b->y0; y < b->y1; ++y) {
+        const contrib *c   = &b->rows[y];
+        GLubyte       *out = b->dst + (size_t)y * b->rowBytes;
+        int x = filterRowSIMD(b->src, b->rowBytes, c, out);
+
+        for (; x < b->rowBytes; ++x) {
+            int acc = WEIGHT_ONE / 2;
+
+            for (int k = 0; k < c->count; ++k)
+                acc += c->weights[k] * b->src[(size_t)(c->first + k) * b->rowBytes + x];
+            acc >>= WEIGHT_BITS;
+            out[x] = acc > 255 ? 255 : acc;
+        }
+    }
+}
+
+// scale the srcRows rows of src to dstRows, rows of rowBytes each
+static bool filterColumns(const GLubyte *src, int rowBytes, int srcRows,
+                          GLubyte *dst, int dstRows)
+{
+    resampleband bands[POOL_MAX_THREADS];
+    poolgroup group = {0};
+    contrib *rows = buildContribs(srcRows, dstRows);
+
+    if (rows == NULL)
+        return false;
+
+    int numBands = dstRows / RESAMPLE_BAND_ROWS;
+    if (numBands > poolThreads())
+        numBands = poolThreads();
+    if (numBands < 1)
+        numBands = 1;
+
+    for (int b = 0; b < numBands; ++b) {
+        bands[b].src      = src;
+        bands[b].dst      = dst;
+        bands[b].rowBytes = rowBytes;
+        bands[b].rows     = rows;
+        bands[b].y0       = dstRows * b / numBands;
+        bands[b].y1       = dstRows * (b + 1) / numBands;
+
+        if (numBands == 1)
+            filterBand(&bands[b]);
+        else
+            poolSubmitGroup(&group, filterBand, &bands[b]);
+    }
+    poolWaitGroup(&group);
+
+    free(rows);
+    return true;
+}
+
+// swap the rows and columns of a w x h image, in tiles to stay in cache
+static void transpose(const GLubyte *src, int w, int h, GLubyte *dst, int n)
+{
+    for (int ty = 0; ty < h; ty += 16)
+        for (int tx = 0; tx < w; tx += 16)
+            for (int y = ty; y < ty + 16 && y < h; ++y)
+                for (int x = tx; x < tx + 16 && x < w; ++x)
+                    for (int c = 0; c < n; ++c)
+                        dst[((size_t)x * h + y) * n + c] = src[((size_t)y * w + x) * n + c];
+}
+
+// scale src to dw x dh; both passes run down the columns so a whole row
+// is filtered at once, the image is turned on its side for the second
+bool resampleImage(const GLubyte *src, int sw, int sh,
+                   GLubyte *dst, int dw, int dh, int n)
+{
+    if (sw == dw) {
+        if (sh == dh) {
+            memcpy(dst, src, (size_t)sw * sh * n);
+            return true;
+        }
+        return filterColumns(src, sw * n, sh, dst, dh);
+    }
+
+    GLubyte *tall   = NULL;
+    GLubyte *side   = malloc((size_t)sw * dh * n);
+    GLubyte *scaled = malloc((size_t)dw * dh * n);
+    const GLubyte *rows = src;
+    bool ok = side != NULL && scaled != NULL;
+
+    if (ok && sh != dh) {
+        tall = malloc((size_t)sw * dh * n);
+        ok = tall != NULL && filterColumns(src, sw * n, sh, tall, dh);
+        rows = tall;
+    }
+
+    if (ok) {
+        transpose(rows, sw, dh, side, n);
+        ok = filterColumns(side, dh * n, sw, scaled, dw);
+    }
+    if (ok)
+        transpose(scaled, dh, dw, dst, n);
+
+    free(tall);
+    free(side);
+    free(scaled);
+    return ok;
+}
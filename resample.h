@@ -0,0 +1,38 @@
+#ifndef RESAMPLE_H
+    #define RESAMPLE_H
+
+    // make c++ friendly
+    #ifdef __cplusplus
+        extern "C" {
+    #endif
+
+    // OpenGL and GLUT headers
+    #ifdef __APPLE__
+        #include <GLUT/glut.h>
+    #else
+        #include <GL/gl.h>
+        #include <GL/glu.h>
+        #include <GL/glut.h>
+    #endif
+
+    #include <stdbool.h>
+
+    // a pass is split between workers in bands of at least this many rows
+    #define RESAMPLE_BAND_ROWS 32
+
+    // the size an w x h image is loaded at: scaled down to fit maxSize on
+    // its longer side if maxSize > 0, then each side to the nearest power
+    // of 2 if power2
+    void resampleSize(int w, int h, int maxSize, bool power2, int *dw, int *dh);
+
+    // scale the sw x sh src to dw x dh with a triangle filter, widened to
+    // average everything under a pixel when shrinking; n channels of bytes
+    // safe to call from a worker, false if out of memory
+    bool resampleImage(const GLubyte *src, int sw, int sh,
+                       GLubyte *dst, int dw, int dh, int n);
+
+    #ifdef __cplusplus
+        }
+    #endif
+
+#endif
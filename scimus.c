@@ -4,9 +4,9 @@
 #include <stdlib.h>
 #include <math.h>
 #include <ctype.h>
+#include <string.h>
 #include <stdbool.h>
 #include <unistd.h>
-#include <signal.h>
 
 // OpenGL and GLUT headers
 #ifdef __APPLE__
@@ -29,9 +29,47 @@
 // custom primative shapes
 #include "primatives.h"
 
-// frame cap
-// removed for c compat, uncomment in animate as well
-// #include "saveFrame.h"
+// static vertex buffers
+#include "meshBuffer.h"
+
+// shared tessellated shapes
+#include "meshCache.h"
+
+// background jobs
+#include "workerPool.h"
+
+// cooked textures with their mip chains
+#include "texCache.h"
+
+// pictures packed in a zip
+#include "zipArchive.h"
+
+// wall paintings packed in atlas pages
+#include "paintings.h"
+
+// finer levels streamed in under a memory budget
+#include "texStream.h"
+
+// sound mixed on its own thread
+#include "audioEngine.h"
+
+// shadowed GL state
+#include "glState.h"
+
+// sorted draw submission
+#include "renderQueue.h"
+
+// window-less rendering
+#include "offscreen.h"
+
+// scripted camera benchmark
+#include "benchmark.h"
+
+// per-stage frame timing
+#include "profiler.h"
+
+// frame capture
+#include "frameCapture.h"
 
 // prototypes and macros
 #include "scimus.h"
@@ -43,31 +81,113 @@ short debug = DEBUG;
 glpngtexture *pix[MAX_NUM_PIX];
 int           numPix;
 
+// a png being mapped from its cooked copy, or cooked, on a worker
+typedef struct {
+    char *name;
+    GLuint flags;           // how it is cooked, TEXCACHE_
+    cookedtexture cooked;
+    bool ok;                // false if it failed
+    char error[256];        // why it failed
+} pngjob;
+
+static pngjob pngJobs[MAX_NUM_PIX];
+static bool texturesPending = false;
+
+// cook textures to S3TC blocks
+bool compressTextures = false;
+
+// average mip levels as light rather than as stored values
+bool gammaMipmaps = true;
+
+// longest side a texture is loaded at, 0 for any
+int maxTextureSize = MAX_TEXTURE_SIZE;
+
+// load one texture, run on a worker
+static void cookPNG(void *arg)
+{
+    pngjob *job = arg;
+
+    job->ok = texCacheLoad(job->name, job->flags, maxTextureSize, &job->cooked,
+                           job->error, sizeof(job->error));
+}
+
 bool showTextures = false;
 
+// headless run, drawn offscreen for a fixed number of frames
+bool headless = false;
+int headlessWidth  = HEADLESS_WIDTH;
+int headlessHeight = HEADLESS_HEIGHT;
+int headlessFrames = HEADLESS_FRAMES;
+char *headlessOutput = NULL;  // ppm of the last frame, if any
+
+// camera path benchmark and where its JSON goes, stdout if NULL
+char *benchPath   = NULL;
+char *benchOutput = NULL;
+
+// stage timings are written here on quit, if set
+char *profileOutput = NULL;
+
 // full screen mode status
 bool gameMode = false;
 int gameWindowID;
 
-// status of screen cap
+// status of screen cap and where the frames go
 bool capture = false;
+char *capturePrefix = CAPTURE_PREFIX;
 
 // amount window is open
 bool glassIsOpening = false;
 GLdouble glassOpen  = 0;
 
-GLUquadric *quadric;
+// items skipped by the last frustum test
+int numCulled = 0;
+
+// view of the frame being drawn
+static viewfrustum frameView;
+
+// openings the outside shows through, set just behind the wall
+// surface so a picture covering the opening hides them
+static const portal portals[] = {
+    {{ { GLASS_WIDTH / -2.0, FLOOR_LEVEL + GLASS_ELEV,                ROOM_LENGTH / -2.0 - 1.0 },
+       { GLASS_WIDTH /  2.0, FLOOR_LEVEL + GLASS_ELEV,                ROOM_LENGTH / -2.0 - 1.0 },
+       { GLASS_WIDTH /  2.0, FLOOR_LEVEL + GLASS_ELEV + GLASS_HEIGHT, ROOM_LENGTH / -2.0 - 1.0 },
+       { GLASS_WIDTH / -2.0, FLOOR_LEVEL + GLASS_ELEV + GLASS_HEIGHT, ROOM_LENGTH / -2.0 - 1.0 } }},
+};
+
+#define NUM_PORTALS (int)(sizeof(portals) / sizeof(portals[0]))
+
+// samples of the portals left visible by the room
+GLuint portalQuery = 0;
+
+// baked room geometry
+glmesh *floorMesh   = NULL;
+glmesh *ceilingMesh = NULL;
+glmesh *wallMesh    = NULL;
+glmesh *pictureMesh = NULL;
 
 // animation variables
-bool animation = false; // are we currently animating
 bool frozen    = false; // is animation frozen
 float speedMultiplier = 1.0f;  // default speed
 
+// the last two simulation steps and the time into the next one;
+// the globals below are what is drawn, set between the two
+#define SCENE_START {                      \
+    .earthDist = 400.0,                    \
+    .mercuryDist = 300.0,                  \
+    .diskRot = {0.0, 90.0, 0.0, 120.0},    \
+    .teapotPouringForward = true,          \
+}
+static scenestate prevState = SCENE_START;
+static scenestate currState = SCENE_START;
+static double stepTime = 0.0;
+
 //sound variables
 bool soundPlayed = false;
 bool playPourSound = false;
 bool musicPlaying = false;
-int musicPID = -1;
+int pourSound  = -1;    // decoded sounds, -1 if missing
+int musicSound = -1;
+char *audioOutput = NULL;  // wav file the sound goes to instead of the card, if set
 
 
 // sculpture1
@@ -84,7 +204,6 @@ GLdouble diskRot[4] = {0.0, 90.0, 0.0, 120.0};
 // sculpture3
 bool showHelix = true;
 GLfloat teapotTiltAngle = 0.0f;
-bool teapotPouringForward = true;
 
 // sculpture4
 GLdouble pistHeight = 0.0;
@@ -104,22 +223,48 @@ int main(int nargs, char *args[])
         "images/ceiling_texture.png",
     };
 
-    // used for glu predefined shapes
-    quadric = gluNewQuadric();
-    gluQuadricOrientation(quadric, GLU_OUTSIDE);
-    gluQuadricNormals(quadric, GLU_SMOOTH);
+    // check for a headless run or benchmark
+    readOptions(nargs, args);
+    if (benchPath != NULL && !benchLoadPath(benchPath))
+        exit(USAGE_ERROR);
+
+    // a report on stdout is the only thing there, the rest goes to stderr
+    if (benchPath != NULL && benchOutput == NULL)
+        benchTakeStdout();
+    profEnable(profileOutput != NULL);
+
+    // sound goes to the card, or to a wav file; a headless run has no card
+    // and mixes on the frames' clock, so its recording is the same each run
+    audioStart(audioOutput != NULL ? AUDIO_SINK_WAV : headless ? AUDIO_SINK_NULL : AUDIO_SINK_DEFAULT,
+               audioOutput, headless);
+    if (!headless && audioOutput == NULL && AUDIO_SINK_DEFAULT == AUDIO_SINK_NULL)
+        fprintf(stderr, "Sound is off: built without ALSA, so the mix is dropped\n");
+    pourSound = audioLoad(POUR_SOUND);
+    if (access(MUSIC_SOUND, R_OK) == 0)
+        musicSound = audioLoad(MUSIC_SOUND);
+
+    // pictures not found on disk are read from the archive, if there is one
+    archiveOpen(ASSET_ARCHIVE);
+
+    // start decoding pictures/textures from file
+    loadTextures(2, p);
+    loadPaintings(PAINTINGS_FILE);
 
-    // initialize double helix
-    initDoubleHelix();
+    // initialize the display window, or an offscreen one
+    if (headless)
+        navInitHeadless(headlessWidth, headlessHeight);
+    else
+        navInit(nargs, args);
 
-    // load pictures/textures from file
-    loadTextures(2, p);
+    // bake the static room geometry
+    initRoom();
 
-    // initialize the display window
-    navInit(nargs, args);
+    // initialize double helix
+    initDoubleHelix();
 
-    // initialize our pictures/textures 
+    // upload our pictures/textures, decoded meanwhile
     initTextures();
+    initPaintings();
 
     // register glut call-backs 
     initCallBacks();
@@ -127,14 +272,129 @@ int main(int nargs, char *args[])
     // initialize scene lighting 
     initLighting();
 
-    // pass control to glut 
+    // recording from the first frame
+    if (capture)
+        capture = captureStart(capturePrefix);
+
+    // fly the benchmark path and leave
+    if (benchPath != NULL) {
+        if (headless) {
+            while (benchFrame())
+                ;
+            if (!benchReport(benchOutput))
+                exit(USAGE_ERROR);
+            cleanUpAndQuit();
+        }
+        // the timed frames are the only ones drawn
+        navDrivenFrames = true;
+        glutIdleFunc(benchIdle);
+    }
+
+    // draw the frames and leave, or pass control to glut
+    if (headless) {
+        navRunHeadless(headlessFrames);
+        if (headlessOutput != NULL && !offscreenSavePPM(headlessOutput))
+            exit(USAGE_ERROR);
+        printf("Drew %d frames at %dx%d\n", headlessFrames, headlessWidth, headlessHeight);
+        cleanUpAndQuit();
+    }
     glutMainLoop();
 
     // all went well 
     return 0;
 }
 
-// load textures from file 
+// read the headless run options
+//   -headless         draw offscreen, no window or glut
+//   -size WxH         framebuffer size
+//   -frames N         frames to draw before exiting
+//   -out file.ppm     save the last frame
+//   -bench path       fly a camera path and report frame times
+//   -bench-out file   write the report there instead of stdout
+//   -profile file     time each stage and write the history there on quit
+//   -capture prefix   record every frame to prefix_NNNNN.png
+//   -audio-out file.wav  mix the sound to a wav file instead of the card
+//   -compress-textures  cook textures to S3TC blocks
+//   -mip-filter f     box or gamma, how mip levels are averaged
+//   -max-texture N    longest side a texture is loaded at, 0 for any
+//   -texture-budget MB  texture memory the streamed painting levels may use
+// anything else is left for glut
+void readOptions(int nargs, char *args[])
+{
+    for (int i = 1; i < nargs; ++i) {
+        if (strcmp(args[i], "-headless") == 0)
+            headless = true;
+        else if (strcmp(args[i], "-size") == 0 && i + 1 < nargs) {
+            if (sscanf(args[++i], "%dx%d", &headlessWidth, &headlessHeight) != 2 ||
+                headlessWidth <= 0 || headlessHeight <= 0) {
+                fprintf(stderr, "Error: -size expects WIDTHxHEIGHT, got %s\n", args[i]);
+                exit(USAGE_ERROR);
+            }
+        }
+        else if (strcmp(args[i], "-frames") == 0 && i + 1 < nargs) {
+            headlessFrames = atoi(args[++i]);
+            if (headlessFrames <= 0) {
+                fprintf(stderr, "Error: -frames expects a positive count, got %s\n", args[i]);
+                exit(USAGE_ERROR);
+            }
+        }
+        else if (strcmp(args[i], "-out") == 0 && i + 1 < nargs)
+            headlessOutput = args[++i];
+        else if (strcmp(args[i], "-bench") == 0 && i + 1 < nargs)
+            benchPath = args[++i];
+        else if (strcmp(args[i], "-bench-out") == 0 && i + 1 < nargs)
+            benchOutput = args[++i];
+        else if (strcmp(args[i], "-profile") == 0 && i + 1 < nargs)
+            profileOutput = args[++i];
+        else if (strcmp(args[i], "-capture") == 0 && i + 1 < nargs) {
+            capturePrefix = args[++i];
+            capture = true;
+        }
+        else if (strcmp(args[i], "-audio-out") == 0 && i + 1 < nargs)
+            audioOutput = args[++i];
+        else if (strcmp(args[i], "-compress-textures") == 0)
+            compressTextures = true;
+        else if (strcmp(args[i], "-max-texture") == 0 && i + 1 < nargs) {
+            maxTextureSize = atoi(args[++i]);
+            if (maxTextureSize < 0) {
+                fprintf(stderr, "Error: -max-texture expects a size, got %s\n", args[i]);
+                exit(USAGE_ERROR);
+            }
+        }
+        else if (strcmp(args[i], "-texture-budget") == 0 && i + 1 < nargs) {
+            int megabytes = atoi(args[++i]);
+            if (megabytes <= 0) {
+                fprintf(stderr, "Error: -texture-budget expects megabytes, got %s\n", args[i]);
+                exit(USAGE_ERROR);
+            }
+            texStreamSetBudget((size_t)megabytes * 1024 * 1024);
+        }
+        else if (strcmp(args[i], "-mip-filter") == 0 && i + 1 < nargs) {
+            ++i;
+            if (strcmp(args[i], "box") == 0)
+                gammaMipmaps = false;
+            else if (strcmp(args[i], "gamma") == 0)
+                gammaMipmaps = true;
+            else {
+                fprintf(stderr, "Error: -mip-filter expects box or gamma, got %s\n", args[i]);
+                exit(USAGE_ERROR);
+            }
+        }
+    }
+}
+
+// fly the benchmark path one frame per idle call, report and quit at the end
+void benchIdle()
+{
+    if (!benchFrame()) {
+        if (!benchReport(benchOutput))
+            exit(USAGE_ERROR);
+        cleanUpAndQuit();
+    }
+}
+
+// start decoding textures from file on the worker pool
+// initTextures collects them
 void loadTextures(int count, char *picNames[])
 {
     int i;  // general use counter 
@@ -152,24 +412,89 @@ void loadTextures(int count, char *picNames[])
     for (i = 0; i < MAX_NUM_PIX; ++i)
         pix[i] = NULL;
 
-    // for each texture 
+    poolStart(0);
+
+    // for each texture, map or cook it on a worker
     for (i = 0; i < numPix; ++i) {
-        // use pngLoader to generate from png file 
-        pix[i] = genPNGTexture(picNames[i]);
-        printf("Loaded texture %d: %s (%dx%d)\n", i, picNames[i], pix[i]->width, pix[i]->height);
-
-        // file dimentions must be a power of 2 or we're done 
-        if ((!isPower2((pix[i])->width)) && (!isPower2((pix[i])->height))) {
-            fprintf(stderr, "Fatal Error:  Invalid image size:  %dX%d.  "
-            "Must be power of 2.", (pix[i]->width), (pix[i]->height));
-            exit(IMAGE_SIZE_ERROR);
+        pngJobs[i].name  = picNames[i];
+        pngJobs[i].flags = TEXCACHE_MIPMAPS |
+                           (gammaMipmaps ? TEXCACHE_GAMMA : 0) |
+                           (compressTextures ? TEXCACHE_COMPRESSED : 0);
+        pngJobs[i].ok    = false;
+        poolSubmit(cookPNG, &pngJobs[i]);
+    }
+    texturesPending = true;
+}
+
+// wait for the decodes started by loadTextures and check them,
+// reporting every file that failed before giving up
+void finishTextures()
+{
+    int failed = 0;
+    double saved = 0.0;     // bytes resampling kept out of texture memory
+    bool resized = false;
+
+    if (!texturesPending)
+        return;
+
+    poolWait();
+    texturesPending = false;
+
+    for (int i = 0; i < numPix; ++i) {
+        if (!pngJobs[i].ok) {
+            fprintf(stderr, "Error: texture %d: %s\n", i, pngJobs[i].error);
+            ++failed;
+            continue;
         }
+
+        // the texture as uploaded, its pixels stay in the cooked container
+        const texheader *h = pngJobs[i].cooked.header;
+        pix[i] = calloc(1, sizeof(glpngtexture));
+        if (pix[i] == NULL) {
+            fprintf(stderr, "Fatal Error:  Out of memory loading textures.\n");
+            exit(OUT_OF_MEM_ERROR);
+        }
+        pix[i]->width          = pngJobs[i].cooked.levels[0].width;
+        pix[i]->height         = pngJobs[i].cooked.levels[0].height;
+        pix[i]->format         = h->format;
+        pix[i]->internalFormat = h->components;
+        printf("Loaded texture %d: %s (%dx%d", i, pngJobs[i].name, h->srcWidth, h->srcHeight);
+        if (pix[i]->width != h->srcWidth || pix[i]->height != h->srcHeight)
+            printf(" -> %dx%d", pix[i]->width, pix[i]->height);
+        printf(", %d levels%s)\n", h->numLevels, pngJobs[i].cooked.cooked ? ", cooked" : "");
+
+        // what the image would have taken uploaded as it is, chain and all
+        double chain = h->numLevels > 1 ? 4.0 / 3.0 : 1.0;
+        saved += ((double)h->srcWidth * h->srcHeight - (double)pix[i]->width * pix[i]->height) *
+                 h->components * chain;
+        resized |= pix[i]->width != h->srcWidth || pix[i]->height != h->srcHeight;
+    }
+
+    if (resized)
+        printf("Resampling %s %.0f KB of texture memory\n", saved >= 0.0 ? "saved" : "added",
+               fabs(saved) / 1024.0);
+
+    if (failed > 0) {
+        fprintf(stderr, "Fatal Error:  %d of %d textures could not be loaded.\n", failed, numPix);
+        exit(IMAGE_LOAD_ERROR);
+    }
+}
+
+// load texture i again on this thread, exits on failure
+static void reloadTexture(int i)
+{
+    cookPNG(&pngJobs[i]);
+    if (!pngJobs[i].ok) {
+        fprintf(stderr, "Error: texture %d: %s\n", i, pngJobs[i].error);
+        exit(IMAGE_LOAD_ERROR);
     }
 }
 
 // generate OpenGL textures from the loaded images 
 void initTextures()
 {
+    // the decodes must be done before anything is uploaded
+    finishTextures();
     
     GLuint ids[MAX_NUM_PIX] = {0};  // array holding our texture id's
 
@@ -182,20 +507,30 @@ void initTextures()
         pix[i]->id = ids[i];
 
         // set texture properties and pixels 
-        glBindTexture(GL_TEXTURE_2D, pix[i]->id);
-        if (i == 0) {
+        glsBindTexture(GL_TEXTURE_2D, pix[i]->id);
+        if (pngJobs[i].flags & TEXCACHE_MIPMAPS) {
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-            gluBuild2DMipmaps(GL_TEXTURE_2D, pix[i]->internalFormat, pix[i]->width, pix[i]->height, pix[i]->format, GL_UNSIGNED_BYTE,pix[i]->texels);
-            continue; // skip glTexImage2D below
         }
         else {
             glTexParameteri(GL_TEXTURE_2D, GL_GENERATE_MIPMAP, GL_FALSE);
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
         }
-        glTexImage2D(GL_TEXTURE_2D, 0, pix[i]->internalFormat, pix[i]->width, pix[i]->height, 0, pix[i]->format, GL_UNSIGNED_BYTE, pix[i]->texels);
+
+        // a context made after the first upload maps the cooked copy again
+        if (pngJobs[i].cooked.data == NULL)
+            reloadTexture(i);
+
+        // the levels go up straight from the container, a GL without
+        // S3TC gets the texture cooked again uncompressed
+        if (!texCacheUpload(&pngJobs[i].cooked)) {
+            texCacheRelease(&pngJobs[i].cooked);
+            pngJobs[i].flags &= ~TEXCACHE_COMPRESSED;
+            reloadTexture(i);
+            texCacheUpload(&pngJobs[i].cooked);
+        }
+        texCacheRelease(&pngJobs[i].cooked);
     }
 }
 
@@ -231,13 +566,13 @@ void initLighting() {
     float linearAtt[8] = {0.0,  0.0001, 0.0001, 0.0001, 0.0001, 0.0001, 0.0001, 0.0001};
     float quadAtt[8]   = {0.0,  0.0000004, 0.0, 0.0, 0.0000005, 0.0000005, 0.0000005, 0.0000005};
 
-    glEnable(GL_LIGHTING);
+    glsEnable(GL_LIGHTING);
     glShadeModel(GL_SMOOTH);
     glLightModeli(GL_LIGHT_MODEL_LOCAL_VIEWER, GL_TRUE);
     glLightModelfv(GL_LIGHT_MODEL_AMBIENT, ambient);
 
     for (int i = 0; i < 8; ++i) {
-        glEnable(GL_LIGHT0 + i);
+        glsEnable(GL_LIGHT0 + i);
         glLightf(GL_LIGHT0 + i, GL_CONSTANT_ATTENUATION,  constAtt[i]);
         glLightf(GL_LIGHT0 + i, GL_LINEAR_ATTENUATION,    linearAtt[i]);
         glLightf(GL_LIGHT0 + i, GL_QUADRATIC_ATTENUATION, quadAtt[i]);
@@ -255,61 +590,248 @@ int isPower2(int x)
 
 void setMaterial(const GLfloat *ambient, const GLfloat *diffuse, const GLfloat *specular, GLfloat shininess)
 {
-    glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT,   ambient);
-    glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE,   diffuse);
-    glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR,  specular);
-    glMaterialf( GL_FRONT_AND_BACK, GL_SHININESS, shininess);
+    glsMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT,   ambient);
+    glsMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE,   diffuse);
+    glsMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR,  specular);
+    glsMaterialf( GL_FRONT_AND_BACK, GL_SHININESS, shininess);
+}
+
+// one entry point per wall for the drawables table
+static void drawRightWall() { drawWall(WALL_RIGHT); }
+static void drawLeftWall()  { drawWall(WALL_LEFT);  }
+static void drawNearWall()  { drawWall(WALL_NEAR);  }
+static void drawFarWall()   { drawWall(WALL_FAR);   }
+
+// materials, used to keep items that share one together in the queue
+enum {
+    MAT_FLOOR, MAT_CEILING, MAT_WALL, MAT_OUTSIDE, MAT_SOLAR, MAT_TORI,
+    MAT_GOLD, MAT_METAL, MAT_BLOCK, MAT_HELIX, MAT_FRAME, MAT_GLASS
+};
+
+// everything draw() submits, with its pass, material and world-space bounds
+// sculpture boxes cover their full range of motion
+static const drawable drawables[] = {
+    { "drawFloor", drawFloor,                   RQ_PASS_OPAQUE, MAT_FLOOR, ANIM_NONE,
+      { ROOM_WIDTH / -2.0, FLOOR_LEVEL, ROOM_LENGTH / -2.0 },
+      { ROOM_WIDTH /  2.0, FLOOR_LEVEL, ROOM_LENGTH /  2.0 } },
+    { "drawCeiling", drawCeiling,               RQ_PASS_OPAQUE, MAT_CEILING, ANIM_NONE,
+      { ROOM_WIDTH / -2.0, FLOOR_LEVEL + ROOM_HEIGHT, ROOM_LENGTH / -2.0 },
+      { ROOM_WIDTH /  2.0, FLOOR_LEVEL + ROOM_HEIGHT, ROOM_LENGTH /  2.0 } },
+    { "drawRightWall", drawRightWall,           RQ_PASS_OPAQUE, MAT_WALL, ANIM_NONE,
+      { ROOM_WIDTH /  2.0, FLOOR_LEVEL, ROOM_LENGTH / -2.0 },
+      { ROOM_WIDTH /  2.0, FLOOR_LEVEL + ROOM_HEIGHT, ROOM_LENGTH /  2.0 } },
+    { "drawLeftWall", drawLeftWall,             RQ_PASS_OPAQUE, MAT_WALL, ANIM_NONE,
+      { ROOM_WIDTH / -2.0, FLOOR_LEVEL, ROOM_LENGTH / -2.0 },
+      { ROOM_WIDTH / -2.0, FLOOR_LEVEL + ROOM_HEIGHT, ROOM_LENGTH /  2.0 } },
+    { "drawNearWall", drawNearWall,             RQ_PASS_OPAQUE, MAT_WALL, ANIM_NONE,
+      { ROOM_WIDTH / -2.0, FLOOR_LEVEL, ROOM_LENGTH /  2.0 },
+      { ROOM_WIDTH /  2.0, FLOOR_LEVEL + ROOM_HEIGHT, ROOM_LENGTH /  2.0 } },
+    { "drawFarWall", drawFarWall,               RQ_PASS_OPAQUE, MAT_WALL, ANIM_NONE,
+      { ROOM_WIDTH / -2.0, FLOOR_LEVEL, ROOM_LENGTH / -2.0 },
+      { ROOM_WIDTH /  2.0, FLOOR_LEVEL + ROOM_HEIGHT, ROOM_LENGTH / -2.0 } },
+
+    // outside world, after the room so the portal test sees its depth
+    { "drawThroughPortals", drawThroughPortals, RQ_PASS_BACKGROUND, MAT_OUTSIDE, ANIM_NONE,
+      { OUTSIDE_WIDTH / -2.0, 2.0 * FLOOR_LEVEL, ROOM_LENGTH / -2.0 - OUTSIDE_LENGTH },
+      { OUTSIDE_WIDTH /  2.0, 2.0 * FLOOR_LEVEL + OUTSIDE_HEIGHT, ROOM_LENGTH / -2.0 } },
+
+    // solar system, the earth's orbit reaches 1400 from the sun and the
+    // moon 1400 + 75 + its radius of 10 = 1485
+    { "drawSculpture1", drawSculpture1, RQ_PASS_OPAQUE, MAT_SOLAR, ANIM_ALWAYS,
+      { ROOM_WIDTH / 2.0 - 768.0 - 1500.0, FLOOR_LEVEL, ROOM_LENGTH / 2.0 - 2.0 * ROOM_LENGTH / 5.0 - 1500.0 },
+      { ROOM_WIDTH / 2.0 - 768.0 + 1500.0, 256.0,       ROOM_LENGTH / 2.0 - 2.0 * ROOM_LENGTH / 5.0 + 1500.0 } },
+
+    // tori and supports
+    { "drawSculpture2", drawSculpture2, RQ_PASS_OPAQUE, MAT_TORI, ANIM_ALWAYS,
+      { ROOM_WIDTH / -2.0 + 512.0 - 256.0, FLOOR_LEVEL, ROOM_LENGTH / 2.0 - 2.0 * ROOM_LENGTH / 8.0 - 256.0 },
+      { ROOM_WIDTH / -2.0 + 512.0 + 256.0, 256.0,       ROOM_LENGTH / 2.0 - 2.0 * ROOM_LENGTH / 8.0 + 256.0 } },
+
+    // teapot on its stand
+    { "drawSculpture3", drawSculpture3, RQ_PASS_OPAQUE, MAT_GOLD, ANIM_ALWAYS,
+      { ROOM_WIDTH / -2.0 + 512.0 - 256.0, FLOOR_LEVEL, ROOM_LENGTH / 2.0 - 4.0 * ROOM_LENGTH / 8.0 - 256.0 },
+      { ROOM_WIDTH / -2.0 + 512.0 + 256.0, 256.0,       ROOM_LENGTH / 2.0 - 4.0 * ROOM_LENGTH / 8.0 + 256.0 } },
+
+    // piston and crank, then the glass block around them
+    { "drawSculpture4", drawSculpture4, RQ_PASS_OPAQUE, MAT_METAL, ANIM_ALWAYS,
+      { ROOM_WIDTH / 2.0 - 512.0 - 270.0, FLOOR_LEVEL, ROOM_LENGTH / 2.0 - 3.0 * ROOM_LENGTH / 5.0 - 270.0 },
+      { ROOM_WIDTH / 2.0 - 512.0 + 520.0, 480.0,       ROOM_LENGTH / 2.0 - 3.0 * ROOM_LENGTH / 5.0 + 270.0 } },
+    { "drawSculpture4Block", drawSculpture4Block, RQ_PASS_TRANSLUCENT, MAT_BLOCK, ANIM_NONE,
+      { ROOM_WIDTH / 2.0 - 512.0 - 260.0, FLOOR_LEVEL, ROOM_LENGTH / 2.0 - 3.0 * ROOM_LENGTH / 5.0 - 260.0 },
+      { ROOM_WIDTH / 2.0 - 512.0 + 260.0, FLOOR_LEVEL + 670.0, ROOM_LENGTH / 2.0 - 3.0 * ROOM_LENGTH / 5.0 + 260.0 } },
+
+    // double helix, bounds of helix.dat after its rotation and scale
+    { "drawSculpture5", drawSculpture5, RQ_PASS_TRANSLUCENT, MAT_HELIX, ANIM_NONE,
+      { ROOM_WIDTH / -2.0 + 512.0 - 360.0, -720.0, ROOM_LENGTH / 2.0 - 6.0 * ROOM_LENGTH / 8.0 - 440.0 },
+      { ROOM_WIDTH / -2.0 + 512.0 + 360.0,  720.0, ROOM_LENGTH / 2.0 - 6.0 * ROOM_LENGTH / 8.0 + 440.0 } },
+
+    // the window frame and its sliding pane
+    { "drawGlassFrame", drawGlassFrame, RQ_PASS_OPAQUE, MAT_FRAME, ANIM_NONE,
+      { GLASS_WIDTH / -2.0, FLOOR_LEVEL + GLASS_ELEV, ROOM_LENGTH / -2.0 - 50.0 },
+      { GLASS_WIDTH /  2.0, FLOOR_LEVEL + GLASS_ELEV + GLASS_HEIGHT, ROOM_LENGTH / -2.0 } },
+    { "drawGlassPane", drawGlassPane, RQ_PASS_TRANSLUCENT, MAT_GLASS, ANIM_GLASS,
+      { GLASS_WIDTH / -2.0, FLOOR_LEVEL + GLASS_ELEV, ROOM_LENGTH / -2.0 - 50.0 },
+      { GLASS_WIDTH /  2.0, FLOOR_LEVEL + GLASS_ELEV + GLASS_HEIGHT, ROOM_LENGTH / -2.0 - 50.0 } },
+};
+
+#define NUM_DRAWABLES (int)(sizeof(drawables) / sizeof(drawables[0]))
+
+// does an item with this animation move in the current step
+static bool animMoving(int anim)
+{
+    switch (anim) {
+        case ANIM_ALWAYS:
+            return true;
+        case ANIM_GLASS:
+            // the step after 'w' hasn't moved the pane yet, so also
+            // keep going until it reaches the end it is heading for
+            return prevState.glassOpen != currState.glassOpen ||
+                   currState.glassOpen != (glassIsOpening ? -GLASS_WIDTH : 0.0);
+        default:
+            return false;
+    }
 }
 
 // draw to the display
+// anything whose bounds fall outside the view frustum is skipped,
+// the rest is queued by pass, depth and material and drawn in order
 void draw()
 {
+    bool anyMoving = false;
+
+    // move the sculptures up to this frame
+    if (!frozen) {
+        profBegin("animate");
+        animate(navFrameMs());
+    }
+
+    // a stepped mix keeps up with the frames, sounds started above included
+    audioAdvance(navFrameMs());
+
     // place lighting in the scene
+    profBegin("placeLights");
     placeLights();
 
-    // draw the floor
-    drawFloor();
+    profBegin("cull");
+    navGetFrustum(&frameView);
+    numCulled = 0;
+    glsResetStats();
 
-    // draw the ceiling
-    drawCeiling();
+    rqClear();
+    for (int i = 0; i < NUM_DRAWABLES; ++i) {
+        const drawable *d = &drawables[i];
 
-    // draw the walls
-    drawWalls();
+        if (frustumCullsBox(&frameView, d->min, d->max)) {
+            ++numCulled;
+            continue;
+        }
 
-    // draw the outside world
-    drawOutside();
+        // only animation that can be seen asks for another frame
+        anyMoving = anyMoving || (!frozen && animMoving(d->anim));
 
-    drawSculpture1();
-    drawSculpture2();
-    drawSculpture3();
-    drawSculpture4();
-    drawSculpture5();
+        GLdouble center[3] = { (d->min[0] + d->max[0]) / 2.0,
+                               (d->min[1] + d->max[1]) / 2.0,
+                               (d->min[2] + d->max[2]) / 2.0 };
+        rqSubmit(d->pass, d->material, frustumDepth(&frameView, center), d->draw, d->name);
+    }
 
-    // draw the window
-    drawGlass();
+    // finer levels for the paintings close up, another frame while they arrive
+    if (showTextures) {
+        GLint viewport[4];
 
-    if (!animation && !frozen)
-        animate(1);
-    
+        profBegin("stream");
+        navGetViewport(viewport);
+        if (updatePaintings(&frameView, viewport))
+            navMarkDirty(DIRTY_TEXTURES);
+    }
+    rqFlush();
+
+    if (capture)
+        captureFrame();
+
+    if (debug > 0) {
+        printf("drawn for%s%s%s%s%s%s\n",
+               (navDirtyReasons() & DIRTY_CAMERA)    ? " camera"    : "",
+               (navDirtyReasons() & DIRTY_ANIMATION) ? " animation" : "",
+               (navDirtyReasons() & DIRTY_LIGHTS)    ? " lights"    : "",
+               (navDirtyReasons() & DIRTY_TEXTURES)  ? " textures"  : "",
+               (navDirtyReasons() & DIRTY_WINDOW)    ? " window"    : "",
+               (navDirtyReasons() & DIRTY_SCENE)     ? " scene"     : "");
+
+        glsstats stats;
+        glsGetStats(&stats);
+        printf("culled %d of %d items, filtered %lu of %lu state changes\n",
+               numCulled, NUM_DRAWABLES, stats.filtered, stats.calls);
+        texStreamPrintStats(stdout);
+    }
+
+    // keep drawing while anything on screen moves, or every frame is recorded
+    if (anyMoving)
+        navMarkDirty(DIRTY_ANIMATION);
+    if (capture)
+        navMarkDirty(DIRTY_SCENE);
 }
 
-// perform timed scene animation
-void animate(int i)
+
+// advance the animation ms, in fixed steps of ANI_RATE so it runs
+// the same at any frame rate, and draw the scene part way into a step
+void animate(double ms)
 {
-    
+    int steps = 0;
 
-    if (!frozen) {
-        animation = true;
-        updateSculpture1();
-        updateSculpture2();
-        updateSculpture3();
-        updateSculpture4();
-        openGlass();
-        glutPostRedisplay();
-        glutTimerFunc(ANI_RATE, animate, 1);
+    for (stepTime += ms; stepTime >= ANI_RATE; stepTime -= ANI_RATE) {
+        if (++steps > MAX_ANI_STEPS) {
+            stepTime = 0.0;
+            break;
+        }
+
+        prevState = currState;
+        updateSculpture1(&currState);
+        updateSculpture2(&currState);
+        updateSculpture3(&currState);
+        updateSculpture4(&currState);
+        openGlass(&currState);
     }
-    else
-        animation = false;
+
+    interpolateScene(stepTime / ANI_RATE);
+}
+
+// go from angle a to b the short way round a turn of period
+static GLdouble lerpAngle(GLdouble a, GLdouble b, GLdouble t, GLdouble period)
+{
+    GLdouble d = fmod(b - a, period);
+
+    if (d > period / 2.0)
+        d -= period;
+    else if (d < period / -2.0)
+        d += period;
+    return a + d * t;
+}
+
+// set the drawn values t of the way from the previous step to the current
+void interpolateScene(double t)
+{
+    const scenestate *a = &prevState;
+    const scenestate *b = &currState;
+
+    earthTheta   = lerpAngle(a->earthTheta, b->earthTheta, t, 2.0 * M_PI);
+    earthDist    = a->earthDist + (b->earthDist - a->earthDist) * t;
+    moonTheta    = lerpAngle(a->moonTheta, b->moonTheta, t, 2.0 * M_PI);
+    mercuryTheta = lerpAngle(a->mercuryTheta, b->mercuryTheta, t, 2.0 * M_PI);
+    mercuryDist  = a->mercuryDist + (b->mercuryDist - a->mercuryDist) * t;
+
+    for (int i = 0; i < 4; ++i)
+        diskRot[i] = lerpAngle(a->diskRot[i], b->diskRot[i], t, 360.0);
+
+    teapotTiltAngle = a->teapotTiltAngle + (b->teapotTiltAngle - a->teapotTiltAngle) * t;
+
+    // the piston follows the crank it's drawn with
+    crankTheta = lerpAngle(a->crankTheta, b->crankTheta, t, 2.0 * M_PI);
+    crankTheta = fmod(crankTheta + 2.0 * M_PI, 2.0 * M_PI);
+    showBurn   = crankTheta < (90.0 * (M_PI / 180.0));
+    pistHeight = crankRadius * cos(crankTheta) +
+                 sqrt(rodLength * rodLength - crankRadius * crankRadius * sin(crankTheta) * sin(crankTheta));
+
+    glassOpen = a->glassOpen + (b->glassOpen - a->glassOpen) * t;
 }
 
 // place lights in the scene
@@ -337,6 +859,169 @@ void placeLights()
      glLightfv(GL_LIGHT0, GL_SPOT_DIRECTION, spotdir0);
  }
 
+// bake a grid of TILE_RES wall panels into mesh m
+// origin is the lower left corner of the wall, u runs along the
+// floor and n is the wall normal; panels i0..i1 by j0..j1 are emitted
+static void bakePanels(glmesh *m, const GLfloat origin[3], const GLfloat u[3], const GLfloat n[3],
+                       int i0, int i1, int j0, int j1)
+{
+    int    i, j;
+    int    cols = i1 - i0 + 1;
+    GLuint base = m->numVerts;
+
+    for (j = j0; j <= j1; ++j) {
+        for (i = i0; i <= i1; ++i) {
+            meshAddVertex(m,
+                          origin[0] + u[0] * i * TILE_RES,
+                          origin[1] + j * TILE_RES,
+                          origin[2] + u[2] * i * TILE_RES,
+                          n[0], n[1], n[2], 0.0, 0.0);
+        }
+    }
+
+    for (j = 0; j < j1 - j0; ++j) {
+        for (i = 0; i < i1 - i0; ++i) {
+            GLuint k = base + j * cols + i;
+            meshAddTriangle(m, k, k + 1, k + cols + 1);
+            meshAddTriangle(m, k, k + cols + 1, k + cols);
+        }
+    }
+}
+
+// bake the floor, ceiling and walls into static buffers
+// the room never changes, so this only runs when a context is created
+void initRoom()
+{
+    int i, j, x, z, material;
+
+    int tilesX = ROOM_WIDTH / 512;
+    int tilesZ = ROOM_LENGTH / 512;
+    int cols   = ROOM_WIDTH / TILE_RES + 1;
+
+    // drop buffers baked before
+    freeRoom();
+
+    // query object for the portal test
+    glGenQueries(1, &portalQuery);
+
+    // floor: one shared vertex grid, one triangle per TILE_RES cell,
+    // with the tiles grouped by material so each set is a single draw
+    floorMesh = genMesh();
+    for (j = 0; j <= ROOM_LENGTH / TILE_RES; ++j) {
+        for (i = 0; i <= ROOM_WIDTH / TILE_RES; ++i) {
+            meshAddVertex(floorMesh,
+                          (ROOM_WIDTH / -2.0) + i * TILE_RES,
+                          FLOOR_LEVEL,
+                          (ROOM_LENGTH / 2.0) - j * TILE_RES,
+                          0.0, 1.0, 0.0, 0.0, 0.0);
+        }
+    }
+
+    for (material = 0; material < 2; ++material) {
+        meshBeginGroup(floorMesh);
+        for (x = 0; x < tilesX; ++x) {
+            for (z = 0; z < tilesZ; ++z) {
+                if ((x + z) % 2 != material)
+                    continue;
+
+                for (i = x * 512 / TILE_RES; i < (x + 1) * 512 / TILE_RES; ++i) {
+                    for (j = z * 512 / TILE_RES; j < (z + 1) * 512 / TILE_RES; ++j) {
+                        GLuint k = j * cols + i;
+                        meshAddTriangle(floorMesh, k, k + 1, k + cols);
+                    }
+                }
+            }
+        }
+    }
+    meshUpload(floorMesh);
+
+    // ceiling: one textured quad per 512 tile
+    ceilingMesh = genMesh();
+    for (x = 0; x < tilesX; ++x) {
+        for (z = 0; z < tilesZ; ++z) {
+            GLfloat x0 = (ROOM_WIDTH / -2.0) + x * 512;
+            GLfloat z0 = (ROOM_LENGTH / -2.0) + z * 512;
+            GLfloat y  = ROOM_HEIGHT + FLOOR_LEVEL;
+
+            GLuint k = meshAddVertex(ceilingMesh, x0,       y, z0,       0.0, -1.0, 0.0, 0.0, 0.0);
+            meshAddVertex(ceilingMesh,            x0 + 512, y, z0,       0.0, -1.0, 0.0, 1.0, 0.0);
+            meshAddVertex(ceilingMesh,            x0 + 512, y, z0 + 512, 0.0, -1.0, 0.0, 1.0, 1.0);
+            meshAddVertex(ceilingMesh,            x0,       y, z0 + 512, 0.0, -1.0, 0.0, 0.0, 1.0);
+
+            meshAddTriangle(ceilingMesh, k, k + 1, k + 3);
+            meshAddTriangle(ceilingMesh, k + 1, k + 2, k + 3);
+        }
+    }
+    meshUpload(ceilingMesh);
+
+    // walls: one group per wall, the far wall is cut around the window
+    {
+        const GLfloat rightO[3] = {ROOM_WIDTH / 2.0,  FLOOR_LEVEL, ROOM_LENGTH / -2.0};
+        const GLfloat rightU[3] = {0.0, 0.0,  1.0};
+        const GLfloat rightN[3] = {-1.0, 0.0, 0.0};
+
+        const GLfloat leftO[3]  = {ROOM_WIDTH / -2.0, FLOOR_LEVEL, ROOM_LENGTH / 2.0};
+        const GLfloat leftU[3]  = {0.0, 0.0, -1.0};
+        const GLfloat leftN[3]  = {1.0, 0.0, 0.0};
+
+        const GLfloat nearO[3]  = {ROOM_WIDTH / 2.0,  FLOOR_LEVEL, ROOM_LENGTH / 2.0};
+        const GLfloat nearU[3]  = {-1.0, 0.0, 0.0};
+        const GLfloat nearN[3]  = {0.0, 0.0, -1.0};
+
+        const GLfloat farO[3]   = {ROOM_WIDTH / -2.0, FLOOR_LEVEL, ROOM_LENGTH / -2.0};
+        const GLfloat farU[3]   = {1.0, 0.0, 0.0};
+        const GLfloat farN[3]   = {0.0, 0.0, 1.0};
+
+        int winLeft   = (ROOM_WIDTH/TILE_RES/2) - (GLASS_WIDTH/TILE_RES/2);
+        int winRight  = (ROOM_WIDTH/TILE_RES/2) + (GLASS_WIDTH/TILE_RES/2);
+        int winBottom = GLASS_ELEV / TILE_RES;
+        int winTop    = (GLASS_ELEV + GLASS_HEIGHT) / TILE_RES;
+
+        wallMesh = genMesh();
+
+        meshBeginGroup(wallMesh);
+        bakePanels(wallMesh, rightO, rightU, rightN, 0, ROOM_LENGTH/TILE_RES, 0, ROOM_HEIGHT/TILE_RES);
+
+        meshBeginGroup(wallMesh);
+        bakePanels(wallMesh, leftO, leftU, leftN, 0, ROOM_LENGTH/TILE_RES, 0, ROOM_HEIGHT/TILE_RES);
+
+        meshBeginGroup(wallMesh);
+        bakePanels(wallMesh, nearO, nearU, nearN, 0, ROOM_WIDTH/TILE_RES, 0, ROOM_HEIGHT/TILE_RES);
+
+        meshBeginGroup(wallMesh);
+        bakePanels(wallMesh, farO, farU, farN, 0, winLeft, 0, ROOM_HEIGHT/TILE_RES);
+        bakePanels(wallMesh, farO, farU, farN, winLeft, winRight, winTop, ROOM_HEIGHT/TILE_RES);
+        bakePanels(wallMesh, farO, farU, farN, winRight, ROOM_WIDTH/TILE_RES, 0, ROOM_HEIGHT/TILE_RES);
+        bakePanels(wallMesh, farO, farU, farN, winLeft, winRight, 0, winBottom);
+
+        meshUpload(wallMesh);
+    }
+
+    // picture covering the far wall when textures are on
+    pictureMesh = genMesh();
+    meshAddVertex(pictureMesh, ROOM_WIDTH / -2.0, FLOOR_LEVEL,               ROOM_LENGTH / -2.0, 0.0, 0.0, 1.0, 0.0, 0.0);
+    meshAddVertex(pictureMesh, ROOM_WIDTH / 2.0,  FLOOR_LEVEL,               ROOM_LENGTH / -2.0, 0.0, 0.0, 1.0, 1.0, 0.0);
+    meshAddVertex(pictureMesh, ROOM_WIDTH / 2.0,  FLOOR_LEVEL + ROOM_HEIGHT, ROOM_LENGTH / -2.0, 0.0, 0.0, 1.0, 1.0, 1.0);
+    meshAddVertex(pictureMesh, ROOM_WIDTH / -2.0, FLOOR_LEVEL + ROOM_HEIGHT, ROOM_LENGTH / -2.0, 0.0, 0.0, 1.0, 0.0, 1.0);
+    meshAddTriangle(pictureMesh, 0, 1, 2);
+    meshAddTriangle(pictureMesh, 0, 2, 3);
+    meshUpload(pictureMesh);
+}
+
+// release the baked room and the portal query, while their context is current
+void freeRoom()
+{
+    meshFree(floorMesh);
+    meshFree(ceilingMesh);
+    meshFree(wallMesh);
+    meshFree(pictureMesh);
+    floorMesh = ceilingMesh = wallMesh = pictureMesh = NULL;
+
+    if (portalQuery)
+        glDeleteQueries(1, &portalQuery);
+    portalQuery = 0;
+}
+
 // draw a tiled floor in the scene
 void drawFloor()
 {
@@ -349,50 +1034,27 @@ void drawFloor()
     const GLfloat materialSet2_D[4] = {0.1, 0.1, 0.6, 1.0};   // Diffuse
     const GLfloat materialSet2_S[4] = {0.2, 0.2, 0.8, 1.0};   // Specular
 
-    glMatrixMode(GL_MODELVIEW);
-    glPushMatrix();
-        glRotated(180.0, 1.0, 0.0, 0.0);
-        glTranslated(-ROOM_WIDTH / 2.0, -FLOOR_LEVEL, -ROOM_LENGTH / 2.0);
-
-        int tilesX = ROOM_WIDTH / 512;
-        int tilesZ = ROOM_LENGTH / 512;
-
-        for (int x = 0; x < tilesX; ++x) {
-            for (int z = 0; z < tilesZ; ++z) {
+    if (debug > 0) {
+        glMatrixMode(GL_MODELVIEW);
+        glPushMatrix();
+            glRotated(180.0, 1.0, 0.0, 0.0);
+            glTranslated(-ROOM_WIDTH / 2.0, -FLOOR_LEVEL, -ROOM_LENGTH / 2.0);
 
-                if (debug > 0) {
+            for (int x = 0; x < ROOM_WIDTH / 512; ++x) {
+                for (int z = 0; z < ROOM_LENGTH / 512; ++z) {
                     char debugLabel[16];
                     sprintf(debugLabel, "(%d,%d)", x, z);
                     drawText(x * 512, 0, z * 512, debugLabel);
                 }
+            }
+        glPopMatrix();
+    }
 
-                if ((x + z) % 2 == 0) {
-                    glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT,   materialSet1_A);
-                    glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE,   materialSet1_D);
-                    glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR,  materialSet1_S);
-                } else {
-                    glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT,   materialSet2_A);
-                    glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE,   materialSet2_D);
-                    glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR,  materialSet2_S);
-                }
-
-                glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 100.0f);
-
-                for (int i = x * 512 / TILE_RES; i < (x + 1) * 512 / TILE_RES; ++i) {
-                    for (int j = z * 512 / TILE_RES; j < (z + 1) * 512 / TILE_RES; ++j) {
-                        glBegin(GL_TRIANGLES);
-                            glNormal3f(0.0, -1.0, 0.0);
+    setMaterial(materialSet1_A, materialSet1_D, materialSet1_S, 100.0f);
+    meshDrawGroup(floorMesh, 0);
 
-                            // Define 1 triangle per tile — half of a square
-                            glVertex3i(i * TILE_RES,       0, j * TILE_RES);
-                            glVertex3i((i + 1) * TILE_RES, 0, j * TILE_RES);
-                            glVertex3i(i * TILE_RES,       0, (j + 1) * TILE_RES);
-                        glEnd();
-                    }
-                }
-            }
-        }
-    glPopMatrix();
+    setMaterial(materialSet2_A, materialSet2_D, materialSet2_S, 100.0f);
+    meshDrawGroup(floorMesh, 1);
 }
 
 // draw a textured ceiling in the scene
@@ -402,223 +1064,74 @@ void drawCeiling()
     const GLfloat ceilingMatD[4] = {0.7, 0.4, 0.8, 1.0};
     const GLfloat ceilingMatS[4] = {0.1, 0.1, 0.1, 1.0};
 
-    glMatrixMode(GL_MODELVIEW);
-    glPushMatrix();
-        glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT,   ceilingMatA);
-        glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE,   ceilingMatD);
-        glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR,  ceilingMatS);
-        glMaterialf( GL_FRONT_AND_BACK, GL_SHININESS, 100.0f);
-
-        glTranslated(-ROOM_WIDTH / 2.0, ROOM_HEIGHT + FLOOR_LEVEL, -ROOM_LENGTH / 2.0);
-
-        int tilesX = ROOM_WIDTH / 512;
-        int tilesZ = ROOM_LENGTH / 512;
+    setMaterial(ceilingMatA, ceilingMatD, ceilingMatS, 100.0f);
 
-        for (int x = 0; x < tilesX; ++x) {
-            for (int z = 0; z < tilesZ; ++z) {
-                if (showTextures)
-                    glEnable(GL_TEXTURE_2D);
-
-                glBindTexture(GL_TEXTURE_2D, pix[numPix - 1]->id);
+    if (showTextures)
+        glsEnable(GL_TEXTURE_2D);
 
-                glBegin(GL_QUADS);
-                    glTexCoord2i(0, 0); glNormal3f(0.0, -1.0, 0.0); glVertex3i(x * 512,     0, z * 512);
-                    glTexCoord2i(1, 0); glNormal3f(0.0, -1.0, 0.0); glVertex3i((x + 1) * 512, 0, z * 512);
-                    glTexCoord2i(1, 1); glNormal3f(0.0, -1.0, 0.0); glVertex3i((x + 1) * 512, 0, (z + 1) * 512);
-                    glTexCoord2i(0, 1); glNormal3f(0.0, -1.0, 0.0); glVertex3i(x * 512,     0, (z + 1) * 512);
-                glEnd();
+    glsBindTexture(GL_TEXTURE_2D, pix[numPix - 1]->id);
+    meshDraw(ceilingMesh);
 
-                if (showTextures)
-                    glDisable(GL_TEXTURE_2D);
-            }
-        }
-    glPopMatrix();
+    if (showTextures)
+        glsDisable(GL_TEXTURE_2D);
 }
 
 // draw walls in the scene
 void drawWalls()
 {
-    int i, j;
+    for (int i = 0; i < NUM_WALLS; ++i)
+        drawWall(i);
+}
+
+// the way the paintings on each wall face, into the room
+static const int wallFacing[NUM_WALLS] = {
+    [WALL_RIGHT] = FACING_NEG_X,
+    [WALL_LEFT]  = FACING_POS_X,
+    [WALL_NEAR]  = FACING_NEG_Z,
+    [WALL_FAR]   = FACING_POS_Z,
+};
 
+// draw one wall of the room
+void drawWall(int wall)
+{
     // material properties
     GLfloat const colorA[4] = {0.0, 0.0, 0.4, 1.0}; // Ambient
     GLfloat const colorD[4] = {0.0, 0.0, 0.6, 1.0}; // Diffuse
     GLfloat const colorS[4] = {0.0, 0.0, 0.8, 1.0}; // Specular
-    
-    glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT,   colorA);
-    glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE,   colorD);
-    glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR,  colorS);
-    glMaterialf( GL_FRONT_AND_BACK, GL_SHININESS, 100.0f);
-
-    // draw right wall
-    glMatrixMode(GL_MODELVIEW);
-    glPushMatrix();
-    // rotate to face wall
-    glRotated(-90.0, 0.0, 1.0, 0.0);
-    // move to lower left corner
-    glTranslated(ROOM_LENGTH/-2.0, FLOOR_LEVEL, ROOM_WIDTH/-2.0);
-    // draw wall panels
-    for (i = 0; i < ROOM_LENGTH/TILE_RES; ++i) {
-        glBegin(GL_QUAD_STRIP);
-        for(j = 0; j <= ROOM_HEIGHT/TILE_RES; ++j) {
-            glNormal3f(0.0, 0.0, 1.0);
-            glVertex3i( i   *TILE_RES, j*TILE_RES, 0);
-            glNormal3f(0.0, 0.0, 1.0);
-            glVertex3i((i+1)*TILE_RES, j*TILE_RES, 0);
-        }
-        glEnd();
-    }
-    glPopMatrix();
-
-    // draw left wall
-    glMatrixMode(GL_MODELVIEW);
-    glPushMatrix();
 
-    // rotate to face wall
-    glRotated(90.0, 0.0, 1.0, 0.0);
-
-    // move to lower left corner
-    glTranslated(ROOM_LENGTH/-2.0, FLOOR_LEVEL, ROOM_WIDTH/-2.0);
-
-    // draw wall panels
-    for (i = 0; i < ROOM_LENGTH/TILE_RES; ++i) {
-        glBegin(GL_QUAD_STRIP);
-        for(j = 0; j <= ROOM_HEIGHT/TILE_RES; ++j) {
-            glNormal3f(0.0, 0.0, 1.0);
-            glVertex3i( i   *TILE_RES, j*TILE_RES, 0);
-            glNormal3f(0.0, 0.0, 1.0);
-            glVertex3i((i+1)*TILE_RES, j*TILE_RES, 0);
-        }
-        glEnd();
-    }
-    glPopMatrix();
-
-    // draw near wall
-    glMatrixMode(GL_MODELVIEW);
-    glPushMatrix();
-
-    // rotate to face wall
-    glRotated(180.0, 0.0, 1.0, 0.0);
-
-    // move to lower left corner
-    glTranslated(ROOM_WIDTH/-2.0, FLOOR_LEVEL, ROOM_LENGTH/-2.0);
-
-    // draw wall panels
-    for (i = 0; i < ROOM_WIDTH/TILE_RES; ++i) {
-        glBegin(GL_QUAD_STRIP);
-        for (j = 0; j <= ROOM_HEIGHT/TILE_RES; ++j) {
-            glNormal3f(0.0, 0.0, 1.0);
-            glVertex3i( i   *TILE_RES, j*TILE_RES, 0);
-            glNormal3f(0.0, 0.0, 1.0);
-            glVertex3i((i+1)*TILE_RES, j*TILE_RES, 0);
-        }
-        glEnd();
-    }
-    glPopMatrix();
-
-    // draw far wall
-    glMatrixMode(GL_MODELVIEW);
-    glPushMatrix();
-
-    // rotate to face wall
-    // glRotated(0.0, 0.0, 1.0, 0.0);
-
-    // move to lower left corner
-    glTranslated(ROOM_WIDTH/-2.0, FLOOR_LEVEL, ROOM_LENGTH/-2.0);
-    
-    if (showTextures) {
-        glEnable(GL_TEXTURE_2D);
-        glBindTexture(GL_TEXTURE_2D, pix[0]->id);  // skyline3.png
+    if (wall == WALL_FAR && showTextures) {
+        // far wall carries the picture
+        glsEnable(GL_TEXTURE_2D);
+        glsBindTexture(GL_TEXTURE_2D, pix[0]->id);  // skyline3.png
         printf("Binding messi texture ID %u on far wall\n", pix[0]->id);
 
         GLfloat const texColorA[4] = {1.0, 1.0, 1.0, 1.0};
         GLfloat const texColorD[4] = {1.0, 1.0, 1.0, 1.0};
         GLfloat const texColorS[4] = {1.0, 1.0, 1.0, 1.0};
 
-        glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, texColorA);
-        glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, texColorD);
-        glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, texColorS);
-        glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 0.0f);
-
-        glBegin(GL_QUADS);
-            glTexCoord2f(0.0f, 0.0f); glVertex3f(0.0f,              0.0f, 0.0f);
-            glTexCoord2f(1.0f, 0.0f); glVertex3f(ROOM_WIDTH,        0.0f, 0.0f);
-            glTexCoord2f(1.0f, 1.0f); glVertex3f(ROOM_WIDTH, ROOM_HEIGHT, 0.0f);
-            glTexCoord2f(0.0f, 1.0f); glVertex3f(0.0f,        ROOM_HEIGHT, 0.0f);
-        glEnd();
+        setMaterial(texColorA, texColorD, texColorS, 0.0f);
+        meshDraw(pictureMesh);
 
-        glDisable(GL_TEXTURE_2D);
+        glsDisable(GL_TEXTURE_2D);
     } else {
-        // fallback: draw untextured wall
-        for (int i = 0; i < ROOM_WIDTH / TILE_RES; ++i) {
-            glBegin(GL_QUAD_STRIP);
-            for (int j = 0; j <= ROOM_HEIGHT / TILE_RES; ++j) {
-                glNormal3f(0.0, 0.0, 1.0);
-                glVertex3i(i * TILE_RES, j * TILE_RES, 0);
-                glVertex3i((i + 1) * TILE_RES, j * TILE_RES, 0);
-            }
-            glEnd();
-        }
-        
-        // draw wall panels left of window
-        for (i = 0; i < ((ROOM_WIDTH/TILE_RES/2)-(GLASS_WIDTH/TILE_RES/2)); ++i) {
-            glBegin(GL_QUAD_STRIP);
-            for (j = 0; j <= ROOM_HEIGHT/TILE_RES; ++j) {
-                glNormal3f(0.0, 0.0, 1.0);
-                glVertex3i( i   *TILE_RES, j*TILE_RES, 0);
-                glNormal3f(0.0, 0.0, 1.0);
-                glVertex3i((i+1)*TILE_RES, j*TILE_RES, 0);
-            }
-            glEnd();
-        }
-        
-        // draw wall panels above window
-        for (i = ((ROOM_WIDTH/TILE_RES/2)-(GLASS_WIDTH/TILE_RES/2));
-             i < ((ROOM_WIDTH/TILE_RES/2)+(GLASS_WIDTH/TILE_RES/2)); ++i) {
-            glBegin(GL_QUAD_STRIP);
-            for (j = (GLASS_ELEV+GLASS_HEIGHT)/TILE_RES; j <= ROOM_HEIGHT/TILE_RES; ++j) {
-                glNormal3f(0.0, 0.0, 1.0);
-                glVertex3i( i   *TILE_RES, j*TILE_RES, 0);
-                glNormal3f(0.0, 0.0, 1.0);
-                glVertex3i((i+1)*TILE_RES, j*TILE_RES, 0);
-            }
-            glEnd();
-        }
-        
-        // draw wall panels right of window
-        for (i = ((ROOM_WIDTH/TILE_RES/2)+(GLASS_WIDTH/TILE_RES/2));
-             i < ROOM_WIDTH/TILE_RES; ++i) {
-            glBegin(GL_QUAD_STRIP);
-            for (j = 0; j <= ROOM_HEIGHT/TILE_RES; ++j) {
-                glNormal3f(0.0, 0.0, 1.0);
-                glVertex3i( i   *TILE_RES, j*TILE_RES, 0);
-                glNormal3f(0.0, 0.0, 1.0);
-                glVertex3i((i+1)*TILE_RES, j*TILE_RES, 0);
-            }
-            glEnd();
-        }
-        
-        // draw wall panels below window
-        for (i = ((ROOM_WIDTH/TILE_RES/2)-(GLASS_WIDTH/TILE_RES/2));
-             i < ((ROOM_WIDTH/TILE_RES/2)+(GLASS_WIDTH/TILE_RES/2)); ++i) {
-            glBegin(GL_QUAD_STRIP);
-            for (j = 0; j <= GLASS_ELEV/TILE_RES; ++j) {
-                glNormal3f(0.0, 0.0, 1.0);
-                glVertex3i( i   *TILE_RES, j*TILE_RES, 0);
-                glNormal3f(0.0, 0.0, 1.0);
-                glVertex3i((i+1)*TILE_RES, j*TILE_RES, 0);
-            }
-            glEnd();
-        }
+        // the far wall is cut around the window
+        setMaterial(colorA, colorD, colorS, 100.0f);
+        meshDrawGroup(wallMesh, wall);
     }
 
-    
+    // everything hung on the wall, one draw per atlas page
+    if (showTextures) {
+        GLfloat const white[4] = {1.0, 1.0, 1.0, 1.0};
 
-    glPopMatrix();
+        glsEnable(GL_TEXTURE_2D);
+        setMaterial(white, white, white, 0.0f);
+        drawPaintings(wallFacing[wall]);
+        glsDisable(GL_TEXTURE_2D);
+    }
 }
 
-// draw a glass window in the scene
-void drawGlass()
+// draw the frame of the glass window
+void drawGlassFrame()
 {
     glMatrixMode(GL_MODELVIEW);
     glPushMatrix();
@@ -628,10 +1141,10 @@ void drawGlass()
     GLfloat const frameA[] = {0.2, 0.2, 0.2, 1.0};
     GLfloat const frameD[] = {0.5, 0.5, 0.5, 1.0};
     GLfloat const frameS[] = {0.8, 0.8, 0.8, 1.0};
-    glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, frameA);
-    glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, frameD);
-    glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, frameS);
-    glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 100.0f);
+    glsMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, frameA);
+    glsMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, frameD);
+    glsMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, frameS);
+    glsMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 100.0f);
 
     glBegin(GL_QUAD_STRIP);
     for (int i = 0; i < 5; ++i) {
@@ -644,15 +1157,25 @@ void drawGlass()
     }
     glEnd();
 
+    glPopMatrix();
+}
+
+// draw the sliding pane of the glass window
+void drawGlassPane()
+{
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+    glTranslated(-GLASS_WIDTH / 2.0, FLOOR_LEVEL + GLASS_ELEV, ROOM_LENGTH / -2.0);
+
     // Glass Pane Material
-    glDisable(GL_CULL_FACE);
+    glsDisable(GL_CULL_FACE);
     GLfloat const glassA[] = {0.1, 0.1, 0.7, 0.25};
     GLfloat const glassD[] = {0.1, 0.1, 0.7, 0.25};
     GLfloat const glassS[] = {0.1, 0.1, 0.7, 0.25};
-    glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, glassA);
-    glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, glassD);
-    glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, glassS);
-    glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 100.0f);
+    glsMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, glassA);
+    glsMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, glassD);
+    glsMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, glassS);
+    glsMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 100.0f);
 
     glBegin(GL_QUADS);
         glNormal3f(0.0, 0.0, 1.0);
@@ -661,20 +1184,20 @@ void drawGlass()
         glVertex3d(GLASS_WIDTH + glassOpen, GLASS_HEIGHT, -50.0);
         glVertex3d(0.0, GLASS_HEIGHT, -50.0);
     glEnd();
-    glEnable(GL_CULL_FACE);
+    glsEnable(GL_CULL_FACE);
 
     glPopMatrix();
 }
 
 // update window animation
-void openGlass()
+void openGlass(scenestate *s)
 {
     GLdouble delta = 50.0 * ANI_RATE / 200.0 * speedMultiplier;
 
     if (glassIsOpening) {
-        glassOpen = fmax(glassOpen - delta, -GLASS_WIDTH);
+        s->glassOpen = fmax(s->glassOpen - delta, -GLASS_WIDTH);
     } else {
-        glassOpen = fmin(glassOpen + delta, 0);
+        s->glassOpen = fmin(s->glassOpen + delta, 0);
     }
 }
 void drawSculpture1()
@@ -721,25 +1244,25 @@ void drawSculpture1()
 
     // Sun
     setMaterial(sunA, sunD, sunS, 100.0f);
-    gluSphere(quadric, 128.0, 60, 40);
+    cacheSphere(128.0, 60, 40);
     glRotated(5.0, 0.0, 0.0, 1.0);  // Tilt for aesthetics
 
     // Earth + Moon
     glPushMatrix();
         glTranslated(earthDist * sin(earthTheta), 0.0, earthDist * -cos(earthTheta));
         setMaterial(earthA, earthD, earthS, 100.0f);
-        gluSphere(quadric, 32.0, 35, 25);
+        cacheSphere(32.0, 35, 25);
 
         glTranslated(moonDist * sin(moonTheta), 0.0, moonDist * -cos(moonTheta));
         setMaterial(moonA, moonD, moonS, 1.0f);
-        gluSphere(quadric, 10.0, 20, 15);
+        cacheSphere(10.0, 20, 15);
     glPopMatrix();
 
     // Mercury
     glPushMatrix();
         glTranslated(mercuryDist * sin(mercuryTheta), 0.0, mercuryDist * -cos(mercuryTheta));
         setMaterial(mercuryA, mercuryD, mercuryS, 1.0f);
-        gluSphere(quadric, 20.0, 20, 15);
+        cacheSphere(20.0, 20, 15);
     glPopMatrix();
 
     glPopMatrix();
@@ -750,7 +1273,7 @@ void drawSculpture1()
 
 
 // update sculpture1 animation
-void updateSculpture1()
+void updateSculpture1(scenestate *s)
 {
     // Orbital constants
     const GLdouble EARTH_P = 350.0;
@@ -762,20 +1285,20 @@ void updateSculpture1()
     GLdouble delta = (ANI_RATE / 200.0) * speedMultiplier;
 
     // Earth update
-    GLdouble earthVelocity = (75000.0 / (earthDist * earthDist)) - (M_PI / 220.0);
-    earthTheta += earthVelocity * delta;
-    earthTheta  = fmod(earthTheta, 2.0 * M_PI);
-    earthDist   = EARTH_P / (1 + EARTH_E * cos(earthTheta));
+    GLdouble earthVelocity = (75000.0 / (s->earthDist * s->earthDist)) - (M_PI / 220.0);
+    s->earthTheta += earthVelocity * delta;
+    s->earthTheta  = fmod(s->earthTheta, 2.0 * M_PI);
+    s->earthDist   = EARTH_P / (1 + EARTH_E * cos(s->earthTheta));
 
     // Moon update
-    moonTheta += (M_PI / 6.0) * delta;
-    moonTheta  = fmod(moonTheta, 2.0 * M_PI);
+    s->moonTheta += (M_PI / 6.0) * delta;
+    s->moonTheta  = fmod(s->moonTheta, 2.0 * M_PI);
 
     // Mercury update
-    GLdouble mercuryVelocity = (60000.0 / (mercuryDist * mercuryDist)) - (M_PI / 220.0);
-    mercuryTheta += mercuryVelocity * delta;
-    mercuryTheta  = fmod(mercuryTheta, 2.0 * M_PI);
-    mercuryDist   = MERCURY_P / (1 + MERCURY_E * cos(mercuryTheta));
+    GLdouble mercuryVelocity = (60000.0 / (s->mercuryDist * s->mercuryDist)) - (M_PI / 220.0);
+    s->mercuryTheta += mercuryVelocity * delta;
+    s->mercuryTheta  = fmod(s->mercuryTheta, 2.0 * M_PI);
+    s->mercuryDist   = MERCURY_P / (1 + MERCURY_E * cos(s->mercuryTheta));
 }
 
 void drawSculpture2()
@@ -794,18 +1317,18 @@ void drawSculpture2()
         glRotated(90.0, 0.0, 1.0, 0.0);
 
         glPushMatrix();
+        glsDisable(GL_CULL_FACE);
         for (int i = 0; i < 4; ++i) {
             glRotated(diskRot[i], (i % 2 == 0), (i % 2 == 1), 0.0);
 
-            glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT,   colors[i * 3 + 0]);
-            glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE,   colors[i * 3 + 1]);
-            glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR,  colors[i * 3 + 2]);
-            glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 100.0f);
+            glsMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT,   colors[i * 3 + 0]);
+            glsMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE,   colors[i * 3 + 1]);
+            glsMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR,  colors[i * 3 + 2]);
+            glsMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 100.0f);
 
-            glDisable(GL_CULL_FACE);
-            glutSolidTorus(10.0, 210.0 - 20 * i, 20, 50);
-            glEnable(GL_CULL_FACE);
+            cacheTorus(10.0, 210.0 - 20 * i, 20, 50);
         }
+        glsEnable(GL_CULL_FACE);
         glPopMatrix();
 
         for (int side = -1; side <= 1; side += 2) {
@@ -813,13 +1336,13 @@ void drawSculpture2()
             glTranslated(side * 230.0, 0.0, 0.0);
             glRotated(90.0, 1.0, 0.0, 0.0);
 
-            glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT,   colors[12]);
-            glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE,   colors[13]);
-            glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR,  colors[14]);
-            glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 100.0f);
+            glsMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT,   colors[12]);
+            glsMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE,   colors[13]);
+            glsMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR,  colors[14]);
+            glsMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 100.0f);
 
-            gluCylinder(quadric, 10.0, 10.0, -1.0 * FLOOR_LEVEL, 20, 80);
-            gluSphere(quadric, 10.0, 10, 15);
+            cacheCylinder(10.0, 10.0, -1.0 * FLOOR_LEVEL, 20, 80);
+            cacheSphere(10.0, 10, 15);
             glPopMatrix();
         }
 
@@ -827,13 +1350,13 @@ void drawSculpture2()
     }
 
 // update sculpture2 animation
-void updateSculpture2() {
+void updateSculpture2(scenestate *s) {
     const GLfloat rotationSpeeds[] = {5.0, 15.0, 25.0, 35.0};
     GLfloat delta = (ANI_RATE / 200.0) * speedMultiplier;
 
     for (int i = 0; i < 4; ++i) {
-        diskRot[i] += rotationSpeeds[i] * delta;
-        diskRot[i] = fmod(diskRot[i], 360.0);
+        s->diskRot[i] += rotationSpeeds[i] * delta;
+        s->diskRot[i] = fmod(s->diskRot[i], 360.0);
     }
 }
 
@@ -844,10 +1367,10 @@ void drawSculpture3() {
     const GLfloat shininess  = 100.0f;
 
     // Set material properties for entire sculpture
-    glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT,   ambient);
-    glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE,   diffuse);
-    glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR,  specular);
-    glMaterialf( GL_FRONT_AND_BACK, GL_SHININESS, shininess);
+    glsMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT,   ambient);
+    glsMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE,   diffuse);
+    glsMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR,  specular);
+    glsMaterialf( GL_FRONT_AND_BACK, GL_SHININESS, shininess);
 
     glMatrixMode(GL_MODELVIEW);
     glPushMatrix();
@@ -866,36 +1389,36 @@ void drawSculpture3() {
         // Rotate and draw teapot
         glRotated(90.0, 0.0, 1.0, 0.0);  // keep this for orientation
         glRotated(-teapotTiltAngle, 0.0, 0.0, 1.0); // tilt forward/backward
-        glDisable(GL_CULL_FACE);
-        glutSolidTeapot(128.0);
-        glEnable(GL_CULL_FACE);
+        glsDisable(GL_CULL_FACE);
+        cacheTeapot(128.0);
+        glsEnable(GL_CULL_FACE);
 
     glPopMatrix();
 }
 
-void updateSculpture3()
+void updateSculpture3(scenestate *s)
 {
     const float tiltSpeed = 2.0f;
     const float maxTilt = 45.0f;
 
-    if (teapotPouringForward) {
-        teapotTiltAngle += tiltSpeed;
+    if (s->teapotPouringForward) {
+        s->teapotTiltAngle += tiltSpeed;
 
         // 🔊 Only play sound if user enabled it with 'p'
-        if (playPourSound && !soundPlayed && teapotTiltAngle >= tiltSpeed) {
-            system("afplay pour.wav &");  // async sound (macOS)
+        if (playPourSound && !soundPlayed && s->teapotTiltAngle >= tiltSpeed) {
+            audioPlay(pourSound, false);  // queued for the mixer, no waiting
             soundPlayed = true;
         }
 
-        if (teapotTiltAngle >= maxTilt) {
-            teapotTiltAngle = maxTilt;
-            teapotPouringForward = false;
+        if (s->teapotTiltAngle >= maxTilt) {
+            s->teapotTiltAngle = maxTilt;
+            s->teapotPouringForward = false;
         }
     } else {
-        teapotTiltAngle -= tiltSpeed;
-        if (teapotTiltAngle <= 0.0f) {
-            teapotTiltAngle = 0.0f;
-            teapotPouringForward = true;
+        s->teapotTiltAngle -= tiltSpeed;
+        if (s->teapotTiltAngle <= 0.0f) {
+            s->teapotTiltAngle = 0.0f;
+            s->teapotPouringForward = true;
             soundPlayed = false;  // reset for next pour
         }
     }
@@ -909,10 +1432,6 @@ void drawSculpture4()
     const GLfloat metalDiffuse[]  = {0.6, 0.6, 0.6, 1.0};
     const GLfloat metalSpecular[] = {0.6, 0.6, 0.6, 1.0};
 
-    const GLfloat blockAmbient[]  = {0.4, 0.4, 0.4, 0.30};
-    const GLfloat blockDiffuse[]  = {0.4, 0.4, 0.4, 0.30};
-    const GLfloat blockSpecular[] = {1.0, 1.0, 1.0, 0.30};
-
     glMatrixMode(GL_MODELVIEW);
     glPushMatrix();
 
@@ -927,10 +1446,10 @@ void drawSculpture4()
         const GLfloat redD[] = {0.8, 0.0, 0.0, 1.0};
         const GLfloat redS[] = {0.9, 0.0, 0.0, 1.0};
 
-        glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, redA);
-        glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, redD);
-        glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, redS);
-        glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 100.0f);
+        glsMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, redA);
+        glsMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, redD);
+        glsMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, redS);
+        glsMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 100.0f);
 
         glTranslated(0.0, -rodLength - 420.0, 0.0);
 
@@ -939,15 +1458,15 @@ void drawSculpture4()
         else
             glScaled(1.0, 0.9 - 200.0 / pistHeight + 0.1, 1.0);
 
-        gluSphere(quadric, 256.0, 20, 30);
+        cacheSphere(256.0, 20, 30);
         glPopMatrix();
     }
 
     // --- Metallic Look for Piston Assembly ---
-    glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, metalAmbient);
-    glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, metalDiffuse);
-    glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, metalSpecular);
-    glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 100.0f);
+    glsMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, metalAmbient);
+    glsMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, metalDiffuse);
+    glsMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, metalSpecular);
+    glsMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 100.0f);
 
     // --- Draw Main Piston Assembly ---
     glPushMatrix();
@@ -956,17 +1475,17 @@ void drawSculpture4()
     glPushMatrix();
         glTranslated(150.0, 0.0, 0.0);
         glRotated(90.0, 0.0, 1.0, 0.0);
-        gluSphere(quadric, 50.0, 20, 30);
-        gluCylinder(quadric, 50.0, 50.0, 362.0, 20, 30);
+        cacheSphere(50.0, 20, 30);
+        cacheCylinder(50.0, 50.0, 362.0, 20, 30);
     glPopMatrix();
 
     // Rotating Crank
     glPushMatrix();
         glTranslated(150.0, 0.0, 0.0);
         glRotated(-crankTheta * 180.0 / M_PI + 90.0, 1.0, 0.0, 0.0);
-        gluCylinder(quadric, 50.0, 50.0, crankRadius, 20, 30);
+        cacheCylinder(50.0, 50.0, crankRadius, 20, 30);
         glTranslated(0.0, 0.0, crankRadius);
-        gluSphere(quadric, 50.0, 20, 30);
+        cacheSphere(50.0, 20, 30);
     glPopMatrix();
 
     // Apply piston height and orientation
@@ -974,63 +1493,72 @@ void drawSculpture4()
     glRotated(90.0, 1.0, 0.0, 0.0);
 
     // Main piston
-    gluCylinder(quadric, 256.0, 256.0, 128.0, 20, 30);
+    cacheCylinder(256.0, 256.0, 128.0, 20, 30);
 
     // Top of piston
     glRotated(180.0, 1.0, 0.0, 0.0);
-    gluDisk(quadric, 0.0, 256.0, 20, 30);
+    cacheDisk(0.0, 256.0, 20, 30);
 
     // Push Rod Mechanism
     glPushMatrix();
         glRotated(asin(crankRadius * sin(crankTheta) / rodLength) * 180.0 / M_PI, 1.0, 0.0, 0.0);
-        gluSphere(quadric, 50.0, 20, 30);
-        gluCylinder(quadric, 50.0, 50.0, rodLength, 20, 30);
+        cacheSphere(50.0, 20, 30);
+        cacheCylinder(50.0, 50.0, rodLength, 20, 30);
 
         // Joint to crankshaft
         glTranslated(0.0, 0.0, rodLength);
         glRotated(90.0, 0.0, 1.0, 0.0);
-        gluSphere(quadric, 50.0, 20, 30);
-        gluCylinder(quadric, 50.0, 50.0, 150.0, 20, 30);
+        cacheSphere(50.0, 20, 30);
+        cacheCylinder(50.0, 50.0, 150.0, 20, 30);
     glPopMatrix();
 
     // Bottom cap of piston
     glTranslated(0.0, 0.0, -128.0);
     glRotated(-180.0, 1.0, 0.0, 0.0);
-    gluDisk(quadric, 0.0, 256.0, 20, 30);
+    cacheDisk(0.0, 256.0, 20, 30);
 
     glPopMatrix(); // End of piston assembly
 
+    glPopMatrix(); // End of sculpture
+}
+
+// draw the transparent block around sculpture4
+void drawSculpture4Block()
+{
+    const GLfloat blockAmbient[]  = {0.4, 0.4, 0.4, 0.30};
+    const GLfloat blockDiffuse[]  = {0.4, 0.4, 0.4, 0.30};
+    const GLfloat blockSpecular[] = {1.0, 1.0, 1.0, 0.30};
+
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+
+    // --- Position the Sculpture ---
+    glTranslated((ROOM_WIDTH / 2.0) - 512, 200.0, (ROOM_LENGTH / 2.0) - (3.0 * ROOM_LENGTH / 5.0));
+
     // --- Draw Transparent Block Enclosure ---
     glPushMatrix();
         glTranslated(0.0, FLOOR_LEVEL - 200, 0.0);
         glRotated(-90.0, 1.0, 0.0, 0.0);
 
-        glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, blockAmbient);
-        glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, blockDiffuse);
-        glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, blockSpecular);
-        glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 100.0f);
+        glsMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, blockAmbient);
+        glsMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, blockDiffuse);
+        glsMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, blockSpecular);
+        glsMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 100.0f);
 
-        glDisable(GL_CULL_FACE);
-        gluCylinder(quadric, 260.0, 260.0, 670.0, 60, 80);
-        glEnable(GL_CULL_FACE);
+        glsDisable(GL_CULL_FACE);
+        cacheCylinder(260.0, 260.0, 670.0, 60, 80);
+        glsEnable(GL_CULL_FACE);
     glPopMatrix();
 
     glPopMatrix(); // End of sculpture
 }
 
-void updateSculpture4()
+void updateSculpture4(scenestate *s)
 {
     // Increment crank angle based on animation rate and speed multiplier
-    crankTheta += (35.0 * (M_PI / 180.0)) * (ANI_RATE / 200.0) * speedMultiplier;
-    crankTheta = fmod(crankTheta, 2.0 * M_PI);
-
-    // Enable burn effect if crank is near vertical
-    showBurn = fabs(crankTheta) < (90.0 * (M_PI / 180.0));
-
-    // Update piston height using trigonometric crank-rod relationship
-    double sinTheta = sin(crankTheta);
-    double cosTheta = cos(crankTheta);
-    pistHeight = crankRadius * cosTheta + sqrt(rodLength * rodLength - crankRadius * crankRadius * sinTheta * sinTheta);
+    // the burn and piston height follow it in interpolateScene
+    s->crankTheta += (35.0 * (M_PI / 180.0)) * (ANI_RATE / 200.0) * speedMultiplier;
+    s->crankTheta = fmod(s->crankTheta, 2.0 * M_PI);
 }
 
 // draw sculpture5
@@ -1060,6 +1588,111 @@ void drawSculpture5()
 
 
 
+// how the GL can skip a draw on an occlusion query's result
+#define CONDITIONAL_NONE  0     // it cannot, draw unconditionally
+#define CONDITIONAL_CORE  1     // GL 3.0 glBeginConditionalRender
+#define CONDITIONAL_NV    2     // GL_NV_conditional_render on an older context
+
+// which conditional rendering the context has, checked once
+static int conditionalRender()
+{
+    static int kind = -1;
+
+    if (kind < 0) {
+        const char *version = (const char *)glGetString(GL_VERSION);
+        const char *ext = (const char *)glGetString(GL_EXTENSIONS);
+
+        kind = CONDITIONAL_NONE;
+#ifdef GL_VERSION_3_0
+        if (version != NULL && atoi(version) >= 3)
+            kind = CONDITIONAL_CORE;
+#endif
+#ifdef GL_NV_conditional_render
+        if (kind == CONDITIONAL_NONE && ext != NULL &&
+            strstr(ext, "GL_NV_conditional_render") != NULL)
+            kind = CONDITIONAL_NV;
+#endif
+        (void)version;
+        (void)ext;
+    }
+    return kind;
+}
+
+// draw the outside only where a portal is on screen
+// the pass is scissored to the screen bounds of the visible portals;
+// where the GL has conditional rendering it is also skipped on the GPU
+// when the room hides them all
+void drawThroughPortals()
+{
+    GLint viewport[4], rect[4];
+    GLint x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+    int   numVisible = 0;
+
+    navGetViewport(viewport);
+
+    for (int i = 0; i < NUM_PORTALS; ++i) {
+        if (!frustumScreenRect(&frameView, portals[i].corners, 4, viewport, rect))
+            continue;
+
+        if (numVisible++ == 0) {
+            x0 = rect[0];  y0 = rect[1];
+            x1 = rect[0] + rect[2];  y1 = rect[1] + rect[3];
+        } else {
+            x0 = (rect[0] < x0) ? rect[0] : x0;
+            y0 = (rect[1] < y0) ? rect[1] : y0;
+            x1 = (rect[0] + rect[2] > x1) ? rect[0] + rect[2] : x1;
+            y1 = (rect[1] + rect[3] > y1) ? rect[1] + rect[3] : y1;
+        }
+    }
+
+    if (numVisible == 0) {
+        ++numCulled;
+        return;
+    }
+
+    glScissor(x0, y0, x1 - x0, y1 - y0);
+    glsEnable(GL_SCISSOR_TEST);
+
+    int kind = conditionalRender();
+
+    if (kind == CONDITIONAL_NONE) {
+        drawOutside();
+        glsDisable(GL_SCISSOR_TEST);
+        return;
+    }
+
+    // count the portal samples that pass the room's depth,
+    // without touching color or depth
+    glsColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+    glsDepthMask(GL_FALSE);
+    glBeginQuery(GL_SAMPLES_PASSED, portalQuery);
+    glBegin(GL_QUADS);
+        for (int i = 0; i < NUM_PORTALS; ++i)
+            for (int k = 0; k < 4; ++k)
+                glVertex3dv(portals[i].corners[k]);
+    glEnd();
+    glEndQuery(GL_SAMPLES_PASSED);
+    glsDepthMask(GL_TRUE);
+    glsColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+
+#ifdef GL_VERSION_3_0
+    if (kind == CONDITIONAL_CORE) {
+        glBeginConditionalRender(portalQuery, GL_QUERY_BY_REGION_WAIT);
+        drawOutside();
+        glEndConditionalRender();
+    }
+#endif
+#ifdef GL_NV_conditional_render
+    if (kind == CONDITIONAL_NV) {
+        glBeginConditionalRenderNV(portalQuery, GL_QUERY_BY_REGION_WAIT_NV);
+        drawOutside();
+        glEndConditionalRenderNV();
+    }
+#endif
+
+    glsDisable(GL_SCISSOR_TEST);
+}
+
 // draw everything outside the room
 void drawOutside()
 {
@@ -1079,10 +1712,14 @@ void drawOutside()
         GLfloat grassDiffuse[]  = {0.0, 1.0, 0.0, 1.0};
         GLfloat grassSpecular[] = {0.0, 0.0, 0.0, 1.0};
 
-        glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT,  grassAmbient);
-        glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE,  grassDiffuse);
-        glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, grassSpecular);
-        glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 100.0f);
+        glsMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT,  grassAmbient);
+        glsMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE,  grassDiffuse);
+        glsMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, grassSpecular);
+        glsMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 100.0f);
+
+        // the outside is lit facing the room, as the far wall it used to
+        // inherit its normal from; culling the wall must not change it
+        glNormal3f(0.0, 0.0, 1.0);
 
         glBegin(GL_QUADS);
             glVertex3i(0,             0,  0);
@@ -1101,13 +1738,13 @@ void drawOutside()
         GLfloat skyDiffuse[]  = {1.0, 1.0, 1.0, 1.0};
         GLfloat skySpecular[] = {1.0, 1.0, 1.0, 1.0};
 
-        glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT,  skyAmbient);
-        glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE,  skyDiffuse);
-        glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, skySpecular);
-        glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 0.0f);
+        glsMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT,  skyAmbient);
+        glsMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE,  skyDiffuse);
+        glsMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, skySpecular);
+        glsMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 0.0f);
 
-        glEnable(GL_TEXTURE_2D);
-        glBindTexture(GL_TEXTURE_2D, pix[0]->id);
+        glsEnable(GL_TEXTURE_2D);
+        glsBindTexture(GL_TEXTURE_2D, pix[0]->id);
 
         glBegin(GL_QUADS);
             glTexCoord2f(0.0f, 0.0f); glVertex3i(0,             0,              -OUTSIDE_LENGTH);
@@ -1116,12 +1753,12 @@ void drawOutside()
             glTexCoord2f(0.0f, 1.0f); glVertex3i(0,             OUTSIDE_HEIGHT, -OUTSIDE_LENGTH);
         glEnd();
 
-        glDisable(GL_TEXTURE_2D);
+        glsDisable(GL_TEXTURE_2D);
     }
     else
     {
         // Fallback: Solid red wall if textures are disabled
-        glDisable(GL_TEXTURE_2D);
+        glsDisable(GL_TEXTURE_2D);
         glColor3f(1.0, 0.0, 0.0);
 
         glBegin(GL_QUADS);
@@ -1164,11 +1801,11 @@ void keyDown(unsigned char key, int x, int y)
         if (keyDigit >= 1 && keyDigit <= 8) {
             int index = keyDigit - 1;
             if (glIsEnabled(lights[index]))
-                glDisable(lights[index]);
+                glsDisable(lights[index]);
             else
-                glEnable(lights[index]);
+                glsEnable(lights[index]);
 
-            glutPostRedisplay();
+            navMarkDirty(DIRTY_LIGHTS);
         }
         return;
     }
@@ -1176,14 +1813,20 @@ void keyDown(unsigned char key, int x, int y)
     switch (key) {
         case 'a':
             frozen = !frozen;
-            glutPostRedisplay();
+            navMarkDirty(DIRTY_ANIMATION);
             break;
 
         case 'f':
             frozen = true;
+
+            // capture buffers belong to the context being replaced
+            captureCleanUp();
+            capture = false;
+
             if (!gameMode) {
                 if (glutGameModeGet(GLUT_GAME_MODE_POSSIBLE)) {
                     gameWindowID = glutGetWindow();
+                    releaseContext();
                     glutEnterGameMode();
 
                     navInitDisplay();
@@ -1191,12 +1834,16 @@ void keyDown(unsigned char key, int x, int y)
                     initCallBacks();
                     initLighting();
                     initTextures();
+                    initPaintings();
+                    initRoom();
+                    initDoubleHelix();
 
                     gameMode = true;
                 } else {
                     fprintf(stderr, "Full screen mode is not available.\n");
                 }
             } else {
+                releaseContext();
                 glutLeaveGameMode();
                 glutSetWindow(gameWindowID);
 
@@ -1205,6 +1852,9 @@ void keyDown(unsigned char key, int x, int y)
                 initCallBacks();
                 initLighting();
                 initTextures();
+                initPaintings();
+                initRoom();
+                initDoubleHelix();
 
                 gameMode = false;
             }
@@ -1213,11 +1863,24 @@ void keyDown(unsigned char key, int x, int y)
 
         case 'h':
             showHelix = !showHelix;
-            glutPostRedisplay();
+            navMarkDirty(DIRTY_SCENE);
             break;
 
         case 'k':
-            capture = !capture;
+            if (capture)
+                captureStop();
+            capture = !capture && captureStart(capturePrefix);
+
+            // record from the next frame even if nothing moves
+            if (capture)
+                navMarkDirty(DIRTY_SCENE);
+            break;
+
+        case 'r':
+            // time each stage, print the results when turned off
+            profEnable(!profEnabled);
+            if (!profEnabled)
+                profPrint(stdout);
             break;
 
         case 'q':
@@ -1226,23 +1889,16 @@ void keyDown(unsigned char key, int x, int y)
 
         case 't':
             showTextures = !showTextures;
-            glutPostRedisplay();
+            navMarkDirty(DIRTY_TEXTURES);
             break;
             
         case 'm':
-            if (!musicPlaying) {
-                musicPID = fork();
-                if (musicPID == 0) {
-                    // Child process: play music
-                    execlp("afplay", "afplay", "background.wav", (char *)NULL);
-                    exit(1); // If execlp fails
-                }
-                musicPlaying = true;
-            } else {
-                if (musicPID > 0) {
-                    kill(musicPID, SIGKILL);
-                    musicPID = -1;
-                }
+            if (musicSound < 0)
+                fprintf(stderr, "Music needs %s next to the executable, see the README.\n", MUSIC_SOUND);
+            else if (!musicPlaying)
+                musicPlaying = audioPlay(musicSound, true);
+            else {
+                audioStop(musicSound);
                 musicPlaying = false;
             }
             break;
@@ -1263,6 +1919,8 @@ void keyDown(unsigned char key, int x, int y)
             printf("• Press 'a': Freeze/unfreeze animations.\n");
             printf("• Press 'm': Music for museum.\n");
             printf("• Press 'q': Quitting the museum.\n");
+            printf("• Press 'r': Start/stop timing each drawing stage.\n");
+            printf("• Press 'k': Start/stop recording frames to png files.\n");
             printf("• Press 'h': Show/Disappear Sculptıre 5.\n");
             printf("• Press '+': Zoom in.\n");
             printf("• Press '-': Zoom out.\n");
@@ -1272,6 +1930,7 @@ void keyDown(unsigned char key, int x, int y)
 
         case 'w':
             glassIsOpening = !glassIsOpening;
+            navMarkDirty(DIRTY_ANIMATION);
             break;
         case 's':
             speedMultiplier = (speedMultiplier == 1.0) ? 2.0 : 1.0;
@@ -1284,7 +1943,7 @@ void keyDown(unsigned char key, int x, int y)
             fflush(stdout);  // ensures output is printed immediately
             cameraShaking = true;
             shakeFrame = 0;
-            glutPostRedisplay();  // force redraw for instant feedback
+            navMarkDirty(DIRTY_CAMERA);  // force redraw for instant feedback
             break;
         default:
             break;
@@ -1317,17 +1976,64 @@ void enforceWallClipping(GLdouble *x, GLdouble *y, GLdouble *z)
     if (*y < yMin) *y = yMin;
 }
 
+// delete every GL object the scene owns
+// GL names belong to the context that made them, so this runs while
+// that context is still current: before the game mode switch replaces
+// it, and before quitting
+void releaseContext()
+{
+    // the GL unbinds a deleted texture, the shadow has to hear of it
+    glsBindTexture(GL_TEXTURE_2D, 0);
+    for (int i = 0; i < numPix; ++i) {
+        if (pix[i] != NULL && pix[i]->id) {
+            glDeleteTextures(1, &pix[i]->id);
+            pix[i]->id = 0;
+        }
+    }
+
+    freePaintings();
+    freeRoom();
+    freeDoubleHelix();
+    flushMeshCache();
+    profCleanUp();
+}
+
 // clean up and exit
 void cleanUpAndQuit()
 {
+    // Report how the paintings streamed
+    streamstats streamed;
+    texStreamGetStats(&streamed);
+    if (streamed.uploads > 0)
+        texStreamPrintStats(stdout);
+
+    // Report the stage timings
+    if (profileOutput != NULL) {
+        profPrint(stdout);
+        profDump(profileOutput);
+    }
+
+    // Release the GL objects while their context is current
+    releaseContext();
+
     // Release allocated memory for loaded textures
     for (int i = 0; i < numPix; ++i) {
         if (pix[i] != NULL) {
-            free(pix[i]);
+            freePNGTexture(pix[i]);
             pix[i] = NULL;
         }
     }
 
+    // Finish writing captured frames
+    captureCleanUp();
+    audioShutdown();
+    poolStop();
+    archiveClose();
+
+    // Release the offscreen context last, it owns the objects above
+    if (headless)
+        offscreenCleanUp();
+
     // Exit the program successfully
     exit(ALL_IS_WELL);
 }
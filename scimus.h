@@ -41,60 +41,126 @@
     #define OUTSIDE_LENGTH  256*5
     #define OUTSIDE_HEIGHT  256*16
 
+    // room walls, also their draw groups in the wall mesh
+    #define WALL_RIGHT  0
+    #define WALL_LEFT   1
+    #define WALL_NEAR   2
+    #define WALL_FAR    3
+    #define NUM_WALLS   4
+
     // width of smallest tile
     #define TILE_RES  16
 
-    // animation rate in ms/refresh
+    // simulation step in ms, the scene is drawn between steps
     #define ANI_RATE  100
 
+    // most steps run for one frame, a long stall is let go rather than replayed
+    #define MAX_ANI_STEPS  5
+
+    // pictures are read from here when they are not on disk
+    #define ASSET_ARCHIVE  "images.zip"
+
+    // sounds, background.wav is downloaded separately (see the README)
+    #define POUR_SOUND   "pour.wav"
+    #define MUSIC_SOUND  "background.wav"
+
+    // where the paintings hang and what they show
+    #define PAINTINGS_FILE  "paintings.dat"
+
+    // longest side a texture is loaded at, larger images are scaled down
+    #define MAX_TEXTURE_SIZE  1024
+
+    // headless run defaults
+    #define HEADLESS_WIDTH   1000
+    #define HEADLESS_HEIGHT  800
+    #define HEADLESS_FRAMES  100
+
     // exit stati
     #define ALL_IS_WELL       0
     #define MAX_TEX_ERROR     1
     #define IMAGE_SIZE_ERROR  2
     #define OUT_OF_MEM_ERROR  3
+    #define USAGE_ERROR       4
+    #define IMAGE_LOAD_ERROR  5
 
 
-    /* wall paintings */
+    /* opening in a wall that the outside is seen through,
+       corners counter-clockwise as seen from inside the room */
+    typedef struct {
+        GLdouble corners[4][3];
+    } portal;
+
+    /* everything the animation moves, kept for the last two steps
+       so a frame can be drawn part way between them */
+    typedef struct {
+        GLdouble earthTheta, earthDist;
+        GLdouble moonTheta;
+        GLdouble mercuryTheta, mercuryDist;
+        GLdouble diskRot[4];
+        GLfloat  teapotTiltAngle;
+        bool     teapotPouringForward;
+        GLdouble crankTheta;
+        GLdouble glassOpen;
+    } scenestate;
+
+    /* how a drawable moves while the animation runs */
+    #define ANIM_NONE    0      // never
+    #define ANIM_ALWAYS  1      // every step
+    #define ANIM_GLASS   2      // while the window slides
+
+    /* something draw() submits, with a world-space bounding box */
     typedef struct {
-        /* center of painting */
-        GLdouble xcenter, ycenter, zcenter;
-        /* horizontal rotation */
-        GLdouble hrot;
-        /* pointer png texture */
-        glpngtexture *pic;
-    } painting;
-
-    void  loadTextures(int n, char *picNames[]);    // load images from file
+        const char *name;       // profiler scope
+        void (*draw)(void);
+        int  pass;              // render queue pass
+        int  material;          // groups items that share state
+        int  anim;              // how it moves, ANIM_
+        GLdouble min[3], max[3];
+    } drawable;
+
+    // items skipped by the last frustum test
+    extern int numCulled;
+
+    void  readOptions(int n, char *args[]);         // read headless and benchmark options
+    void  benchIdle();                              // fly the benchmark path from glut
+    void  loadTextures(int n, char *picNames[]);    // start decoding images from file
+    void  finishTextures();                         // wait for and check the decoded images
     void  initTextures();                           // create OpenGL textures from loaded images
     void  initLighting();                           // initialize scene lighting
-    void  initPaintings();                          // initialize painting locations
+    void  initRoom();                               // bake static room geometry
+    void  freeRoom();                               // release the baked room
     void  initCallBacks();                          // initialize glut call-back functions
     void  draw();                                   // draw to the display
-    void  animate(int i);                           // perform timed animation
+    void  animate(double ms);                       // advance the animation ms
+    void  interpolateScene(double t);               // set drawn values t of the way into a step
     void  placeLights();                            // place lights in the scene
     void  drawFloor();                              // draw a tiled floor
     void  drawCeiling();                            // draw the room ceiling
     void  drawWalls();                              // draw the room walls
-    void  drawGlass();                              // draw the window
-    void  openGlass();                              // open the window
+    void  drawWall(int wall);                       // draw one room wall
+    void  drawGlassFrame();                         // draw the window frame
+    void  drawGlassPane();                          // draw the window pane
+    void  openGlass(scenestate *s);                 // open the window
     void  drawOutside();                            // draw the skyline
+    void  drawThroughPortals();                     // draw the outside where a portal shows it
     void  drawText(int x, int y, int z, char *t);   // draw 2d text
     void  drawSculpture1();                         // draw the sculptures
     void  drawSculpture2();
     void  drawSculpture3();
     void  drawSculpture4();
+    void  drawSculpture4Block();                    // translucent part of sculpture4
     void  drawSculpture5();
-    void  drawPaintings();
-    void  updateSculpture1();                       // update sculpture animation
-    void  updateSculpture2();
-    void  updateSculpture3();
-    void  updateSculpture4();
+    void  updateSculpture1(scenestate *s);          // step sculpture animation
+    void  updateSculpture2(scenestate *s);
+    void  updateSculpture3(scenestate *s);
+    void  updateSculpture4(scenestate *s);
     void drawBook();
     void updateBook();
     void  keyDown(unsigned char key, int x, int y); // respond to key press
     void  keyUp(unsigned char key, int x, int y);   // respond to key release
     void  enforceWallClipping(GLdouble *x,          // wall clipping call-back
                       GLdouble *y, GLdouble *z);
+    void  releaseContext();                         // delete the scene's GL objects
     void  cleanUpAndQuit();                         // clean up and exit
     int   isPower2(int x);                          // test if x is a power of 2
 
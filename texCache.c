@@ -0,0 +1,557 @@
+
+// OpenGL and GLUT headers
+#ifdef __APPLE__
+    #include <GLUT/glut.h>
+#else
+    #include <GL/gl.h>
+    #include <GL/glu.h>
+    #include <GL/glut.h>
+#endif
+
+// standard c headers
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+// file mapping
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// prototypes and definitions
+#include "texCache.h"
+
+// png decoding, for textures that have to be cooked
+#include "pngLoader.h"
+
+// pictures packed in a zip
+#include "zipArchive.h"
+
+// mip chains for cooked textures
+#include "mipBuilder.h"
+
+// scaling to the size a texture is loaded at
+#include "resample.h"
+
+// S3TC formats, from GL_EXT_texture_compression_s3tc
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+    #define GL_COMPRESSED_RGB_S3TC_DXT1_EXT   0x83F0
+    #define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT  0x83F3
+#endif
+
+// levels start on this boundary in the file
+#define LEVEL_ALIGN 16
+
+// the png a cooked copy must have been cooked from
+typedef struct {
+    int64_t size;
+    int64_t mtime;
+} texsource;
+
+// note why a load failed
+static void cacheError(char *error, size_t errorSize, const char *format, ...)
+{
+    va_list args;
+
+    if (error == NULL || errorSize == 0)
+        return;
+
+    va_start(args, format);
+    vsnprintf(error, errorSize, format, args);
+    va_end(args);
+}
+
+// true for the block formats a level can be cooked to
+static bool isCompressed(GLenum internalFormat)
+{
+    return internalFormat == GL_COMPRESSED_RGB_S3TC_DXT1_EXT ||
+           internalFormat == GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+}
+
+// bytes of one w x h level
+static size_t levelSize(const texheader *h, GLuint w, GLuint h2)
+{
+    if (h->internalFormat == GL_COMPRESSED_RGB_S3TC_DXT1_EXT)
+        return (size_t)((w + 3) / 4) * ((h2 + 3) / 4) * 8;
+    if (h->internalFormat == GL_COMPRESSED_RGBA_S3TC_DXT5_EXT)
+        return (size_t)((w + 3) / 4) * ((h2 + 3) / 4) * 16;
+    return (size_t)w * h2 * h->components;
+}
+
+// pack 8 bit rgb to 5:6:5
+static GLuint pack565(const int rgb[3])
+{
+    return ((rgb[0] >> 3) << 11) | ((rgb[1] >> 2) << 5) | (rgb[2] >> 3);
+}
+
+// expand 5:6:5 back to 8 bit rgb
+static void unpack565(GLuint c, int rgb[3])
+{
+    rgb[0] = ((c >> 11) & 31) * 255 / 31;
+    rgb[1] = ((c >> 5)  & 63) * 255 / 63;
+    rgb[2] = ( c        & 31) * 255 / 31;
+}
+
+// the 4x4 pixels at bx, by, edge pixels repeated past the level's sides
+static void fetchBlock(const GLubyte *src, int w, int h, int n, int bx, int by,
+                       GLubyte block[16][4])
+{
+    for (int y = 0; y < 4; ++y) {
+        int sy = by + y < h ? by + y : h - 1;
+
+        for (int x = 0; x < 4; ++x) {
+            int sx = bx + x < w ? bx + x : w - 1;
+            const GLubyte *p = src + ((size_t)sy * w + sx) * n;
+
+            block[y * 4 + x][0] = p[0];
+            block[y * 4 + x][1] = p[1];
+            block[y * 4 + x][2] = p[2];
+            block[y * 4 + x][3] = n == 4 ? p[3] : 255;
+        }
+    }
+}
+
+// 8 byte color block, end points from the inset bounding box of the colors
+static void encodeColorBlock(GLubyte block[16][4], GLubyte out[8])
+{
+    int lo[3] = {255, 255, 255}, hi[3] = {0, 0, 0};
+    int pal[4][3];
+
+    for (int i = 0; i < 16; ++i)
+        for (int c = 0; c < 3; ++c) {
+            if (block[i][c] < lo[c]) lo[c] = block[i][c];
+            if (block[i][c] > hi[c]) hi[c] = block[i][c];
+        }
+    for (int c = 0; c < 3; ++c) {
+        int inset = (hi[c] - lo[c]) / 16;
+        lo[c] += inset;
+        hi[c] -= inset;
+    }
+
+    GLuint c0 = pack565(hi), c1 = pack565(lo);
+    GLuint indices = 0;
+
+    // c0 > c1 selects the four color mode, equal end points need no indices
+    if (c0 < c1) {
+        GLuint t = c0;
+        c0 = c1;
+        c1 = t;
+    }
+    if (c0 != c1) {
+        unpack565(c0, pal[0]);
+        unpack565(c1, pal[1]);
+        for (int c = 0; c < 3; ++c) {
+            pal[2][c] = (2 * pal[0][c] + pal[1][c]) / 3;
+            pal[3][c] = (pal[0][c] + 2 * pal[1][c]) / 3;
+        }
+
+        for (int i = 0; i < 16; ++i) {
+            int best = 0, bestDist = 1 << 30;
+
+            for (int p = 0; p < 4; ++p) {
+                int dr = block[i][0] - pal[p][0];
+                int dg = block[i][1] - pal[p][1];
+                int db = block[i][2] - pal[p][2];
+                int d  = dr * dr + dg * dg + db * db;
+
+                if (d < bestDist) {
+                    bestDist = d;
+                    best = p;
+                }
+            }
+            indices |= (GLuint)best << (2 * i);
+        }
+    }
+
+    out[0] = c0 & 0xff;
+    out[1] = c0 >> 8;
+    out[2] = c1 & 0xff;
+    out[3] = c1 >> 8;
+    out[4] = indices & 0xff;
+    out[5] = (indices >> 8) & 0xff;
+    out[6] = (indices >> 16) & 0xff;
+    out[7] = indices >> 24;
+}
+
+// 8 byte alpha block, eight steps between the largest and smallest alpha
+static void encodeAlphaBlock(GLubyte block[16][4], GLubyte out[8])
+{
+    int a0 = 0, a1 = 255;
+    uint64_t indices = 0;
+
+    for (int i = 0; i < 16; ++i) {
+        if (block[i][3] > a0) a0 = block[i][3];
+        if (block[i][3] < a1) a1 = block[i][3];
+    }
+
+    if (a0 != a1) {
+        int pal[8] = {a0, a1};
+
+        for (int p = 1; p < 7; ++p)
+            pal[p + 1] = ((7 - p) * a0 + p * a1) / 7;
+
+        for (int i = 0; i < 16; ++i) {
+            int best = 0, bestDist = 256;
+
+            for (int p = 0; p < 8; ++p) {
+                int d = abs(block[i][3] - pal[p]);
+                if (d < bestDist) {
+                    bestDist = d;
+                    best = p;
+                }
+            }
+            indices |= (uint64_t)best << (3 * i);
+        }
+    }
+
+    out[0] = a0;
+    out[1] = a1;
+    for (int i = 0; i < 6; ++i)
+        out[2 + i] = (indices >> (8 * i)) & 0xff;
+}
+
+// compress a level to DXT1 or DXT5 blocks
+static void encodeLevel(const GLubyte *src, int w, int h, int n, GLubyte *out)
+{
+    GLubyte block[16][4];
+
+    for (int by = 0; by < h; by += 4)
+        for (int bx = 0; bx < w; bx += 4) {
+            fetchBlock(src, w, h, n, bx, by, block);
+            if (n == 4) {
+                encodeAlphaBlock(block, out);
+                out += 8;
+            }
+            encodeColorBlock(block, out);
+            out += 8;
+        }
+}
+
+// decode an opened png into a new container, NULL with the reason in
+// error; the reader is closed either way
+static void *cookContainer(pngreader *png, GLuint flags, int maxSize,
+                           const texsource *src, size_t *size,
+                           char *error, size_t errorSize)
+{
+    GLuint n = png->internalFormat;
+    texheader header = {
+        TEXCACHE_MAGIC, TEXCACHE_VERSION, flags,
+        png->width, png->height, n, png->format, n, 1, maxSize,
+        src->mtime, src->size
+    };
+    texlevel levels[TEXCACHE_MAX_LEVELS];
+
+    // fit the largest size asked for, mip chains start from a power of 2
+    int sw, sh;
+    resampleSize(png->width, png->height, maxSize, flags & TEXCACHE_MIPMAPS, &sw, &sh);
+    GLuint w = sw, h = sh;
+    if ((flags & TEXCACHE_COMPRESSED) && (n == 3 || n == 4))
+        header.internalFormat = n == 3 ? GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+                                       : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+
+    // size the levels, halving to 1x1 for a mip chain
+    GLuint lw = w, lh = h;
+    for (header.numLevels = 0; header.numLevels < TEXCACHE_MAX_LEVELS; ) {
+        texlevel *l = &levels[header.numLevels++];
+
+        l->width  = lw;
+        l->height = lh;
+        l->size   = levelSize(&header, lw, lh);
+
+        if (!(flags & TEXCACHE_MIPMAPS) || (lw == 1 && lh == 1))
+            break;
+        lw = lw > 1 ? lw / 2 : 1;
+        lh = lh > 1 ? lh / 2 : 1;
+    }
+
+    // the level table follows the header, then the aligned levels
+    size_t offset = sizeof(texheader) + header.numLevels * sizeof(texlevel);
+    for (GLuint i = 0; i < header.numLevels; ++i) {
+        offset = (offset + LEVEL_ALIGN - 1) & ~(size_t)(LEVEL_ALIGN - 1);
+        levels[i].offset = offset;
+        offset += levels[i].size;
+    }
+
+    GLubyte *data = malloc(offset);
+    GLubyte *scratch = NULL;
+    GLubyte *chain[TEXCACHE_MAX_LEVELS];
+    if (data == NULL) {
+        cacheError(error, errorSize, "Out of memory cooking \"%s\"", png->name);
+        closePNG(png);
+        return NULL;
+    }
+
+    memcpy(data, &header, sizeof(header));
+    memcpy(data + sizeof(header), levels, header.numLevels * sizeof(texlevel));
+
+    // the chain is built in place, or beside the container to be compressed
+    if (isCompressed(header.internalFormat)) {
+        size_t total = 0;
+        for (GLuint i = 0; i < header.numLevels; ++i)
+            total += (size_t)levels[i].width * levels[i].height * n;
+
+        scratch = malloc(total);
+        if (scratch == NULL) {
+            cacheError(error, errorSize, "Out of memory cooking \"%s\"", png->name);
+            closePNG(png);
+            free(data);
+            return NULL;
+        }
+        for (GLuint i = 0, at = 0; i < header.numLevels; ++i) {
+            chain[i] = scratch + at;
+            at += levels[i].width * levels[i].height * n;
+        }
+    }
+    else
+        for (GLuint i = 0; i < header.numLevels; ++i)
+            chain[i] = data + levels[i].offset;
+
+    // the first level is the png at the size it is loaded at; one that
+    // needs no scaling is decoded straight into it, with no copy between
+    bool built;
+    if (w == (GLuint)png->width && h == (GLuint)png->height)
+        built = readPNGRows(png, chain[0], error, errorSize);
+    else {
+        int pw = png->width, ph = png->height;
+        GLubyte *texels = malloc((size_t)pw * ph * n);
+
+        built = texels != NULL && readPNGRows(png, texels, error, errorSize);
+        if (texels == NULL) {
+            cacheError(error, errorSize, "Out of memory cooking \"%s\"", png->name);
+            closePNG(png);
+        }
+        else if (built && !resampleImage(texels, pw, ph, chain[0], w, h, n)) {
+            cacheError(error, errorSize, "Out of memory scaling \"%s\"", png->name);
+            built = false;
+        }
+        free(texels);
+    }
+
+    if (built && !mipBuild(chain, header.numLevels, w, h, n,
+                           (flags & TEXCACHE_GAMMA) ? MIP_GAMMA : MIP_BOX)) {
+        cacheError(error, errorSize, "Out of memory building mipmaps for \"%s\"", png->name);
+        built = false;
+    }
+    if (!built) {
+        free(scratch);
+        free(data);
+        return NULL;
+    }
+
+    if (scratch != NULL) {
+        for (GLuint i = 0; i < header.numLevels; ++i)
+            encodeLevel(chain[i], levels[i].width, levels[i].height, n, data + levels[i].offset);
+        free(scratch);
+    }
+
+    *size = offset;
+    return data;
+}
+
+// write the container beside the png, through a temporary so a reader
+// never maps half a file; a cache that cannot be written is only slower
+// each writer gets its own temporary, as workers may cook the same
+// picture at once
+static void writeContainer(const char *path, const void *data, size_t size)
+{
+    char tmp[1024 + 32];
+
+    snprintf(tmp, sizeof(tmp), "%s.XXXXXX", path);
+
+    // a png read from the archive may have no directory on disk yet
+    int fd = mkstemp(tmp);
+    if (fd < 0) {
+        char dir[sizeof(tmp)];
+        char *slash;
+
+        snprintf(dir, sizeof(dir), "%s", path);
+        slash = strrchr(dir, '/');
+        if (slash == NULL)
+            return;
+        *slash = '\0';
+        mkdir(dir, 0755);
+
+        snprintf(tmp, sizeof(tmp), "%s.XXXXXX", path);
+        fd = mkstemp(tmp);
+        if (fd < 0)
+            return;
+    }
+
+    // mkstemp makes the file private, the cache is as readable as the png
+    fchmod(fd, 0644);
+
+    FILE *fp = fdopen(fd, "wb");
+    if (fp == NULL) {
+        close(fd);
+        unlink(tmp);
+        return;
+    }
+
+    bool ok = fwrite(data, 1, size, fp) == size;
+    ok = fclose(fp) == 0 && ok;
+
+    if (!ok || rename(tmp, path) != 0)
+        unlink(tmp);
+}
+
+// map a cooked file, true if it is whole and was cooked from the png
+// as it is now with the same settings; a missing png trusts the cache
+static bool mapContainer(const char *path, const texsource *src, GLuint flags,
+                         int maxSize, cookedtexture *tex)
+{
+    struct stat st;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    if (fstat(fd, &st) < 0 || (size_t)st.st_size < sizeof(texheader)) {
+        close(fd);
+        return false;
+    }
+
+    void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return false;
+
+    const texheader *header = data;
+    const texlevel  *levels = (const texlevel *)(header + 1);
+    bool fresh = header->magic == TEXCACHE_MAGIC && header->version == TEXCACHE_VERSION &&
+                 header->flags == flags && header->maxSize == (GLuint)maxSize &&
+                 header->numLevels >= 1 && header->numLevels <= TEXCACHE_MAX_LEVELS &&
+                 header->components >= 1 && header->components <= 4 &&
+                 sizeof(texheader) + header->numLevels * sizeof(texlevel) <= (size_t)st.st_size;
+
+    if (fresh && src != NULL)
+        fresh = header->srcMtime == src->mtime && header->srcSize == src->size;
+
+    for (GLuint i = 0; fresh && i < header->numLevels; ++i)
+        fresh = levels[i].size == levelSize(header, levels[i].width, levels[i].height) &&
+                levels[i].offset + levels[i].size <= (uint64_t)st.st_size;
+
+    if (!fresh) {
+        munmap(data, st.st_size);
+        return false;
+    }
+
+    tex->header = header;
+    tex->levels = levels;
+    tex->data   = data;
+    tex->size   = st.st_size;
+    tex->mapped = true;
+    tex->cooked = false;
+    return true;
+}
+
+// size and modification time of a png, on disk or in the archive
+static bool findSource(const char *filename, texsource *src)
+{
+    struct stat st;
+
+    if (stat(filename, &st) == 0) {
+        src->size  = st.st_size;
+        src->mtime = st.st_mtime;
+        return true;
+    }
+    return archiveStat(filename, &src->size, &src->mtime);
+}
+
+// map the cooked copy of a png, or cook it and refresh the file
+bool texCacheLoad(const char *filename, GLuint flags, int maxSize, cookedtexture *tex,
+                  char *error, size_t errorSize)
+{
+    char path[1024];
+    texsource src;
+    bool hasSource = findSource(filename, &src);
+
+    memset(tex, 0, sizeof(*tex));
+    snprintf(path, sizeof(path), "%s.%u-%d%s", filename, flags, maxSize, TEXCACHE_SUFFIX);
+
+    if (mapContainer(path, hasSource ? &src : NULL, flags, maxSize, tex))
+        return true;
+
+    // stale or missing, cook it from the png
+    pngreader png;
+    if (!openPNG(filename, &png, error, errorSize))
+        return false;
+
+    size_t size;
+    void *data = cookContainer(&png, flags, maxSize, &src, &size, error, errorSize);
+    if (data == NULL)
+        return false;
+
+    writeContainer(path, data, size);
+
+    tex->header = data;
+    tex->levels = (const texlevel *)(tex->header + 1);
+    tex->data   = data;
+    tex->size   = size;
+    tex->mapped = false;
+    tex->cooked = true;
+    return true;
+}
+
+// true if the GL can take S3TC blocks
+static bool hasS3TC()
+{
+    static int supported = -1;
+
+    if (supported < 0) {
+        const char *ext = (const char *)glGetString(GL_EXTENSIONS);
+        supported = ext != NULL && strstr(ext, "GL_EXT_texture_compression_s3tc") != NULL;
+    }
+    return supported;
+}
+
+// upload one level to the bound 2d texture
+bool texCacheUploadLevel(const cookedtexture *tex, int level)
+{
+    const texheader *h = tex->header;
+    const texlevel  *l = &tex->levels[level];
+    const GLubyte   *data = tex->data;
+    GLint alignment;
+
+    if (isCompressed(h->internalFormat) && !hasS3TC())
+        return false;
+
+    // cooked rows are packed tight
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    if (isCompressed(h->internalFormat))
+        glCompressedTexImage2D(GL_TEXTURE_2D, level, h->internalFormat, l->width, l->height, 0,
+                               l->size, data + l->offset);
+    else
+        glTexImage2D(GL_TEXTURE_2D, level, h->internalFormat, l->width, l->height, 0,
+                     h->format, GL_UNSIGNED_BYTE, data + l->offset);
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+    return true;
+}
+
+// upload every level to the bound 2d texture
+bool texCacheUpload(const cookedtexture *tex)
+{
+    for (GLuint i = 0; i < tex->header->numLevels; ++i)
+        if (!texCacheUploadLevel(tex, i))
+            return false;
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, tex->header->numLevels - 1);
+    return true;
+}
+
+// unmap or free the container
+void texCacheRelease(cookedtexture *tex)
+{
+    if (tex->data == NULL)
+        return;
+
+    if (tex->mapped)
+        munmap(tex->data, tex->size);
+    else
+        free(tex->data);
+
+    memset(tex, 0, sizeof(*tex));
+}
@@ -0,0 +1,93 @@
+#ifndef TEXCACHE_H
+    #define TEXCACHE_H
+
+    // make c++ friendly
+    #ifdef __cplusplus
+        extern "C" {
+    #endif
+
+    // OpenGL and GLUT headers
+    #ifdef __APPLE__
+        #include <GLUT/glut.h>
+    #else
+        #include <GL/gl.h>
+        #include <GL/glu.h>
+        #include <GL/glut.h>
+    #endif
+
+    #include <stdbool.h>
+    #include <stddef.h>
+    #include <stdint.h>
+
+    // cooked textures sit next to their png, named image.png.F-M.cooked for
+    // flags F and size limit M, so each way a png is cooked has its own copy
+    #define TEXCACHE_SUFFIX   ".cooked"
+    #define TEXCACHE_MAGIC    0x58544353      // "SCTX" in a little-endian file
+    #define TEXCACHE_VERSION  2
+
+    // a 1x1 level is reached within this many halvings of any size GL takes
+    #define TEXCACHE_MAX_LEVELS 16
+
+    // what a texture is cooked with
+    #define TEXCACHE_MIPMAPS     1      // full mip chain, level 0 a power of 2
+    #define TEXCACHE_COMPRESSED  2      // S3TC blocks for RGB and RGBA images
+    #define TEXCACHE_GAMMA       4      // mips averaged as light, not as sRGB values
+
+    /* cooked file layout: a header, numLevels level records, then the
+       pixels of each level, bottom row first as GL expects them; all in
+       host byte order so the file can be mapped and uploaded in place */
+    typedef struct {
+        GLuint   magic;
+        GLuint   version;
+        GLuint   flags;             // TEXCACHE_ flags asked for when cooked
+        GLuint   srcWidth;          // size of the png
+        GLuint   srcHeight;
+        GLuint   components;        // channels in the png, 1 to 4
+        GLenum   format;            // GL_LUMINANCE ... GL_RGBA
+        GLenum   internalFormat;    // components, or the compressed format
+        GLuint   numLevels;
+        GLuint   maxSize;           // longest side asked for, 0 for any
+        int64_t  srcMtime;          // the png the levels were cooked from
+        int64_t  srcSize;
+    } texheader;
+
+    typedef struct {
+        GLuint   width;
+        GLuint   height;
+        uint64_t offset;            // from the start of the file
+        uint64_t size;
+    } texlevel;
+
+    /* a cooked texture, mapped from its file or built in memory */
+    typedef struct {
+        const texheader *header;
+        const texlevel  *levels;
+        void            *data;      // the whole container
+        size_t           size;
+        bool             mapped;    // data is a file mapping, else malloc'd
+        bool             cooked;    // the cache was stale and rebuilt
+    } cookedtexture;
+
+    // map the cooked copy of a png, or cook it and refresh the file when
+    // the png is newer; level 0 is scaled to fit maxSize if it is > 0,
+    // then to a power of 2 for a mip chain; false with the reason in error
+    // touches no GL state, so it can run on a worker
+    bool texCacheLoad(const char *filename, GLuint flags, int maxSize, cookedtexture *tex,
+                      char *error, size_t errorSize);
+
+    // upload one level to the bound 2d texture
+    // false if the GL cannot take the cooked format
+    bool texCacheUploadLevel(const cookedtexture *tex, int level);
+
+    // upload every level to the bound 2d texture
+    // false if the GL cannot take the cooked format
+    bool texCacheUpload(const cookedtexture *tex);
+
+    // unmap or free the container
+    void texCacheRelease(cookedtexture *tex);
+
+    #ifdef __cplusplus
+        }
+    #endif
+
+#endif
@@ -0,0 +1,345 @@
+
+// standard c headers
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+// prototypes and definitions
+#include "texStream.h"
+
+// cooked mip chains, read on the workers, bound through the shadow
+#include "texCache.h"
+#include "workerPool.h"
+#include "glState.h"
+
+// the level asked for when nothing is resident: the whole tail
+#define TAIL_LEVEL  -1
+
+// a texture and how much of it is on the GL
+typedef struct {
+    char          name[256];
+    GLuint        flags;            // how it is cooked, TEXCACHE_
+    int           maxSize;
+    cookedtexture cooked;           // kept from the first read until evicted
+    GLuint        id;               // 0 while nothing is resident
+    int           base;             // finest level on the GL
+    size_t        bytes;            // GL memory of its levels
+    int           pixels;           // on screen this frame, longer side
+    unsigned long lastSeen;         // frame it was last asked for
+    bool          reading;          // a worker owns the fields below
+    int           readLevel;        // level being read, TAIL_LEVEL for the tail
+    int           ready;            // level read and not yet uploaded, -1 if none
+    bool          failed;
+    bool          reported;         // failure printed
+    char          error[256];
+} streamtex;
+
+static streamtex textures[STREAM_MAX_TEXTURES];
+static int       numTextures = 0;
+
+static size_t        budget        = STREAM_DEFAULT_BUDGET;
+static size_t        residentBytes = 0;
+static unsigned long frame         = 1;     // 0 is never seen
+static unsigned long uploads       = 0;
+static unsigned long evictions     = 0;
+
+// hands a texture between the GL thread and the worker reading it
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+// track a png whose mip chain streams in, once however often it is added
+int texStreamAdd(const char *filename, GLuint flags, int maxSize)
+{
+    for (int i = 0; i < numTextures; ++i)
+        if (textures[i].flags == flags && textures[i].maxSize == maxSize &&
+            strcmp(textures[i].name, filename) == 0)
+            return i;
+
+    if (numTextures == STREAM_MAX_TEXTURES) {
+        fprintf(stderr, "Error: more than %d streamed textures\n", STREAM_MAX_TEXTURES);
+        return -1;
+    }
+
+    streamtex *t = &textures[numTextures];
+    memset(t, 0, sizeof(*t));
+    snprintf(t->name, sizeof(t->name), "%s", filename);
+    t->flags   = flags;
+    t->maxSize = maxSize;
+    t->ready   = -1;
+    return numTextures++;
+}
+
+// the longer side of a level
+static int levelTexels(const cookedtexture *c, int level)
+{
+    const texlevel *l = &c->levels[level];
+
+    return l->width > l->height ? l->width : l->height;
+}
+
+// the first level of the tail
+static int tailLevel(const cookedtexture *c)
+{
+    int level = c->header->numLevels - 1;
+
+    while (level > 0 && levelTexels(c, level - 1) <= STREAM_TAIL_TEXELS)
+        --level;
+    return level;
+}
+
+// the coarsest level still covering the pixels on screen
+static int wantedLevel(const streamtex *t)
+{
+    int level = 0;
+
+    while (level + 1 < (int)t->cooked.header->numLevels && levelTexels(&t->cooked, level + 1) >= t->pixels)
+        ++level;
+    return level;
+}
+
+// map or cook the texture and page in a level, run on a worker so the
+// upload finds it in memory
+static void readLevel(void *arg)
+{
+    streamtex *t = arg;
+    int level = t->readLevel;
+    bool ok = true;
+
+    if (t->cooked.data == NULL)
+        ok = texCacheLoad(t->name, t->flags, t->maxSize, &t->cooked, t->error, sizeof(t->error));
+
+    if (ok) {
+        int last = level;
+
+        if (level == TAIL_LEVEL) {
+            level = tailLevel(&t->cooked);
+            last  = t->cooked.header->numLevels - 1;
+        }
+
+        // one read per page faults the mapping in
+        const volatile GLubyte *data = t->cooked.data;
+        for (int l = level; l <= last; ++l)
+            for (uint64_t b = 0; b < t->cooked.levels[l].size; b += 4096)
+                (void)data[t->cooked.levels[l].offset + b];
+    }
+
+    pthread_mutex_lock(&lock);
+    t->failed  = !ok;
+    t->ready   = ok ? level : -1;
+    t->reading = false;
+    pthread_mutex_unlock(&lock);
+}
+
+// drop a texture's levels and its cooked copy
+static void evict(streamtex *t)
+{
+    if (t->id) {
+        // the GL unbinds a deleted texture, the shadow has to hear of it
+        glsBindTexture(GL_TEXTURE_2D, 0);
+        glDeleteTextures(1, &t->id);
+    }
+    residentBytes -= t->bytes;
+    t->id    = 0;
+    t->bytes = 0;
+    t->ready = -1;
+    texCacheRelease(&t->cooked);
+}
+
+// evict the least recently seen textures until bytes more fit the budget
+// false if the textures on screen this frame fill it alone
+static bool makeRoom(size_t bytes)
+{
+    while (residentBytes + bytes > budget) {
+        streamtex *oldest = NULL;
+
+        for (int i = 0; i < numTextures; ++i) {
+            streamtex *t = &textures[i];
+
+            if (t->id && !t->reading && t->lastSeen != frame &&
+                (oldest == NULL || t->lastSeen < oldest->lastSeen))
+                oldest = t;
+        }
+        if (oldest == NULL)
+            return false;
+
+        evict(oldest);
+        ++evictions;
+    }
+    return true;
+}
+
+// put a read level on the GL, with the rest of the tail the first time
+// false if the budget has no room for it
+static bool upload(streamtex *t)
+{
+    int first = t->ready;
+    int last  = t->id ? first : (int)t->cooked.header->numLevels - 1;
+    size_t bytes = 0;
+
+    for (int l = first; l <= last; ++l)
+        bytes += t->cooked.levels[l].size;
+    if (!makeRoom(bytes))
+        return false;
+
+    if (!t->id) {
+        glGenTextures(1, &t->id);
+        glsBindTexture(GL_TEXTURE_2D, t->id);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, t->cooked.header->numLevels - 1);
+    }
+    else
+        glsBindTexture(GL_TEXTURE_2D, t->id);
+
+    for (int l = first; l <= last; ++l)
+        if (!texCacheUploadLevel(&t->cooked, l)) {
+            snprintf(t->error, sizeof(t->error), "%s: the GL cannot take its cooked format", t->name);
+            t->failed = true;
+            evict(t);
+            return true;
+        }
+
+    // the levels below base are left out of sampling until they arrive
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, first);
+    t->base   = first;
+    t->bytes += bytes;
+    t->ready  = -1;
+    residentBytes += bytes;
+    uploads += last - first + 1;
+    return true;
+}
+
+// the texture on screen this frame
+void texStreamRequest(int id, int pixels)
+{
+    if (id < 0 || id >= numTextures)
+        return;
+
+    streamtex *t = &textures[id];
+    if (t->lastSeen != frame) {
+        t->lastSeen = frame;
+        t->pixels   = 0;
+    }
+    if (pixels > t->pixels)
+        t->pixels = pixels;
+}
+
+// the GL texture to draw with
+GLuint texStreamTexture(int id, int *texels)
+{
+    if (id < 0 || id >= numTextures || !textures[id].id) {
+        *texels = 0;
+        return 0;
+    }
+
+    *texels = levelTexels(&textures[id].cooked, textures[id].base);
+    return textures[id].id;
+}
+
+// upload, evict and read for the textures asked for this frame
+bool texStreamUpdate()
+{
+    int  uploaded = 0;
+    bool pending  = false;
+
+    for (int i = 0; i < numTextures; ++i) {
+        streamtex *t = &textures[i];
+        bool reading;
+
+        if (t->lastSeen != frame)
+            continue;
+
+        pthread_mutex_lock(&lock);
+        reading = t->reading;
+        pthread_mutex_unlock(&lock);
+
+        if (reading) {
+            pending = true;
+            continue;
+        }
+
+        if (t->failed) {
+            if (!t->reported)
+                fprintf(stderr, "Error: streaming %s\n", t->error);
+            t->reported = true;
+            continue;
+        }
+
+        // a level read earlier goes up first, a few a frame
+        if (t->ready >= 0) {
+            if (uploaded == STREAM_UPLOADS_PER_FRAME) {
+                pending = true;
+                continue;
+            }
+            if (!upload(t))
+                continue;
+            ++uploaded;
+        }
+
+        // then the next finer level, if the screen wants it and it fits
+        int next;
+        if (!t->id)
+            next = TAIL_LEVEL;
+        else if (t->base > wantedLevel(t) && makeRoom(t->cooked.levels[t->base - 1].size))
+            next = t->base - 1;
+        else
+            continue;
+
+        t->readLevel = next;
+        t->reading   = true;
+        pending      = true;
+        poolSubmit(readLevel, t);
+    }
+
+    ++frame;
+    return pending;
+}
+
+// GL memory the streamed levels may take
+void texStreamSetBudget(size_t bytes)
+{
+    budget = bytes;
+}
+
+// drop every level from the GL
+void texStreamFlush()
+{
+    // reads in flight write into the textures
+    poolWait();
+
+    for (int i = 0; i < numTextures; ++i)
+        evict(&textures[i]);
+    residentBytes = 0;
+}
+
+// residency now and since the start
+void texStreamGetStats(streamstats *s)
+{
+    memset(s, 0, sizeof(*s));
+
+    pthread_mutex_lock(&lock);
+    for (int i = 0; i < numTextures; ++i) {
+        s->resident += textures[i].id != 0;
+        s->reading  += textures[i].reading;
+    }
+    pthread_mutex_unlock(&lock);
+
+    s->textures      = numTextures;
+    s->residentBytes = residentBytes;
+    s->budget        = budget;
+    s->uploads       = uploads;
+    s->evictions     = evictions;
+}
+
+void texStreamPrintStats(FILE *file)
+{
+    streamstats s;
+
+    texStreamGetStats(&s);
+    fprintf(file, "Streamed textures: %d of %d resident, %d reading, %.0f of %.0f KB budget, "
+            "%lu levels uploaded, %lu evicted\n",
+            s.resident, s.textures, s.reading, s.residentBytes / 1024.0, s.budget / 1024.0,
+            s.uploads, s.evictions);
+}
@@ -0,0 +1,82 @@
+#ifndef TEXSTREAM_H
+    #define TEXSTREAM_H
+
+    // make c++ friendly
+    #ifdef __cplusplus
+        extern "C" {
+    #endif
+
+    // OpenGL and GLUT headers
+    #ifdef __APPLE__
+        #include <GLUT/glut.h>
+    #else
+        #include <GL/gl.h>
+        #include <GL/glu.h>
+        #include <GL/glut.h>
+    #endif
+
+    #include <stdbool.h>
+    #include <stddef.h>
+    #include <stdio.h>
+
+    // most textures the manager tracks
+    #define STREAM_MAX_TEXTURES  512
+
+    // GL memory the streamed levels may take unless told otherwise
+    #define STREAM_DEFAULT_BUDGET  (64 * 1024 * 1024)
+
+    // a texture starts with the levels no larger than this on a side,
+    // the finer ones follow one at a time as they are asked for
+    #define STREAM_TAIL_TEXELS  64
+
+    // most levels put on the GL by one update, keeps the frame short
+    #define STREAM_UPLOADS_PER_FRAME  2
+
+    /* residency over the life of the manager */
+    typedef struct {
+        int           textures;         // tracked
+        int           resident;         // with levels on the GL
+        int           reading;          // being read on the workers
+        size_t        residentBytes;    // GL memory their levels take
+        size_t        budget;
+        unsigned long uploads;          // levels put on the GL
+        unsigned long evictions;        // textures dropped to make room
+    } streamstats;
+
+    // track a png whose mip chain streams in from its cooked copy
+    // returns its handle, the same one for the same file, flags and size,
+    // so its users share one GL texture and one charge to the budget;
+    // -1 if the manager is full
+    int texStreamAdd(const char *filename, GLuint flags, int maxSize);
+
+    // the texture is on screen this frame, pixels across its longer side;
+    // its finest level wanted is the first no smaller than the largest
+    // asked for by any of its users
+    void texStreamRequest(int id, int pixels);
+
+    // the GL texture to draw with, 0 if nothing is resident yet; texels
+    // gets the longer side of its finest level on the GL
+    GLuint texStreamTexture(int id, int *texels);
+
+    // once a frame after the requests: upload the levels read since the
+    // last update, evict the least recently seen textures when the budget
+    // is short and start reading the next levels on the workers
+    // true while any texture still has levels on the way
+    bool texStreamUpdate();
+
+    // GL memory the streamed levels may take
+    void texStreamSetBudget(size_t bytes);
+
+    // drop every level from the GL, waiting for reads in flight; the
+    // textures stream in again as they are asked for
+    void texStreamFlush();
+
+    // residency now and since the start
+    void texStreamGetStats(streamstats *s);
+    void texStreamPrintStats(FILE *file);
+
+    #ifdef __cplusplus
+        }
+    #endif
+
+#endif
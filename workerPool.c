@@ -0,0 +1,174 @@
+// standard c headers
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <unistd.h>
+
+// prototypes and definitions
+#include "workerPool.h"
+
+// a queued call
+typedef struct {
+    void (*job)(void *arg);
+    void *arg;
+    poolgroup *group;       // NULL if not in one
+} pooljob;
+
+static pthread_t threads[POOL_MAX_THREADS];
+static int numThreads = 0;
+
+// jobs waiting are jobs[head] to jobs[head + count - 1]
+static pooljob jobs[POOL_MAX_JOBS];
+static int head  = 0;
+static int count = 0;
+static int busy  = 0;       // jobs taken but not finished
+static bool stopping = false;
+
+static pthread_mutex_t lock    = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  hasJob  = PTHREAD_COND_INITIALIZER;    // a job was queued or stopping
+static pthread_cond_t  hasRoom = PTHREAD_COND_INITIALIZER;    // a job was taken
+static pthread_cond_t  idle    = PTHREAD_COND_INITIALIZER;    // nothing waiting or running
+static pthread_cond_t  grouped = PTHREAD_COND_INITIALIZER;    // a job in a group finished
+
+// take the next job and run it, called and returning with the lock held
+static void runNext()
+{
+    pooljob j = jobs[head];
+    head = (head + 1) % POOL_MAX_JOBS;
+    --count;
+    ++busy;
+    pthread_cond_signal(&hasRoom);
+    pthread_mutex_unlock(&lock);
+
+    j.job(j.arg);
+
+    pthread_mutex_lock(&lock);
+    if (j.group != NULL && --j.group->pending == 0)
+        pthread_cond_broadcast(&grouped);
+    if (--busy == 0 && count == 0)
+        pthread_cond_broadcast(&idle);
+}
+
+// take jobs until told to stop with none left
+static void *workerMain(void *unused)
+{
+    pthread_mutex_lock(&lock);
+    for (;;) {
+        while (count == 0 && !stopping)
+            pthread_cond_wait(&hasJob, &lock);
+        if (count == 0)
+            break;
+
+        runNext();
+    }
+    pthread_mutex_unlock(&lock);
+
+    return NULL;
+}
+
+// start the workers, one per processor when threads <= 0
+// false if none could be started, jobs then run on the caller
+bool poolStart(int wanted)
+{
+    if (numThreads > 0)
+        return true;
+
+    if (wanted <= 0)
+        wanted = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (wanted < 1)
+        wanted = 1;
+    if (wanted > POOL_MAX_THREADS)
+        wanted = POOL_MAX_THREADS;
+
+    stopping = false;
+    for (numThreads = 0; numThreads < wanted; ++numThreads)
+        if (pthread_create(&threads[numThreads], NULL, workerMain, NULL) != 0)
+            break;
+
+    if (numThreads == 0)
+        fprintf(stderr, "Error: could not start worker threads, working on one.\n");
+
+    return numThreads > 0;
+}
+
+// run job(arg) on a worker; jobs must not touch the GL
+void poolSubmit(void (*job)(void *arg), void *arg)
+{
+    if (numThreads == 0) {
+        job(arg);
+        return;
+    }
+
+    pthread_mutex_lock(&lock);
+    while (count == POOL_MAX_JOBS)
+        pthread_cond_wait(&hasRoom, &lock);
+
+    jobs[(head + count) % POOL_MAX_JOBS].job   = job;
+    jobs[(head + count) % POOL_MAX_JOBS].arg   = arg;
+    jobs[(head + count) % POOL_MAX_JOBS].group = NULL;
+    ++count;
+    pthread_cond_signal(&hasJob);
+    pthread_mutex_unlock(&lock);
+}
+
+// run job(arg) on a worker as part of group g
+// a full queue runs it here, waiting for room could wait on ourselves
+void poolSubmitGroup(poolgroup *g, void (*job)(void *arg), void *arg)
+{
+    pthread_mutex_lock(&lock);
+    if (numThreads == 0 || count == POOL_MAX_JOBS) {
+        pthread_mutex_unlock(&lock);
+        job(arg);
+        return;
+    }
+
+    jobs[(head + count) % POOL_MAX_JOBS].job   = job;
+    jobs[(head + count) % POOL_MAX_JOBS].arg   = arg;
+    jobs[(head + count) % POOL_MAX_JOBS].group = g;
+    ++g->pending;
+    ++count;
+    pthread_cond_signal(&hasJob);
+    pthread_mutex_unlock(&lock);
+}
+
+// wait until the jobs in group g have finished, helping with the queue
+void poolWaitGroup(poolgroup *g)
+{
+    pthread_mutex_lock(&lock);
+    while (g->pending > 0) {
+        if (count > 0)
+            runNext();
+        else
+            pthread_cond_wait(&grouped, &lock);
+    }
+    pthread_mutex_unlock(&lock);
+}
+
+// wait until every job submitted so far has finished
+void poolWait()
+{
+    pthread_mutex_lock(&lock);
+    while (count > 0 || busy > 0)
+        pthread_cond_wait(&idle, &lock);
+    pthread_mutex_unlock(&lock);
+}
+
+// number of workers running
+int poolThreads()
+{
+    return numThreads;
+}
+
+// finish waiting jobs and stop the workers
+void poolStop()
+{
+    pthread_mutex_lock(&lock);
+    stopping = true;
+    pthread_cond_broadcast(&hasJob);
+    pthread_mutex_unlock(&lock);
+
+    for (int i = 0; i < numThreads; ++i)
+        pthread_join(threads[i], NULL);
+    numThreads = 0;
+}
@@ -0,0 +1,48 @@
+#ifndef WORKERPOOL_H
+    #define WORKERPOOL_H
+
+    // make c++ friendly
+    #ifdef __cplusplus
+        extern "C" {
+    #endif
+
+    #include <stdbool.h>
+
+    // most worker threads, and most jobs waiting before poolSubmit blocks
+    #define POOL_MAX_THREADS 16
+    #define POOL_MAX_JOBS    256
+
+    // jobs that can be waited for apart from the rest of the queue
+    typedef struct {
+        int pending;            // submitted but not finished
+    } poolgroup;
+
+    // start the workers, one per processor when threads <= 0
+    // false if none could be started, jobs then run on the caller
+    bool poolStart(int threads);
+
+    // run job(arg) on a worker; jobs must not touch the GL
+    void poolSubmit(void (*job)(void *arg), void *arg);
+
+    // run job(arg) on a worker as part of group g, which must start zeroed;
+    // runs it on the caller when the queue is full
+    void poolSubmitGroup(poolgroup *g, void (*job)(void *arg), void *arg);
+
+    // wait until the jobs in group g have finished, running queued jobs
+    // meanwhile so a job can wait for the jobs it split its work into
+    void poolWaitGroup(poolgroup *g);
+
+    // wait until every job submitted so far has finished
+    void poolWait();
+
+    // number of workers running
+    int poolThreads();
+
+    // finish waiting jobs and stop the workers
+    void poolStop();
+
+    #ifdef __cplusplus
+        }
+    #endif
+
+#endif
@@ -0,0 +1,322 @@
+
+// standard c headers
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// file mapping
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// deflate
+#include <zlib.h>
+
+// prototypes and definitions
+#include "zipArchive.h"
+
+// record signatures
+#define ZIP_END_SIG      0x06054b50
+#define ZIP_CENTRAL_SIG  0x02014b50
+#define ZIP_LOCAL_SIG    0x04034b50
+
+// fixed record sizes, before their names
+#define ZIP_END_SIZE      22
+#define ZIP_CENTRAL_SIZE  46
+#define ZIP_LOCAL_SIZE    30
+
+// the end record sits within a comment of this much from the end
+#define ZIP_MAX_COMMENT 65535
+
+// compression methods read
+#define ZIP_STORED   0
+#define ZIP_DEFLATED 8
+
+// a file in the archive
+typedef struct {
+    char    *name;
+    int      method;
+    size_t   dataOffset;        // compressed bytes, past the local header
+    size_t   packedSize;
+    size_t   size;
+    int64_t  mtime;
+} zipentry;
+
+struct _zipstream {
+    const zipentry *entry;
+    size_t          read;       // compressed bytes used
+    size_t          left;       // bytes still to hand out
+    z_stream        z;
+};
+
+static unsigned char *archive     = NULL;
+static size_t         archiveSize = 0;
+static zipentry       entries[ZIP_MAX_ENTRIES];
+static int            numEntries  = 0;
+
+// little-endian fields
+static unsigned get16(const unsigned char *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t get32(const unsigned char *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// files Finder leaves in archives made on a mac
+static bool isNoise(const char *name)
+{
+    const char *base = strrchr(name, '/');
+    base = base != NULL ? base + 1 : name;
+
+    return strncmp(name, "__MACOSX/", 9) == 0 || strstr(name, "/__MACOSX/") != NULL ||
+           strcmp(base, ".DS_Store") == 0 || strncmp(base, "._", 2) == 0;
+}
+
+// dos date and time to seconds
+static int64_t dosTime(unsigned date, unsigned time)
+{
+    struct tm t = {0};
+
+    t.tm_year  = ((date >> 9) & 127) + 80;
+    t.tm_mon   = ((date >> 5) & 15) - 1;
+    t.tm_mday  = date & 31;
+    t.tm_hour  = (time >> 11) & 31;
+    t.tm_min   = (time >> 5) & 63;
+    t.tm_sec   = (time & 31) * 2;
+    t.tm_isdst = -1;
+    return (int64_t)mktime(&t);
+}
+
+// entries are kept sorted by name
+static int compareEntries(const void *a, const void *b)
+{
+    return strcmp(((const zipentry *)a)->name, ((const zipentry *)b)->name);
+}
+
+// find an entry by name
+static const zipentry *findEntry(const char *name)
+{
+    zipentry key;
+
+    if (archive == NULL)
+        return NULL;
+
+    key.name = (char *)name;
+    return bsearch(&key, entries, numEntries, sizeof(zipentry), compareEntries);
+}
+
+// add the central directory record at p, false if it runs off the archive
+static bool indexEntry(const unsigned char *p, const unsigned char *end)
+{
+    unsigned nameLen = get16(p + 28);
+    size_t   local   = get32(p + 42);
+
+    if (p + ZIP_CENTRAL_SIZE + nameLen > end)
+        return false;
+
+    // directories, odd methods and zip64 sizes are left out, and so is a
+    // damaged stored entry whose sizes differ, as it would be read past
+    // its packed bytes
+    int      method = get16(p + 10);
+    uint32_t packed = get32(p + 20), size = get32(p + 24);
+    if (nameLen == 0 || p[ZIP_CENTRAL_SIZE + nameLen - 1] == '/' ||
+        (method != ZIP_STORED && method != ZIP_DEFLATED) ||
+        (method == ZIP_STORED && size != packed) ||
+        packed == 0xffffffff || size == 0xffffffff)
+        return true;
+
+    char *name = malloc(nameLen + 1);
+    if (name == NULL)
+        return false;
+    memcpy(name, p + ZIP_CENTRAL_SIZE, nameLen);
+    name[nameLen] = '\0';
+
+    // the local header has its own name and extra lengths
+    if (isNoise(name) || local + ZIP_LOCAL_SIZE > archiveSize ||
+        get32(archive + local) != ZIP_LOCAL_SIG) {
+        free(name);
+        return true;
+    }
+    size_t data = local + ZIP_LOCAL_SIZE + get16(archive + local + 26) + get16(archive + local + 28);
+    if (data + packed > archiveSize || numEntries == ZIP_MAX_ENTRIES) {
+        free(name);
+        return true;
+    }
+
+    zipentry *e   = &entries[numEntries++];
+    e->name       = name;
+    e->method     = method;
+    e->dataOffset = data;
+    e->packedSize = packed;
+    e->size       = size;
+    e->mtime      = dosTime(get16(p + 14), get16(p + 12));
+    return true;
+}
+
+// map a zip and index its central directory
+bool archiveOpen(const char *filename)
+{
+    struct stat st;
+
+    if (archive != NULL)
+        archiveClose();
+
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    if (fstat(fd, &st) < 0 || (size_t)st.st_size < ZIP_END_SIZE) {
+        close(fd);
+        return false;
+    }
+
+    void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return false;
+
+    archive     = data;
+    archiveSize = st.st_size;
+
+    // the end record, searched for backwards past any comment
+    const unsigned char *end = NULL;
+    const unsigned char *stop = archiveSize > ZIP_END_SIZE + ZIP_MAX_COMMENT ?
+                                archive + archiveSize - ZIP_END_SIZE - ZIP_MAX_COMMENT : archive;
+    for (const unsigned char *p = archive + archiveSize - ZIP_END_SIZE; p >= stop; --p)
+        if (get32(p) == ZIP_END_SIG) {
+            end = p;
+            break;
+        }
+
+    if (end == NULL || (size_t)get32(end + 16) + get32(end + 12) > archiveSize) {
+        fprintf(stderr, "Error: \"%s\" is not a zip archive!\n", filename);
+        archiveClose();
+        return false;
+    }
+
+    const unsigned char *p       = archive + get32(end + 16);
+    const unsigned char *dirEnd  = p + get32(end + 12);
+    unsigned             records = get16(end + 10);
+
+    for (unsigned i = 0; i < records; ++i) {
+        if (p + ZIP_CENTRAL_SIZE > dirEnd || get32(p) != ZIP_CENTRAL_SIG || !indexEntry(p, dirEnd)) {
+            fprintf(stderr, "Error: \"%s\" has a damaged directory!\n", filename);
+            archiveClose();
+            return false;
+        }
+        p += ZIP_CENTRAL_SIZE + get16(p + 28) + get16(p + 30) + get16(p + 32);
+    }
+
+    qsort(entries, numEntries, sizeof(zipentry), compareEntries);
+    return true;
+}
+
+// true if an archive is open
+bool archiveIsOpen()
+{
+    return archive != NULL;
+}
+
+// size and modification time of an entry
+bool archiveStat(const char *name, int64_t *size, int64_t *mtime)
+{
+    const zipentry *e = findEntry(name);
+
+    if (e == NULL)
+        return false;
+
+    *size  = e->size;
+    *mtime = e->mtime;
+    return true;
+}
+
+// start reading an entry
+zipstream *archiveOpenEntry(const char *name)
+{
+    const zipentry *e = findEntry(name);
+
+    if (e == NULL)
+        return NULL;
+
+    zipstream *s = calloc(1, sizeof(zipstream));
+    if (s == NULL)
+        return NULL;
+
+    s->entry = e;
+    s->left  = e->size;
+
+    // raw deflate, the zip headers stand in for zlib's
+    if (e->method == ZIP_DEFLATED && inflateInit2(&s->z, -MAX_WBITS) != Z_OK) {
+        free(s);
+        return NULL;
+    }
+    return s;
+}
+
+// read up to n bytes of the entry
+long archiveRead(zipstream *s, void *buffer, size_t n)
+{
+    const zipentry *e = s->entry;
+
+    if (n > s->left)
+        n = s->left;
+    if (n == 0)
+        return 0;
+
+    // stored bytes come straight from the mapping
+    if (e->method == ZIP_STORED) {
+        memcpy(buffer, archive + e->dataOffset + s->read, n);
+        s->read += n;
+        s->left -= n;
+        return n;
+    }
+
+    // the mapping is the whole input, zlib takes what it needs
+    s->z.next_in   = archive + e->dataOffset + s->read;
+    s->z.avail_in  = e->packedSize - s->read;
+    s->z.next_out  = buffer;
+    s->z.avail_out = n;
+
+    while (s->z.avail_out > 0) {
+        int status = inflate(&s->z, Z_NO_FLUSH);
+
+        if (status == Z_STREAM_END)
+            break;
+        if (status != Z_OK)
+            return -1;
+    }
+
+    size_t got = n - s->z.avail_out;
+    s->read = e->packedSize - s->z.avail_in;
+    s->left -= got;
+    return got < n ? -1 : (long)got;
+}
+
+// finish reading an entry
+void archiveCloseEntry(zipstream *s)
+{
+    if (s == NULL)
+        return;
+
+    if (s->entry->method == ZIP_DEFLATED)
+        inflateEnd(&s->z);
+    free(s);
+}
+
+// unmap the archive
+void archiveClose()
+{
+    for (int i = 0; i < numEntries; ++i)
+        free(entries[i].name);
+    numEntries = 0;
+
+    if (archive != NULL)
+        munmap(archive, archiveSize);
+    archive     = NULL;
+    archiveSize = 0;
+}
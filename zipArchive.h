@@ -0,0 +1,47 @@
+#ifndef ZIPARCHIVE_H
+    #define ZIPARCHIVE_H
+
+    // make c++ friendly
+    #ifdef __cplusplus
+        extern "C" {
+    #endif
+
+    #include <stdbool.h>
+    #include <stddef.h>
+    #include <stdint.h>
+
+    // most files the archive index holds
+    #define ZIP_MAX_ENTRIES 1024
+
+    // an archive entry being read
+    typedef struct _zipstream zipstream;
+
+    // map a zip and index its central directory, skipping directories and
+    // the __MACOSX and .DS_Store files Finder adds; false if it is missing
+    // or not a zip; entries can then be read from any thread
+    bool archiveOpen(const char *filename);
+
+    // true if an archive is open
+    bool archiveIsOpen();
+
+    // size and modification time of an entry, false if it is not there
+    bool archiveStat(const char *name, int64_t *size, int64_t *mtime);
+
+    // start reading an entry, NULL if it is not there
+    zipstream *archiveOpenEntry(const char *name);
+
+    // read up to n bytes of the entry, fewer only at its end
+    // -1 if the entry is damaged
+    long archiveRead(zipstream *s, void *buffer, size_t n);
+
+    // finish reading an entry
+    void archiveCloseEntry(zipstream *s);
+
+    // unmap the archive, no entry may still be open
+    void archiveClose();
+
+    #ifdef __cplusplus
+        }
+    #endif
+
+#endif